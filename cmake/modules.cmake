@@ -109,4 +109,19 @@ macro(add_example EXAMPLE_NAME GROUP_NAME LIB_DEPENDENCY)
                 RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bin/Release")
         endif()
     endif()
+endmacro()
+
+#The NoGPU backend has no CUDA compiler, .cu files are compiled as C++ and their kernels are run on the host by cuExecute
+#CMake 3.20 or later is needed to pass the explicit language flag (-x c++ or /TP) for the .cu extension
+macro(compile_cuda_sources_on_host SOURCE_LIST)
+    if("${PERIDYNO_GPU_BACKEND}" STREQUAL "NoGPU")
+        if(CMAKE_VERSION VERSION_LESS 3.20)
+            message(FATAL_ERROR "The NoGPU backend requires CMake 3.20 or later")
+        endif()
+        foreach(SRC IN ITEMS ${${SOURCE_LIST}})
+            if("${SRC}" MATCHES "\\.cu$")
+                set_source_files_properties(${SRC} PROPERTIES LANGUAGE CXX)
+            endif()
+        endforeach()
+    endif()
 endmacro()
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "Algorithm/HostScan.h"
+#include "Algorithm/HostReduction.h"
+#include "Algorithm/HostSort.h"
+#include "ThreadPool.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+
+using namespace dyno;
+
+/**
+ * @brief Compare the host parallel primitives against serial loops, usage: Benchmark_HostAlgorithm [number of elements]
+ */
+
+double measure(const std::function<void()>& func, int repeat = 5)
+{
+	double best = 1e30;
+	for (int r = 0; r < repeat; r++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		func();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+	}
+
+	return best;
+}
+
+void report(const char* name, double serial, double parallel)
+{
+	printf("%-24s %12.3f %12.3f %10.2fx\n", name, serial, parallel, serial / parallel);
+}
+
+int main(int argc, char** argv)
+{
+	uint num = argc > 1 ? (uint)atoi(argv[1]) : (1 << 24);
+
+	printf("Elements: %u, threads: %u\n", num, ThreadPool::instance()->size() + 1);
+	printf("%-24s %12s %12s %11s\n", "", "serial (ms)", "host (ms)", "speedup");
+
+	std::mt19937 rng(0);
+
+	std::vector<uint> counts(num);
+	for (uint i = 0; i < num; i++)
+		counts[i] = rng() % 32;
+
+	std::vector<uint> offsets(num);
+
+	HostScan<uint> scan;
+	double serial = measure([&]() {
+		uint sum = 0;
+		for (uint i = 0; i < num; i++)
+		{
+			offsets[i] = sum;
+			sum += counts[i];
+		}
+	});
+	double parallel = measure([&]() { scan.exclusive(offsets.data(), counts.data(), num); });
+	report("Exclusive scan", serial, parallel);
+
+	std::vector<Vec3f> points(num);
+	for (uint i = 0; i < num; i++)
+		points[i] = Vec3f(float(rng()) / rng.max(), float(rng()) / rng.max(), float(rng()) / rng.max());
+
+	HostReduction<Vec3f> reduce;
+	Vec3f bound;
+	serial = measure([&]() {
+		Vec3f hi = points[0];
+		for (uint i = 1; i < num; i++)
+			hi = hi.maximum(points[i]);
+
+		bound = hi;
+	});
+	parallel = measure([&]() { bound = reduce.maximum(points.data(), num); });
+	report("Maximum (Vec3f)", serial, parallel);
+
+	std::vector<uint64> keys(num);
+	for (uint i = 0; i < num; i++)
+		keys[i] = ((uint64)rng() << 32) | rng();
+
+	std::vector<uint64> sorted;
+	serial = measure([&]() {
+		sorted = keys;
+		std::sort(sorted.begin(), sorted.end());
+	}, 1);
+
+	HostSort<uint64> sorter;
+	parallel = measure([&]() {
+		sorted = keys;
+		sorter.sort(sorted.data(), num);
+	}, 1);
+	report("Sort (uint64)", serial, parallel);
+
+	std::vector<uint> ids(num);
+	serial = measure([&]() {
+		for (uint i = 0; i < num; i++)
+			ids[i] = i;
+
+		std::stable_sort(ids.begin(), ids.end(), [&](uint a, uint b) { return keys[a] < keys[b]; });
+	}, 1);
+	parallel = measure([&]() {
+		sorted = keys;
+		for (uint i = 0; i < num; i++)
+			ids[i] = i;
+
+		sorter.sortByKey(sorted.data(), ids.data(), num);
+	}, 1);
+	report("Sort by key (uint64)", serial, parallel);
+
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include "VkSystem.h"
+#include "VkTransfer.h"
+#include "Catalyzer/VkSort.h"
+
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+
+using namespace dyno;
+
+/**
+ * @brief Compare the bitonic sort against the radix sort of VkSort, usage: Benchmark_VkSort [number of keys]
+ */
+
+double measure(const std::function<void()>& func, int repeat = 5)
+{
+	double best = 1e30;
+	for (int r = 0; r < repeat; r++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		func();
+		auto end = std::chrono::high_resolution_clock::now();
+
+		best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+	}
+
+	return best;
+}
+
+int main(int argc, char** argv)
+{
+	VkSystem::instance()->initialize();
+
+	uint32_t num = argc > 1 ? (uint32_t)atoi(argv[1]) : (1 << 20);
+
+	std::mt19937 rng(0);
+
+	std::vector<uint32_t> keys(num);
+	for (uint32_t i = 0; i < num; i++)
+		keys[i] = rng();
+
+	VkSort<uint32_t> sorter;
+
+	VkDeviceArray<uint32_t> dKeys;
+	dKeys.resize(num);
+
+	// each run starts from the unsorted keys, the upload is included in both timings
+	double bitonic = measure([&]() {
+		vkTransfer(dKeys, keys);
+		sorter.sort(dKeys, UP);
+	});
+
+	double radix = measure([&]() {
+		vkTransfer(dKeys, keys);
+		sorter.radix_sort(dKeys, UP);
+	});
+
+	std::vector<uint32_t> sorted(num);
+	vkTransfer(sorted, dKeys);
+
+	printf("Sorting %u keys, bitonic: %.3f ms, radix: %.3f ms, %s\n", num, bitonic, radix,
+		std::is_sorted(sorted.begin(), sorted.end()) ? "sorted" : "NOT sorted");
+
+	return std::is_sorted(sorted.begin(), sorted.end()) ? 0 : 1;
+}
@@ -2,17 +2,122 @@
 
 #include <Alembic/AbcGeom/All.h>
 #include <Alembic/AbcCoreOgawa/All.h>
-#include <Alembic/AbcCoreAbstract/Tests/Assert.h>
+
+#include "SceneGraph.h"
 
 #include <sstream>
 #include <iostream>
 #include <fstream>
 #include <string>
-
-#include <ImathRandom.h>
+#include <type_traits>
 
 namespace dyno
 {
+	/**
+	 * @brief The Alembic objects of one archive, only accessed by the thread writing the samples.
+	 *	The archive is created with the first sample and finalized when the object is destroyed.
+	 */
+	class ParticleArchiveABC
+	{
+	public:
+		ParticleArchiveABC(const std::string& filename, double startTime, double timePerSample, bool hasColor)
+			: mFileName(filename)
+			, mStartTime(startTime)
+			, mTimePerSample(timePerSample)
+			, mHasColor(hasColor)
+		{
+		}
+
+		template<typename Real>
+		void write(const CArray<Vec3f>& position, const CArray<Vec3f>* velocity, const CArray<Real>* color)
+		{
+			using namespace Alembic::AbcGeom;
+
+			if (!mArchive.valid())
+			{
+				mArchive = OArchive(Alembic::AbcCoreOgawa::WriteArchive(), mFileName);
+
+				uint32_t timeSampling = mArchive.addTimeSampling(TimeSampling(mTimePerSample, mStartTime));
+				mPoints = OPoints(OObject(mArchive, kTop), "particles", timeSampling);
+
+				//Arbitrary parameters are not back-filled, so the color is either written from the first sample on or never
+				if (mHasColor)
+					mColor = OFloatGeomParam(mPoints.getSchema().getArbGeomParams(), "color", false, kVertexScope, 1, timeSampling);
+			}
+
+			size_t num = position.size();
+
+			//Identical id arrays are stored only once by Ogawa
+			if (mIds.size() < num)
+			{
+				size_t begin = mIds.size();
+				mIds.resize(num);
+				for (size_t i = begin; i < num; i++)
+					mIds[i] = i;
+			}
+
+			V3fArraySample velocitySample;
+			if (velocity != nullptr && velocity->size() == num)
+				velocitySample = toSample(*velocity, mVelocities);
+
+			OPointsSchema::Sample sample(toSample(position, mPositions), UInt64ArraySample(mIds.data(), num), velocitySample);
+			mPoints.getSchema().set(sample);
+
+			if (mHasColor)
+			{
+				FloatArraySample colorSample;
+				if (color != nullptr && color->size() == num)
+				{
+					if constexpr (std::is_same<Real, float>::value)
+					{
+						colorSample = FloatArraySample((const float*)color->begin(), num);
+					}
+					else
+					{
+						mColors.resize(num);
+						for (size_t i = 0; i < num; i++)
+							mColors[i] = (float)(*color)[i];
+
+						colorSample = FloatArraySample(mColors);
+					}
+				}
+
+				mColor.set(OFloatGeomParam::Sample(colorSample, kVertexScope));
+			}
+		}
+
+	private:
+		//Vectors are used in place when they are not padded
+		Alembic::AbcGeom::V3fArraySample toSample(const CArray<Vec3f>& vec, std::vector<Alembic::AbcGeom::V3f>& buffer)
+		{
+			using namespace Alembic::AbcGeom;
+
+			if (sizeof(Vec3f) == sizeof(V3f))
+				return V3fArraySample((const V3f*)vec.begin(), vec.size());
+
+			buffer.resize(vec.size());
+			for (uint i = 0; i < vec.size(); i++)
+				buffer[i] = V3f(vec[i][0], vec[i][1], vec[i][2]);
+
+			return V3fArraySample(buffer);
+		}
+
+		std::string mFileName;
+		double mStartTime;
+		double mTimePerSample;
+		bool mHasColor;
+
+		//Destroyed in reverse order, the archive is closed last
+		Alembic::AbcGeom::OArchive mArchive;
+		Alembic::AbcGeom::OPoints mPoints;
+		Alembic::AbcGeom::OFloatGeomParam mColor;
+
+		std::vector<Alembic::Util::uint64_t> mIds;
+		std::vector<Alembic::AbcGeom::V3f> mPositions;
+		std::vector<Alembic::AbcGeom::V3f> mVelocities;
+		std::vector<float> mColors;
+	};
+
 	IMPLEMENT_TCLASS(ParticleWriterABC, TDataType)
 
 	template<typename TDataType>
@@ -22,17 +127,36 @@ namespace dyno
 		this->inPointSet()->tagOptional(true);
 		this->inColor()->tagOptional(true);
 		this->inPosition()->tagOptional(true);
-
+		this->inVelocity()->tagOptional(true);
 	}
 
 	template<typename TDataType>
 	ParticleWriterABC<TDataType>::~ParticleWriterABC()
 	{
+		//The archive is finalized once the pending samples are written
+		mArchive = nullptr;
+	}
+
+	template<typename TDataType>
+	void ParticleWriterABC<TDataType>::finalizeImpl()
+	{
+		//All samples are written, the archive is finalized here
+		mArchive = nullptr;
+		time_idx = 0;
 	}
 
 	template<typename TDataType>
 	void ParticleWriterABC<TDataType>::output()
 	{
+		//The frame number goes back after a reset, a new run is written into a new archive
+		uint frame = this->inFrameNumber()->getValue();
+		if (!this->inFrameNumber()->isEmpty() && frame < mFrameNumber)
+		{
+			mArchive = nullptr;
+			time_idx = 0;
+		}
+		mFrameNumber = frame;
+
 		if (time_idx % this->varInterval()->getValue() != 0)
 		{
 			time_idx++;
@@ -40,15 +164,14 @@ namespace dyno
 		}
 		time_idx++;
 
-		std::cout << "............Writer .abc file............" << std::endl;
 		DArray<Vec3f>* inPos = nullptr;
 		if (!this->inPointSet()->isEmpty())
 			inPos = &this->inPointSet()->constDataPtr()->getPoints();
 		else if (!this->inPosition()->isEmpty())
 			inPos = &this->inPosition()->getData();
-		else 
+		else
 		{
-			std::cout << "Error : No inPointSet or inPosition input!!\n";
+			Log::sendMessage(Log::Error, "ParticleWriterABC: neither PointSet nor Position is set");
 			return;
 		}
 
@@ -56,68 +179,67 @@ namespace dyno
 		if (!this->inColor()->isEmpty())
 			inColor = &this->inColor()->getData();
 
-		if (inColor != nullptr)
-			if (inColor->size() != inColor->size()) 
-			{
-				std::cout << "Error inColor Input!!\n";
-				return;
-			}
-
-
-		std::stringstream ss; ss << m_output_index;
-		std::string filename = this->varOutputPath()->getValue().string() + std::string("fluid_pos_") + ss.str() + std::string(".abc");
-
-		Alembic::AbcGeom::OArchive archive(Alembic::AbcCoreOgawa::WriteArchive(),
-			filename);
-		Alembic::AbcGeom::OObject topObj(archive, Alembic::AbcGeom::kTop);
-		Alembic::AbcGeom::OPoints ptsObj(topObj, "somePoints");
+		if (inColor != nullptr && inColor->size() != inPos->size())
+		{
+			Log::sendMessage(Log::Error, "ParticleWriterABC: the size of Color does not match the number of particles");
+			return;
+		}
 
-		//CPU Data
-		int total_num = inPos->size();
-		CArray<Coord> host_position;
-		host_position.resize(total_num);
-		host_position.assign(*inPos);
+		DArray<Vec3f>* inVelocity = nullptr;
+		if (!this->inVelocity()->isEmpty())
+			inVelocity = &this->inVelocity()->getData();
 
-		CArray<Real> host_mapping;
-		if (inColor != nullptr) 
+		if (inVelocity != nullptr && inVelocity->size() != inPos->size())
 		{
-			host_mapping.resize(total_num);
-			host_mapping.assign(*inColor);
+			Log::sendMessage(Log::Error, "ParticleWriterABC: the size of Velocity does not match the number of particles");
+			return;
 		}
 
-		//Alembic Data
-		std::vector< Alembic::AbcGeom::V3f > positions;
-		std::vector< Alembic::AbcGeom::V3f > velocities;
-		std::vector< Alembic::Util::uint64_t > ids;
-		std::vector< Alembic::Util::float32_t > widths;
+		std::string filename = this->varOutputPath()->getValue().string() + this->varPrefix()->getValue() + std::string("fluid_pos.abc");
+		if (filename != mFileName)
+			mArchive = nullptr;
 
-		for (int i = 0; i < total_num; i++)
+		if (mArchive == nullptr)
 		{
-				positions.push_back(Alembic::AbcGeom::V3f(host_position[i][0], host_position[i][1], host_position[i][2]));
-				velocities.push_back(Alembic::AbcGeom::V3f(0, 0, 0));
-				ids.push_back(i);
-				if (inColor != nullptr)
-					widths.push_back(host_mapping[i]);
-				else
-					widths.push_back(Alembic::Util::float32_t(0));
-		}
+			SceneGraph* scn = this->getSceneGraph();
+			double frameRate = scn != nullptr ? scn->getFrameRate() : 25.0;
+			double timePerSample = this->varInterval()->getValue() * this->varStride()->getValue() / frameRate;
 
-		Alembic::AbcGeom::OFloatGeomParam::Sample widthSamp;
-		widthSamp.setScope(Alembic::AbcGeom::kVertexScope);
-		widthSamp.setVals(Alembic::AbcGeom::FloatArraySample(widths));
+			mArchive = std::make_shared<ParticleArchiveABC>(filename, frame / frameRate, timePerSample, inColor != nullptr);
+			mFileName = filename;
+		}
 
-		Alembic::AbcGeom::OPointsSchema::Sample psamp(Alembic::AbcGeom::V3fArraySample(positions),
-			Alembic::AbcGeom::UInt64ArraySample(ids), Alembic::AbcGeom::V3fArraySample(velocities),
-			widthSamp);
+		// Take a snapshot on the simulation thread, the sample is appended in the background
+		std::shared_ptr<CArray<Vec3f>> hPosition = mPositionStaging.acquire();
+		hPosition->assign(*inPos);
 
-		ptsObj.getSchema().set(psamp);
+		std::shared_ptr<CArray<Vec3f>> hVelocity;
+		if (inVelocity != nullptr)
+		{
+			hVelocity = mVelocityStaging.acquire();
+			hVelocity->assign(*inVelocity);
+		}
 
-		host_position.clear();
-		host_mapping.clear();
+		std::shared_ptr<CArray<Real>> hColor;
+		if (inColor != nullptr)
+		{
+			hColor = mColorStaging.acquire();
+			hColor->assign(*inColor);
+		}
 
-		m_output_index++;
+		std::shared_ptr<ParticleArchiveABC> archive = mArchive;
+		this->submit([archive, hPosition, hVelocity, hColor]() {
+			try
+			{
+				archive->write(*hPosition, hVelocity.get(), hColor.get());
+			}
+			catch (std::exception& e)
+			{
+				Log::sendMessage(Log::Error, std::string("Failed to write the Alembic archive: ") + e.what());
+			}
+		});
 	}
 
-	
+
 	DEFINE_CLASS(ParticleWriterABC)
-}
\ No newline at end of file
+}
@@ -20,6 +20,17 @@
 
 namespace dyno
 {
+	class ParticleArchiveABC;
+
+	/**
+	 * @brief Write particles into one Alembic (Ogawa) archive per run, each output frame appends a time sample to the same OPoints.
+	 *	The archive is finalized by finalize(), which SceneGraph::reset() calls, when the frame number goes back, when the file name changes,
+	 *	or when the module is destroyed. An archive is left unreadable if the application exits without any of these.
+	 *	Samples are written on a background thread if Asynchronous is set.
+	 *
+	 *	Color is written as the float vertex parameter "color" instead of the widths of the points,
+	 *	readers that took the color from the widths of earlier archives have to read the parameter instead.
+	 */
 	template<typename TDataType>
 	class ParticleWriterABC : public OutputModule
 	{
@@ -33,13 +44,25 @@ namespace dyno
 
 		void output() override;
 
+	protected:
+		void finalizeImpl() override;
+
 	public:
 		DEF_INSTANCE_IN(PointSet<TDataType>, PointSet, "");
 		DEF_ARRAY_IN(Vec3f, Position, DeviceType::GPU, "");
+		DEF_ARRAY_IN(Vec3f, Velocity, DeviceType::GPU, "");
 		DEF_ARRAY_IN(Real, Color, DeviceType::GPU, "");
 		DEF_VAR(int, Interval, 8.0f, "Output interval frame number");
 	private:
-		int m_output_index = 0;
 		int time_idx = 0;
+
+		//Shared with the pending write tasks, the archive is closed after the last of them
+		std::shared_ptr<ParticleArchiveABC> mArchive;
+		std::string mFileName;
+		uint mFrameNumber = 0;
+
+		StagingPool<Vec3f> mPositionStaging;
+		StagingPool<Vec3f> mVelocityStaging;
+		StagingPool<Real> mColorStaging;
 	};
 }
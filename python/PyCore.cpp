@@ -26,6 +26,13 @@ void pybind_core(py::module& m)
 
 	declare_quat<float>(m, "1f");
 
+	declare_host_array<int>(m, "1i");
+	declare_host_array<uint>(m, "1u");
+	declare_host_array<float>(m, "1f");
+	declare_host_array<dyno::Vec2f>(m, "2f");
+	declare_host_array<dyno::Vec3f>(m, "3f");
+	declare_host_array<dyno::Vec4f>(m, "4f");
+
 	typedef  dyno::Vector<Real, 2> Coord2D;
 	typedef  dyno::Vector<Real, 3> Coord3D;
 	typedef  dyno::SquareMatrix<Real, 3> Matrix3D;
@@ -107,6 +107,67 @@ void declare_quat(py::module& m, std::string typestr) {
 		.def(py::init<Real, const dyno::Vector<Real, 3>&>());
 }
 
+#include "Array/Array.h"
+
+//Scalar type and number of components of the elements of arrays that can be viewed from NumPy
+template<typename T>
+struct PyArrayTraits
+{
+	typedef T Scalar;
+	static constexpr int components = 1;
+	static constexpr bool viewable = std::is_arithmetic<T>::value;
+};
+
+template<typename T, int dim>
+struct PyArrayTraits<dyno::Vector<T, dim>>
+{
+	typedef T Scalar;
+	static constexpr int components = dim;
+	static constexpr bool viewable = std::is_arithmetic<T>::value;
+};
+
+/**
+ * @brief Describe the memory of a host array, vector elements become the second dimension.
+ *	The row stride is taken from the element size since vectors can be padded.
+ */
+template<typename T>
+py::buffer_info host_array_buffer(dyno::CArray<T>& arr)
+{
+	using Scalar = typename PyArrayTraits<T>::Scalar;
+	constexpr int dim = PyArrayTraits<T>::components;
+
+	std::vector<py::ssize_t> shape = { (py::ssize_t)arr.size() };
+	std::vector<py::ssize_t> strides = { (py::ssize_t)sizeof(T) };
+	if (dim > 1)
+	{
+		shape.push_back(dim);
+		strides.push_back(sizeof(Scalar));
+	}
+
+	return py::buffer_info(arr.begin(), sizeof(Scalar), py::format_descriptor<Scalar>::format(), (py::ssize_t)shape.size(), shape, strides);
+}
+
+//A NumPy array sharing the memory of arr, owner is kept alive as long as the view exists. The view is invalidated by resizing arr.
+template<typename T>
+py::array host_array_view(dyno::CArray<T>& arr, py::handle owner)
+{
+	return py::array(host_array_buffer(arr), owner);
+}
+
+template<typename T>
+void declare_host_array(py::module& m, std::string typestr) {
+	using Class = dyno::CArray<T>;
+	std::string pyclass_name = std::string("CArray") + typestr;
+	py::class_<Class, std::shared_ptr<Class>>(m, pyclass_name.c_str(), py::buffer_protocol())
+		.def(py::init<>())
+		.def(py::init<uint>())
+		.def_buffer([](Class& arr) { return host_array_buffer(arr); })
+		.def("size", &Class::size)
+		.def("resize", &Class::resize)
+		.def("reset", &Class::reset)
+		.def("numpy", [](py::object self) { return host_array_view(self.cast<Class&>(), self); }, "View the data without copying, valid until the array is resized");
+}
+
 #include "Primitive/Primitive3D.h"
 
 void pybind_core(py::module& m);
\ No newline at end of file
@@ -684,9 +684,29 @@ void pybind_framework(py::module& m)
 	py::class_<SceneGraph, OBase, std::shared_ptr<SceneGraph>>SG(m, "SceneGraph");
 	SG.def(py::init<>())
 		.def("advance", &SceneGraph::advance)
-		.def("take_one_frame", &SceneGraph::takeOneFrame)
+		.def("take_one_frame", &SceneGraph::takeOneFrame, py::call_guard<py::gil_scoped_release>())
 		.def("update_graphics_context", &SceneGraph::updateGraphicsContext)
 		.def("run", &SceneGraph::run)
+		.def("run", [](SceneGraph& scene, uint frames, py::object callback, std::vector<std::shared_ptr<PyHostMirror>> mirrors) {
+			//Python threads keep running while the frames are simulated, the GIL is only held for the callback
+			for (uint i = 0; i < frames; i++)
+			{
+				{
+					py::gil_scoped_release release;
+					scene.takeOneFrame();
+
+					for (auto& mirror : mirrors)
+						mirror->sync();
+				}
+
+				if (!callback.is_none())
+					callback(scene.getFrameNumber());
+
+				if (PyErr_CheckSignals() != 0)
+					throw py::error_already_set();
+			}
+			}, py::arg("n_frames"), py::arg("callback") = py::none(), py::arg("mirrors") = std::vector<std::shared_ptr<PyHostMirror>>(),
+			"Take n_frames frames, the mirrors are synchronized after each frame before callback(frame_number) is called")
 		.def("bounding_box", &SceneGraph::boundingBox)
 		.def("reset", py::overload_cast<>(&SceneGraph::reset))
 		.def("reset", py::overload_cast<std::shared_ptr<Node>>(&SceneGraph::reset))
@@ -797,6 +817,10 @@ void pybind_framework(py::module& m)
 		.def("is_empty", &dyno::FVar<dyno::PEnum>::isEmpty)
 		.def("get_data_ptr", &dyno::FVar<dyno::PEnum>::getDataPtr);
 
+	py::class_<PyHostMirror, std::shared_ptr<PyHostMirror>>(m, "HostMirror")
+		.def("sync", &PyHostMirror::sync, py::call_guard<py::gil_scoped_release>())
+		.def("commit", &PyHostMirror::commit, py::call_guard<py::gil_scoped_release>());
+
 	declare_array<int, DeviceType::GPU>(m, "1D");
 	declare_array<float, DeviceType::GPU>(m, "1fD");
 	declare_array<Vec3f, DeviceType::GPU>(m, "3fD");
@@ -804,6 +828,10 @@ void pybind_framework(py::module& m)
 	declare_array<dyno::TContactPair<float>, DeviceType::GPU>(m, "TContactPair");
 	declare_array<dyno::Attribute, DeviceType::GPU>(m, "Attribute");
 
+	declare_array<int, DeviceType::CPU>(m, "1H");
+	declare_array<float, DeviceType::CPU>(m, "1fH");
+	declare_array<Vec3f, DeviceType::CPU>(m, "3fH");
+
 	declare_array_list<int, DeviceType::GPU>(m, "1D");
 	declare_array_list<float, DeviceType::GPU>(m, "1fD");
 	declare_array_list<Vec3f, DeviceType::GPU>(m, "3fD");
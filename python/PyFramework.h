@@ -1,5 +1,6 @@
 #pragma once
 #include "PyCommon.h"
+#include "PyCore.h"
 
 #include "Node.h"
 #include "FInstance.h"
@@ -142,14 +143,85 @@ void declare_var(py::module& m, std::string typestr) {
 	//.def("get_data_ptr", &Class::getDataPtr, py::return_value_policy::reference);
 }
 
+/**
+ * @brief Host copy of a device array field, the data is only copied on sync() and commit().
+ */
+class PyHostMirror
+{
+public:
+	virtual ~PyHostMirror() {}
+
+	//Copy the device data to the host
+	virtual void sync() = 0;
+
+	//Copy the host data back to the device
+	virtual void commit() = 0;
+};
+
+template<typename T>
+class PyArrayMirror : public PyHostMirror
+{
+public:
+	PyArrayMirror(dyno::FArray<T, DeviceType::GPU>* field) : mField(field) {}
+
+	void sync() override
+	{
+		//The host buffer is reused as long as the size does not change, NumPy views stay valid
+		if (mField->isEmpty())
+			mHost.resize(0);
+		else
+			mHost.assign(mField->constData());
+	}
+
+	void commit() override
+	{
+		mField->assign(mHost);
+	}
+
+	dyno::CArray<T>& host() { return mHost; }
+
+private:
+	dyno::FArray<T, DeviceType::GPU>* mField;
+	dyno::CArray<T> mHost;
+};
+
+template<typename T>
+void declare_array_mirror(py::module& m, std::string typestr) {
+	using Class = PyArrayMirror<T>;
+	std::string pyclass_name = std::string("ArrayMirror") + typestr;
+	py::class_<Class, PyHostMirror, std::shared_ptr<Class>>(m, pyclass_name.c_str(), py::buffer_protocol())
+		.def(py::init<dyno::FArray<T, DeviceType::GPU>*>(), py::keep_alive<1, 2>())
+		.def_buffer([](Class& mirror) { return host_array_buffer(mirror.host()); })
+		.def("numpy", [](py::object self) { return host_array_view(self.cast<Class&>().host(), self); }, "View the host data without copying, valid until the size changes");
+}
+
 template<typename T, DeviceType deviceType>
 void declare_array(py::module& m, std::string typestr) {
 	using Class = dyno::FArray<T, deviceType>;
 	using Parent = FBase;
 	std::string pyclass_name = std::string("FArray") + typestr;
-	py::class_<Class, Parent, std::shared_ptr<Class>>(m, pyclass_name.c_str(), py::buffer_protocol(), py::dynamic_attr())
+	auto array = py::class_<Class, Parent, std::shared_ptr<Class>>(m, pyclass_name.c_str(), py::buffer_protocol(), py::dynamic_attr())
 		.def(py::init<>())
-		.def("resize", &Class::resize);
+		.def("resize", &Class::resize)
+		.def("size", &Class::size);
+
+	if constexpr (PyArrayTraits<T>::viewable)
+	{
+		if constexpr (deviceType == DeviceType::CPU)
+		{
+			array.def("numpy", [](py::object self) {
+				Class& field = self.cast<Class&>();
+				if (field.isEmpty())
+					field.resize(0);
+				return host_array_view(field.getData(), self);
+				}, "View the data without copying, valid until the field is resized");
+		}
+		else
+		{
+			declare_array_mirror<T>(m, typestr);
+			array.def("host_mirror", [](Class* field) { return std::make_shared<PyArrayMirror<T>>(field); }, py::keep_alive<0, 1>(), "Create a host copy of the field, call sync() to update it");
+		}
+	}
 }
 
 template<typename T, DeviceType deviceType>
@@ -32,8 +32,6 @@ void declare_particle_writer(py::module& m, std::string typestr) {
 	std::string pyclass_name = std::string("ParticleWriter") + typestr;
 	py::class_<Class, Parent, std::shared_ptr<Class>>PW(m, pyclass_name.c_str(), py::buffer_protocol(), py::dynamic_attr());
 	PW.def(py::init<>())
-		.def("output_ascii", &Class::OutputASCII)
-		.def("output_binary", &Class::OutputBinary)
 		.def("output", &Class::output)
 		.def("in_point_set", &Class::inPointSet, py::return_value_policy::reference)
 		.def("var_file_type", &Class::varFileType, py::return_value_policy::reference);
@@ -0,0 +1,105 @@
+#include "HostReduction.h"
+#include "ThreadPool.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace dyno
+{
+	//Number of elements reduced by one task
+	const uint HOST_REDUCTION_CHUNK = 1 << 16;
+
+	template<typename T>
+	inline T hostMaximum(const T& a, const T& b) { return a > b ? a : b; }
+
+	template<typename T>
+	inline T hostMinimum(const T& a, const T& b) { return a < b ? a : b; }
+
+	template<typename T, int N>
+	inline Vector<T, N> hostMaximum(const Vector<T, N>& a, const Vector<T, N>& b) { return a.maximum(b); }
+
+	template<typename T, int N>
+	inline Vector<T, N> hostMinimum(const Vector<T, N>& a, const Vector<T, N>& b) { return a.minimum(b); }
+
+	/**
+	 * @brief Reduce val[0, num) with op, num must be larger than zero
+	 */
+	template<typename T, typename Op>
+	T hostReduce(const T* val, const uint num, Op op)
+	{
+		uint chunkNum = (num + HOST_REDUCTION_CHUNK - 1) / HOST_REDUCTION_CHUNK;
+
+		auto reduceChunk = [=](uint c) {
+			uint last = std::min(num, (c + 1) * HOST_REDUCTION_CHUNK);
+
+			T ret = val[c * HOST_REDUCTION_CHUNK];
+			for (uint i = c * HOST_REDUCTION_CHUNK + 1; i < last; i++)
+				ret = op(ret, val[i]);
+
+			return ret;
+		};
+
+		if (chunkNum == 1)
+			return reduceChunk(0);
+
+		std::vector<T> partial(chunkNum);
+		ThreadPool::instance()->parallelFor(0, chunkNum, [&](uint c) {
+			partial[c] = reduceChunk(c);
+		});
+
+		T ret = partial[0];
+		for (uint c = 1; c < chunkNum; c++)
+			ret = op(ret, partial[c]);
+
+		return ret;
+	}
+
+	template<typename T>
+	HostReduction<T>* HostReduction<T>::Create(const uint n)
+	{
+		return new HostReduction<T>();
+	}
+
+	template<typename T>
+	T HostReduction<T>::accumulate(const T* val, const uint num)
+	{
+		if (num == 0)
+			return T(0);
+
+		return hostReduce(val, num, [](const T& a, const T& b) { return a + b; });
+	}
+
+	template<typename T>
+	T HostReduction<T>::maximum(const T* val, const uint num)
+	{
+		if (num == 0)
+			return T(0);
+
+		return hostReduce(val, num, [](const T& a, const T& b) { return hostMaximum(a, b); });
+	}
+
+	template<typename T>
+	T HostReduction<T>::minimum(const T* val, const uint num)
+	{
+		if (num == 0)
+			return T(0);
+
+		return hostReduce(val, num, [](const T& a, const T& b) { return hostMinimum(a, b); });
+	}
+
+	template<typename T>
+	T HostReduction<T>::average(const T* val, const uint num)
+	{
+		if (num == 0)
+			return T(0);
+
+		return this->accumulate(val, num) / num;
+	}
+
+	template class HostReduction<int>;
+	template class HostReduction<uint>;
+	template class HostReduction<float>;
+	template class HostReduction<double>;
+	template class HostReduction<Vec3f>;
+	template class HostReduction<Vec3d>;
+}
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Vector.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Multithreaded reductions on host memory, mirrors the interface of Reduction.
+	 *	Partial results of chunks are combined in a fixed order, so the results do not depend on the number of threads.
+	 *	Vectors are reduced component-wise.
+	 */
+	template<typename T>
+	class HostReduction
+	{
+	public:
+		HostReduction() {};
+		~HostReduction() {};
+
+		/**
+		 * @brief Kept for compatibility with Reduction, no auxiliary memory has to be allocated in advance
+		 */
+		static HostReduction* Create(const uint n);
+
+		T accumulate(const T* val, const uint num);
+
+		T maximum(const T* val, const uint num);
+
+		T minimum(const T* val, const uint num);
+
+		T average(const T* val, const uint num);
+	};
+}
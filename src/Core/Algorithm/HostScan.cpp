@@ -0,0 +1,94 @@
+#include "HostScan.h"
+#include "ThreadPool.h"
+
+#include <cassert>
+#include <algorithm>
+
+namespace dyno
+{
+	//Number of elements scanned by one task
+	const size_t HOST_SCAN_CHUNK = 1 << 16;
+
+	template<typename T>
+	void HostScan<T>::exclusive(T* output, const T* input, size_t length, bool bcao)
+	{
+		if (length == 0)
+			return;
+
+		uint chunkNum = (uint)((length + HOST_SCAN_CHUNK - 1) / HOST_SCAN_CHUNK);
+
+		//Input and output may alias, each element is read before it is written
+		auto scanChunk = [=](uint c, T sum) {
+			size_t last = std::min(length, (c + 1) * HOST_SCAN_CHUNK);
+			for (size_t i = c * HOST_SCAN_CHUNK; i < last; i++)
+			{
+				T val = input[i];
+				output[i] = sum;
+				sum += val;
+			}
+		};
+
+		//The two passes only pay off if they run in parallel
+		ThreadPool* pool = ThreadPool::instance();
+		if (chunkNum == 1 || pool->size() == 0)
+		{
+			T sum = T(0);
+			for (size_t i = 0; i < length; i++)
+			{
+				T val = input[i];
+				output[i] = sum;
+				sum += val;
+			}
+
+			return;
+		}
+
+		mSums.resize(chunkNum);
+
+		pool->parallelFor(0, chunkNum, [&](uint c) {
+			size_t last = std::min(length, (c + 1) * HOST_SCAN_CHUNK);
+
+			T sum = T(0);
+			for (size_t i = c * HOST_SCAN_CHUNK; i < last; i++)
+				sum += input[i];
+
+			mSums[c] = sum;
+		});
+
+		T total = T(0);
+		for (uint c = 0; c < chunkNum; c++)
+		{
+			T val = mSums[c];
+			mSums[c] = total;
+			total += val;
+		}
+
+		pool->parallelFor(0, chunkNum, [&](uint c) {
+			scanChunk(c, mSums[c]);
+		});
+	}
+
+	template<typename T>
+	void HostScan<T>::exclusive(T* data, size_t length, bool bcao)
+	{
+		this->exclusive(data, data, length, bcao);
+	}
+
+	template<typename T>
+	void HostScan<T>::exclusive(CArray<T>& output, const CArray<T>& input, bool bcao)
+	{
+		assert(input.size() == output.size());
+
+		this->exclusive(output.begin(), input.begin(), input.size(), bcao);
+	}
+
+	template<typename T>
+	void HostScan<T>::exclusive(CArray<T>& data, bool bcao)
+	{
+		this->exclusive(data.begin(), data.begin(), data.size(), bcao);
+	}
+
+	template class HostScan<int>;
+	template class HostScan<uint>;
+	template class HostScan<uint64>;
+}
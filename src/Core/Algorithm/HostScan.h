@@ -0,0 +1,46 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+
+#include <vector>
+
+namespace dyno
+{
+	/**
+	 * @brief Multithreaded exclusive prefix sums on host memory, mirrors the interface of Scan.
+	 *	The input is split into chunks, chunk sums are computed in parallel, scanned serially and then added back while scanning each chunk.
+	 */
+	template<typename T>
+	class HostScan
+	{
+	public:
+		HostScan() {};
+		~HostScan() {};
+
+		/**
+		 * @param bcao ignored, kept for compatibility with Scan
+		 */
+		void exclusive(T* output, const T* input, size_t length, bool bcao = true);
+		void exclusive(T* data, size_t length, bool bcao = true);
+
+		void exclusive(CArray<T>& output, const CArray<T>& input, bool bcao = true);
+		void exclusive(CArray<T>& data, bool bcao = true);
+
+	private:
+		std::vector<T> mSums;
+	};
+}
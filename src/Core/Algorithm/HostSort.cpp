@@ -0,0 +1,114 @@
+#include "HostSort.h"
+#include "ThreadPool.h"
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+namespace dyno
+{
+	const uint HOST_SORT_RADIX_BITS = 8;
+	const uint HOST_SORT_BUCKETS = 1 << HOST_SORT_RADIX_BITS;
+
+	//Number of keys handled by one task
+	const uint HOST_SORT_CHUNK = 1 << 16;
+
+	template<typename Key>
+	void HostSort<Key>::sort(Key* keys, const uint num)
+	{
+		this->radixSort(keys, nullptr, num);
+	}
+
+	template<typename Key>
+	void HostSort<Key>::sort(CArray<Key>& keys)
+	{
+		this->radixSort(keys.begin(), nullptr, keys.size());
+	}
+
+	template<typename Key>
+	void HostSort<Key>::sortByKey(Key* keys, uint* ids, const uint num)
+	{
+		this->radixSort(keys, ids, num);
+	}
+
+	template<typename Key>
+	void HostSort<Key>::radixSort(Key* keys, uint* ids, const uint num)
+	{
+		if (num < 2)
+			return;
+
+		uint chunkNum = (num + HOST_SORT_CHUNK - 1) / HOST_SORT_CHUNK;
+
+		mKeys.resize(num);
+		if (ids != nullptr)
+			mIds.resize(num);
+
+		mHistogram.resize(chunkNum * HOST_SORT_BUCKETS);
+
+		Key* srcKeys = keys;
+		Key* dstKeys = mKeys.data();
+
+		uint* srcIds = ids;
+		uint* dstIds = ids != nullptr ? mIds.data() : nullptr;
+
+		ThreadPool* pool = ThreadPool::instance();
+		for (uint shift = 0; shift < 8 * sizeof(Key); shift += HOST_SORT_RADIX_BITS)
+		{
+			pool->parallelFor(0, chunkNum, [&](uint c) {
+				uint* hist = mHistogram.data() + c * HOST_SORT_BUCKETS;
+				memset(hist, 0, HOST_SORT_BUCKETS * sizeof(uint));
+
+				uint last = std::min(num, (c + 1) * HOST_SORT_CHUNK);
+				for (uint i = c * HOST_SORT_CHUNK; i < last; i++)
+					hist[(srcKeys[i] >> shift) & (HOST_SORT_BUCKETS - 1)]++;
+			});
+
+			//Turn the counts into the first destination of each digit within each chunk
+			uint offset = 0;
+			bool trivial = false;
+			for (uint d = 0; d < HOST_SORT_BUCKETS; d++)
+			{
+				uint count = 0;
+				for (uint c = 0; c < chunkNum; c++)
+				{
+					uint& h = mHistogram[c * HOST_SORT_BUCKETS + d];
+					uint n = h;
+					h = offset;
+					offset += n;
+					count += n;
+				}
+
+				trivial = trivial || count == num;
+			}
+
+			if (trivial)
+				continue;
+
+			pool->parallelFor(0, chunkNum, [&](uint c) {
+				uint* hist = mHistogram.data() + c * HOST_SORT_BUCKETS;
+
+				uint last = std::min(num, (c + 1) * HOST_SORT_CHUNK);
+				for (uint i = c * HOST_SORT_CHUNK; i < last; i++)
+				{
+					uint dst = hist[(srcKeys[i] >> shift) & (HOST_SORT_BUCKETS - 1)]++;
+					dstKeys[dst] = srcKeys[i];
+					if (srcIds != nullptr)
+						dstIds[dst] = srcIds[i];
+				}
+			});
+
+			std::swap(srcKeys, dstKeys);
+			std::swap(srcIds, dstIds);
+		}
+
+		if (srcKeys != keys)
+		{
+			memcpy(keys, srcKeys, num * sizeof(Key));
+			if (ids != nullptr)
+				memcpy(ids, srcIds, num * sizeof(uint));
+		}
+	}
+
+	template class HostSort<uint>;
+	template class HostSort<uint64>;
+}
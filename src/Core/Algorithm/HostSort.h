@@ -0,0 +1,77 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+
+#include <vector>
+
+namespace dyno
+{
+	/**
+	 * @brief Multithreaded LSD radix sort for unsigned 32-bit and 64-bit keys on host memory.
+	 *
+	 *	Keys are sorted in ascending order, 8 bits per pass. Each pass counts digits per chunk in parallel
+	 *	and scatters the chunks in parallel into their precomputed ranges, so the sort is stable.
+	 *	Passes in which all keys share the same digit are skipped.
+	 */
+	template<typename Key>
+	class HostSort
+	{
+	public:
+		HostSort() {};
+		~HostSort() {};
+
+		void sort(Key* keys, const uint num);
+		void sort(CArray<Key>& keys);
+
+		/**
+		 * @brief Sort keys and apply the same permutation to ids
+		 */
+		void sortByKey(Key* keys, uint* ids, const uint num);
+
+		/**
+		 * @brief Sort keys and apply the same permutation to values, values are moved once after the keys are sorted
+		 */
+		template<typename Value>
+		void sortByKey(Key* keys, Value* values, const uint num)
+		{
+			mOrder.resize(num);
+			for (uint i = 0; i < num; i++)
+				mOrder[i] = i;
+
+			this->sortByKey(keys, mOrder.data(), num);
+
+			std::vector<Value> buffer(values, values + num);
+			for (uint i = 0; i < num; i++)
+				values[i] = buffer[mOrder[i]];
+		}
+
+		template<typename Value>
+		void sortByKey(CArray<Key>& keys, CArray<Value>& values)
+		{
+			this->sortByKey(keys.begin(), values.begin(), keys.size());
+		}
+
+	private:
+		void radixSort(Key* keys, uint* ids, const uint num);
+
+		std::vector<Key> mKeys;
+		std::vector<uint> mIds;
+		std::vector<uint> mOrder;
+
+		std::vector<uint> mHistogram;
+	};
+}
@@ -23,6 +23,23 @@
 
 namespace dyno {
 
+	/**
+	 * @brief Return the smallest power of two that is not less than n, n must be in [1, 2^31]
+	 */
+	inline uint nextPowerOfTwo(uint n)
+	{
+		assert(n > 0 && n <= (1u << 31));
+
+		n--;
+		n |= n >> 1;
+		n |= n >> 2;
+		n |= n >> 4;
+		n |= n >> 8;
+		n |= n >> 16;
+
+		return n + 1;
+	}
+
 	template<typename T, DeviceType deviceType> class Array;
 
 	template<typename T>
@@ -77,9 +94,12 @@ namespace dyno {
 		void assign(const T& val);
 		void assign(uint num, const T& val);
 
-	#ifndef NO_BACKEND
 		void assign(const Array<T, DeviceType::GPU>& src);
-	#endif
+
+		/**
+		 * @brief Download count elements of src starting from srcOffset into this array starting from dstOffset, no resize is done
+		 */
+		void assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
 
 		void assign(const Array<T, DeviceType::CPU>& src);
 		void assign(const std::vector<T>& src);
@@ -156,4 +176,8 @@ namespace dyno {
 
 #ifdef VK_BACKEND
 	#include "Backend/Vulkan/Array/Array.inl"
+#endif
+
+#ifdef NO_BACKEND
+	#include "Backend/CPU/Array/Array.inl"
 #endif
\ No newline at end of file
@@ -79,9 +79,13 @@ namespace dyno {
 		inline bool isCPU() const { return false; }
 		inline bool isGPU() const { return true; }
 
-#ifndef NO_BACKEND
 		void assign(const Array2D<T, DeviceType::GPU>& src);
-#endif
+
+		/**
+		 * @brief Download rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 *	Both arrays must share the same nx.
+		 */
+		void assign(const Array2D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
 
 		void assign(const Array2D<T, DeviceType::CPU>& src);
 
@@ -138,3 +142,7 @@ namespace dyno {
 #ifdef VK_BACKEND
 #include "Backend/Vulkan/Array/Array2D.inl"
 #endif
+
+#ifdef NO_BACKEND
+#include "Backend/CPU/Array/Array2D.inl"
+#endif
@@ -68,9 +68,13 @@ namespace dyno {
 		void assign(const T& val);
 		void assign(uint nx, uint ny, uint nz, const T& val);
 
-#ifndef NO_BACKEND
 		void assign(const Array3D<T, DeviceType::GPU>& src);
-#endif
+
+		/**
+		 * @brief Download rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 *	Row j of slice k is numbered j + k * ny, both arrays must share the same nx.
+		 */
+		void assign(const Array3D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
 
 		void assign(const Array3D<T, DeviceType::CPU>& src);
 
@@ -142,4 +146,8 @@ namespace dyno {
 
 #ifdef VK_BACKEND
 #include "Backend/Vulkan/Array/Array3D.inl"
+#endif
+
+#ifdef NO_BACKEND
+#include "Backend/CPU/Array/Array3D.inl"
 #endif
\ No newline at end of file
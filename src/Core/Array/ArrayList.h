@@ -23,6 +23,41 @@
 #include "Array/Array.h"
 
 namespace dyno {
+	/**
+	 * @brief A compressed sparse row view of an ArrayList, list i occupies elements [offsets[i], offsets[i + 1]).
+	 *	The view holds raw pointers only, it can be passed to kernels by value and becomes invalid once the ArrayList is rebuilt.
+	 */
+	template<typename T>
+	class CSRView
+	{
+	public:
+		DYN_FUNC CSRView() {};
+
+		DYN_FUNC CSRView(const uint* offsets, T* elements, uint listNum, uint elementNum)
+			: mOffsets(offsets), mElements(elements), mListNum(listNum), mElementNum(elementNum) {};
+
+		DYN_FUNC inline uint size() const { return mListNum; }
+		DYN_FUNC inline uint elementSize() const { return mElementNum; }
+
+		DYN_FUNC inline uint offset(uint i) const {
+			return i + 1 == mListNum ? mElementNum : mOffsets[i + 1];
+		}
+
+		DYN_FUNC inline uint size(uint i) const { return offset(i) - mOffsets[i]; }
+
+		DYN_FUNC inline T* begin(uint i) const { return mElements + mOffsets[i]; }
+		DYN_FUNC inline T* end(uint i) const { return mElements + offset(i); }
+
+		DYN_FUNC inline T& operator () (uint i, uint j) const { return mElements[mOffsets[i] + j]; }
+
+	private:
+		const uint* mOffsets = nullptr;
+		T* mElements = nullptr;
+
+		uint mListNum = 0;
+		uint mElementNum = 0;
+	};
+
 	template<class ElementType, DeviceType deviceType> class ArrayList;
 
 	template<class ElementType>
@@ -44,7 +79,22 @@ namespace dyno {
 		bool resize(const CArray<uint>& counts);
 		bool resize(const uint arraySize, const uint eleSize);
 
-		inline uint size() const { return mLists.size(); }
+		/**
+		 * @brief Rebuild the offsets from counts without the per-list List headers, the elements are accessed through csr().
+		 *	Buffers keep their capacity, rebuilding with similar counts every frame does not allocate.
+		 */
+		bool rebuild(const CArray<uint>& counts);
+
+		inline CSRView<ElementType> csr() {
+			return CSRView<ElementType>(mIndex.begin(), mElements.begin(), mIndex.size(), mElements.size());
+		}
+
+		/**
+		 * @brief Return false if the list was rebuilt by rebuild(), operator[] is not available then
+		 */
+		inline bool hasLists() const { return mLists.size() == mIndex.size(); }
+
+		inline uint size() const { return mIndex.size(); }
 		uint elementSize();
 
 		uint size(uint id)
@@ -64,20 +114,18 @@ namespace dyno {
 
 		inline bool isCPU() const { return true; }
 		inline bool isGPU() const { return false; }
-		inline bool isEmpty() const { return mLists.empty(); }
+		inline bool isEmpty() const { return mIndex.isEmpty(); }
 
 		void clear();
 
 		void assign(const ArrayList<ElementType, DeviceType::CPU>& src);
 
-	#ifndef NO_BACKEND
 		void assign(const ArrayList<ElementType, DeviceType::GPU>& src);
-	#endif
 
 		friend std::ostream& operator<<(std::ostream &out, const ArrayList<ElementType, DeviceType::CPU>& aList)
 		{
 			out << std::endl;
-			for (uint i = 0; i < aList.size(); i++)
+			for (uint i = 0; i < aList.mLists.size(); i++)
 			{
 				List<ElementType> lst = aList[i];
 				out << "List " << i << " (" << lst.size() << "):";
@@ -100,6 +148,8 @@ namespace dyno {
 		ArrayList<ElementType, DeviceType::CPU>& operator=(const ArrayList<ElementType, DeviceType::CPU> &) = delete;
 
 	private:
+		void rebuildIndex(const CArray<uint>& counts);
+
 		CArray<uint> mIndex;
 		CArray<ElementType> mElements;
 
@@ -126,31 +176,41 @@ namespace dyno {
 	}
 
 	template<class ElementType>
-	bool ArrayList<ElementType, DeviceType::CPU>::resize(const CArray<uint>& counts)
+	void ArrayList<ElementType, DeviceType::CPU>::rebuildIndex(const CArray<uint>& counts)
 	{
 		assert(counts.size() > 0);
 
-		if (mIndex.size() != counts.size())
-		{
-			mIndex.resize(counts.size());
-			mLists.resize(counts.size());
-		}
-
-		mIndex.assign(counts);
+		mIndex.resize(counts.size());
 
 		uint total_num = 0;
 		for (uint i = 0; i < mIndex.size(); i++)
 		{
-			uint num = mIndex[i];
-			
 			//exclusive scan
-			mIndex[i] = total_num;	
+			mIndex[i] = total_num;
 
 			//summation
-			total_num += num;
+			total_num += counts[i];
 		}
 
 		mElements.resize(total_num);
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::CPU>::rebuild(const CArray<uint>& counts)
+	{
+		this->rebuildIndex(counts);
+
+		mLists.clear();
+
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::CPU>::resize(const CArray<uint>& counts)
+	{
+		this->rebuildIndex(counts);
+
+		mLists.resize(counts.size());
 
 		//initialize all lists.
 		for (uint i = 0; i < mLists.size(); i++)
@@ -197,7 +257,7 @@ namespace dyno {
 		mLists.assign(src.lists());
 
 		//redirect the element address
-		for (uint i = 0; i < src.size(); i++)
+		for (uint i = 0; i < mLists.size(); i++)
 		{
 			mLists[i].reserve(mElements.begin() + mIndex[i], mLists[i].size());
 		}
@@ -214,3 +274,7 @@ namespace dyno {
 #ifdef VK_BACKEND
 	#include "Backend/Vulkan/Array/ArrayList.inl"
 #endif
+
+#ifdef NO_BACKEND
+	#include "Backend/CPU/Array/ArrayList.inl"
+#endif
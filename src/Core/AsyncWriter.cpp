@@ -0,0 +1,71 @@
+#include "AsyncWriter.h"
+
+namespace dyno
+{
+	AsyncWriter::AsyncWriter(uint capacity)
+		: mCapacity(std::max(capacity, 1u))
+	{
+		mThread = std::thread(&AsyncWriter::run, this);
+	}
+
+	AsyncWriter::~AsyncWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mRunning = false;
+		}
+		mNotEmpty.notify_all();
+
+		if (mThread.joinable())
+			mThread.join();
+	}
+
+	void AsyncWriter::push(Task task)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mNotFull.wait(lock, [&]() { return mTasks.size() < mCapacity; });
+
+			mTasks.push_back(std::move(task));
+		}
+		mNotEmpty.notify_one();
+	}
+
+	void AsyncWriter::flush()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		mIdle.wait(lock, [&]() { return mTasks.empty() && !mBusy; });
+	}
+
+	void AsyncWriter::run()
+	{
+		while (true)
+		{
+			Task task;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mNotEmpty.wait(lock, [&]() { return !mTasks.empty() || !mRunning; });
+
+				// Pending tasks are still executed after the writer is asked to stop
+				if (mTasks.empty())
+					break;
+
+				task = std::move(mTasks.front());
+				mTasks.pop_front();
+				mBusy = true;
+			}
+			mNotFull.notify_one();
+
+			task();
+
+			// Release whatever the task holds, e.g. staging buffers, before reporting idle
+			task = nullptr;
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mBusy = false;
+			}
+			mIdle.notify_all();
+		}
+	}
+}
@@ -0,0 +1,141 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Platform.h"
+#include "Array/Array.h"
+
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+
+namespace dyno
+{
+	/**
+	 * @brief A background thread executing tasks in submission order, mainly used to write files.
+	 *	The queue is bounded, push() blocks while it is full so that producers can not run arbitrarily far ahead.
+	 */
+	class AsyncWriter
+	{
+	public:
+		typedef std::function<void()> Task;
+
+		/**
+		 * @param capacity maximum number of pending tasks, not counting the one being executed
+		 */
+		explicit AsyncWriter(uint capacity = 2);
+
+		/**
+		 * @brief Finish all pending tasks before the thread exits
+		 */
+		~AsyncWriter();
+
+		AsyncWriter(const AsyncWriter&) = delete;
+		AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+		void push(Task task);
+
+		/**
+		 * @brief Block until all submitted tasks are finished
+		 */
+		void flush();
+
+		uint capacity() const { return mCapacity; }
+
+	private:
+		void run();
+
+	private:
+		uint mCapacity;
+
+		bool mRunning = true;
+		bool mBusy = false;
+
+		std::deque<Task> mTasks;
+
+		std::mutex mMutex;
+		std::condition_variable mNotEmpty;
+		std::condition_variable mNotFull;
+		std::condition_variable mIdle;
+
+		std::thread mThread;
+	};
+
+	/**
+	 * @brief A fixed number of reusable host buffers, used to snapshot data handed over to another thread.
+	 *	acquire() blocks while all buffers are in use, a buffer returns to the pool once the last reference is released.
+	 *	Released buffers keep their memory, so snapshots of the same size do not allocate.
+	 */
+	template<typename T>
+	class StagingPool
+	{
+	public:
+		explicit StagingPool(uint capacity = 2)
+			: mState(std::make_shared<State>())
+		{
+			mState->capacity = std::max(capacity, 1u);
+		}
+
+		std::shared_ptr<CArray<T>> acquire()
+		{
+			// Buffers may be released after the pool is destroyed, so they hold the shared state instead of the pool
+			std::shared_ptr<State> state = mState;
+
+			std::unique_lock<std::mutex> lock(state->mtx);
+			state->released.wait(lock, [&]() { return !state->buffers.empty() || state->allocated < state->capacity; });
+
+			CArray<T>* buffer = nullptr;
+			if (!state->buffers.empty())
+			{
+				buffer = state->buffers.back().release();
+				state->buffers.pop_back();
+			}
+			else
+			{
+				buffer = new CArray<T>();
+				state->allocated++;
+			}
+
+			return std::shared_ptr<CArray<T>>(buffer, [state](CArray<T>* buf) {
+				{
+					std::lock_guard<std::mutex> guard(state->mtx);
+					state->buffers.emplace_back(buf);
+				}
+				state->released.notify_one();
+			});
+		}
+
+		uint capacity() const { return mState->capacity; }
+
+	private:
+		struct State
+		{
+			std::mutex mtx;
+			std::condition_variable released;
+
+			std::vector<std::unique_ptr<CArray<T>>> buffers;
+
+			uint capacity = 2;
+			uint allocated = 0;
+		};
+
+		std::shared_ptr<State> mState;
+	};
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "Algorithm/Functional.h"
+#include "Algorithm/CudaRand.h"
+
+#include "Algorithm/Function2Pt.h"
+#include "Algorithm/Reduction.h"
+#include "Algorithm/Arithmetic.h"
+#include "Algorithm/Scan.h"
@@ -0,0 +1,37 @@
+#pragma once
+#include "Array/Array.h"
+
+namespace dyno 
+{
+	/**
+	 * @brief Arithmetic of the host backend, the dot product is accumulated in one pass over the host memory
+	 */
+	template<typename T>
+	class Arithmetic
+	{
+	public:
+		Arithmetic(const Arithmetic &) = delete;
+		Arithmetic& operator=(const Arithmetic &) = delete;
+
+		static Arithmetic* Create(int n) { return new Arithmetic(n); }
+		
+		T Dot(DArray<T>& xArr, DArray<T>& yArr)
+		{
+			assert(xArr.size() == yArr.size());
+
+			T* x = xArr.begin();
+			T* y = yArr.begin();
+
+			T sum = T(0);
+			for (uint i = 0; i < xArr.size(); i++)
+				sum += x[i] * y[i];
+
+			return sum;
+		}
+		
+		~Arithmetic() {};
+	private:
+		Arithmetic(int n) {};
+	};
+
+}
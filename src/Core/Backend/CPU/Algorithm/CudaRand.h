@@ -0,0 +1,40 @@
+#pragma once
+#include "Platform.h"
+
+#include <cstdint>
+
+namespace dyno {
+
+#define DIV 10000
+
+	/**
+	 * @brief Host counterpart of the curand based generator, a xorshift generator seeded by a splitmix of the seed
+	 */
+	class RandNumber
+	{
+	public:
+		DYN_FUNC RandNumber(int seed)
+		{
+			uint64_t z = uint64_t(seed) + 0x9E3779B97F4A7C15ull;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			s = uint32_t(z ^ (z >> 31));
+			if (s == 0) s = 0x9E3779B9u;
+		}
+		DYN_FUNC ~RandNumber() {};
+
+		/*!
+		*	\brief	Generate a float number in (0, 1], the same range as curand_uniform.
+		*/
+		DYN_FUNC float Generate()
+		{
+			s ^= s << 13;
+			s ^= s >> 17;
+			s ^= s << 5;
+			return float((s >> 8) + 1) / float(1 << 24);
+		}
+
+	private:
+		uint32_t s;
+	};
+}
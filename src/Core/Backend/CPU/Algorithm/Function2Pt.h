@@ -0,0 +1,60 @@
+#pragma once
+#include "Array/Array.h"
+#include "Algorithm/Functional.h"
+
+/*
+*  Two-point functions of the host backend, device arrays live in host memory so the loops run on them directly
+*/
+
+namespace dyno
+{
+	namespace Function2Pt
+	{
+		template <typename T, typename Function>
+		void twoPointFunc(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr, Function func)
+		{
+			assert(zArr.size() == xArr.size() && zArr.size() == yArr.size());
+
+			T* z = zArr.begin();
+			T* x = xArr.begin();
+			T* y = yArr.begin();
+			for (uint i = 0; i < zArr.size(); i++)
+				z[i] = func(x[i], y[i]);
+		}
+
+		// z = x + y;
+		template <typename T>
+		void plus(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr)
+		{
+			twoPointFunc(zArr, xArr, yArr, PlusFunc<T>());
+		}
+
+		// z = x - y;
+		template <typename T>
+		void subtract(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr)
+		{
+			twoPointFunc(zArr, xArr, yArr, MinusFunc<T>());
+		}
+
+		// z = x * y;
+		template <typename T>
+		void multiply(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr)
+		{
+			twoPointFunc(zArr, xArr, yArr, MultiplyFunc<T>());
+		}
+
+		// z = x / y;
+		template <typename T>
+		void divide(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr)
+		{
+			twoPointFunc(zArr, xArr, yArr, DivideFunc<T>());
+		}
+
+		// z = a * x + y;
+		template <typename T>
+		void saxpy(DArray<T>& zArr, DArray<T>& xArr, DArray<T>& yArr, T alpha)
+		{
+			twoPointFunc(zArr, xArr, yArr, [alpha](const T x, const T y) { return alpha * x + y; });
+		}
+	};
+}
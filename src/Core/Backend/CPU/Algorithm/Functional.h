@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief The functors are plain DYN_FUNC structs, the host backend shares them with the Cuda backend
+ */
+#include "../../Cuda/Algorithm/Functional.h"
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Vector.h"
+#include "Algorithm/HostReduction.h"
+
+namespace dyno {
+
+	/**
+	 * @brief Reduction of the host backend, device arrays live in host memory so HostReduction is used directly
+	 */
+	template<typename T>
+	class Reduction : public HostReduction<T>
+	{
+	public:
+		Reduction() {};
+		~Reduction() {};
+
+		static Reduction* Create(const uint n) { return new Reduction(); }
+	};
+}
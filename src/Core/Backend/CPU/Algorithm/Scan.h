@@ -0,0 +1,32 @@
+#pragma once
+#include "Array/Array.h"
+#include "Algorithm/HostScan.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Scan of the host backend, device arrays live in host memory so HostScan is used directly
+	 */
+	template<typename T>
+	class Scan : public HostScan<T>
+	{
+	public:
+		Scan() {};
+		~Scan() {};
+
+		using HostScan<T>::exclusive;
+
+		void exclusive(DArray<T>& output, DArray<T>& input, bool bcao = true)
+		{
+			if (output.size() != input.size())
+				output.resize(input.size());
+
+			HostScan<T>::exclusive(output.begin(), input.begin(), input.size(), bcao);
+		}
+
+		void exclusive(DArray<T>& data, bool bcao = true)
+		{
+			HostScan<T>::exclusive(data.begin(), data.size(), bcao);
+		}
+	};
+}
@@ -0,0 +1,240 @@
+#include "HostMemoryPool.h"
+
+#include <cstring>
+
+namespace dyno 
+{
+	template<typename T>
+	void Array<T, DeviceType::CPU>::assign(const Array<T, DeviceType::GPU>& src)
+	{
+		if (mData.size() != src.size())
+			this->resize(src.size());
+
+		memcpy(this->begin(), src.begin(), src.size() * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::CPU>::assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		memcpy(this->begin() + dstOffset, src.begin() + srcOffset, count * sizeof(T));
+	}
+
+	/*!
+	*	\class	Array
+	*	\brief	Host implementation of the device array, the buffer comes from the HostMemoryPool and can be passed to kernels launched by cuExecute as parameters.
+	*/
+	template<typename T>
+	class Array<T, DeviceType::GPU>
+	{
+	public:
+		Array()
+		{
+		};
+
+		Array(uint num)
+		{
+			this->resize(num);
+		}
+
+		/*!
+		*	\brief	Do not release memory here, call clear() explicitly.
+		*/
+		~Array() {};
+
+		/*!
+		*	\brief	Resize the array, the content is not preserved when the buffer is reallocated.
+		*			The buffer is released if n drops to half of the capacity, pass shrink = false to keep it for later reuse.
+		*/
+		void resize(const uint n, const bool shrink = true);
+
+		/*!
+		*	\brief	Grow the buffer to hold at least n elements, the existing elements are kept.
+		*/
+		void reserve(const uint n);
+
+		/*!
+		*	\brief	Clear all data to zero.
+		*/
+		void reset();
+
+		/*!
+		*	\brief	Free allocated memory.	Should be called before the object is deleted.
+		*/
+		void clear();
+
+		DYN_FUNC inline const T*	begin() const { return mData; }
+		DYN_FUNC inline T*	begin() { return mData; }
+
+		DeviceType	deviceType() { return DeviceType::GPU; }
+
+		GPU_FUNC inline T& operator [] (unsigned int id) {
+			return mData[id];
+		}
+
+		GPU_FUNC inline T& operator [] (unsigned int id) const {
+			return mData[id];
+		}
+
+		DYN_FUNC inline uint size() const { return mTotalNum; }
+		DYN_FUNC inline uint capacity() const { return mBufferNum; }
+		DYN_FUNC inline bool isCPU() const { return false; }
+		DYN_FUNC inline bool isGPU() const { return true; }
+		DYN_FUNC inline bool isEmpty() const { return mData == nullptr; }
+
+		void assign(const Array<T, DeviceType::GPU>& src);
+		void assign(const Array<T, DeviceType::CPU>& src);
+		void assign(const std::vector<T>& src);
+
+		void assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
+		void assign(const Array<T, DeviceType::CPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
+		void assign(const std::vector<T>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
+
+		/*!
+		*	\brief	Append count elements of src starting from srcOffset to the end of this array.
+		*			The buffer grows geometrically, so the cost is proportional to count as long as no reallocation happens.
+		*/
+		void append(const Array<T, DeviceType::GPU>& src, const uint count, const uint srcOffset = 0);
+
+		friend std::ostream& operator<<(std::ostream &out, const Array<T, DeviceType::GPU>& dArray)
+		{
+			Array<T, DeviceType::CPU> hArray;
+			hArray.assign(dArray);
+
+			out << hArray;
+
+			return out;
+		}
+
+	private:
+		T* mData = nullptr;
+		uint mTotalNum = 0;
+		uint mBufferNum = 0;
+	};
+	
+	template<typename T>
+	using DArray = Array<T, DeviceType::GPU>;
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::resize(const uint n, const bool shrink)
+	{
+		if (mTotalNum == n) return;
+
+		if (n == 0) {
+			clear();
+			return;
+		}
+
+		uint bound = nextPowerOfTwo(n);
+
+		if (n > mBufferNum || (shrink && n <= mBufferNum / 2)) {
+			clear();
+
+			mTotalNum = n; 	
+			mBufferNum = bound;
+
+			mData = (T*)HostMemoryPool::instance()->allocate(bound * sizeof(T));
+		}
+		else
+			mTotalNum = n;
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::reserve(const uint n)
+	{
+		if (n <= mBufferNum) return;
+
+		uint bound = nextPowerOfTwo(n);
+
+		T* data = (T*)HostMemoryPool::instance()->allocate(bound * sizeof(T));
+
+		if (mTotalNum > 0)
+		{
+			memcpy(data, mData, mTotalNum * sizeof(T));
+		}
+
+		if (mData != nullptr)
+		{
+			HostMemoryPool::instance()->deallocate((void*)mData, mBufferNum * sizeof(T));
+		}
+
+		mData = data;
+		mBufferNum = bound;
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::clear()
+	{
+		if (mData != nullptr)
+		{
+			HostMemoryPool::instance()->deallocate((void*)mData, mBufferNum * sizeof(T));
+		}
+
+		mData = nullptr;
+		mTotalNum = 0;
+		mBufferNum = 0;
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::reset()
+	{
+		memset((void*)mData, 0, mTotalNum * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const Array<T, DeviceType::GPU>& src)
+	{
+		if (mTotalNum != src.size())
+			this->resize(src.size());
+
+		memcpy(mData, src.begin(), src.size() * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const Array<T, DeviceType::CPU>& src)
+	{
+		if (mTotalNum != src.size())
+			this->resize(src.size());
+
+		memcpy(mData, src.begin(), src.size() * sizeof(T));
+	}
+
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const std::vector<T>& src)
+	{
+		if (mTotalNum != src.size())
+			this->resize((uint)src.size());
+
+		memcpy(mData, src.data(), src.size() * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const std::vector<T>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		memcpy(mData + dstOffset, src.data() + srcOffset, count * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const Array<T, DeviceType::CPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		memcpy(mData + dstOffset, src.begin() + srcOffset, count * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		memcpy(mData + dstOffset, src.begin() + srcOffset, count * sizeof(T));
+	}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::append(const Array<T, DeviceType::GPU>& src, const uint count, const uint srcOffset)
+	{
+		if (count == 0) return;
+
+		uint num = mTotalNum;
+		this->reserve(num + count);
+		mTotalNum = num + count;
+
+		memcpy(mData + num, src.begin() + srcOffset, count * sizeof(T));
+	}
+}
\ No newline at end of file
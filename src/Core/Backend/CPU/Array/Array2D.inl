@@ -0,0 +1,163 @@
+#include "HostMemoryPool.h"
+
+#include <cstring>
+
+namespace dyno {
+
+	template<typename T>
+	void Array2D<T, DeviceType::CPU>::assign(const Array2D<T, DeviceType::GPU>& src)
+	{
+		if (m_nx != src.size() || m_ny != src.size()) {
+			this->resize(src.nx(), src.ny());
+		}
+
+		memcpy(m_data.data(), src.begin(), sizeof(T) * src.size());
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::CPU>::assign(const Array2D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		memcpy(m_data.data() + (size_t)dstRow * m_nx, src.begin() + (size_t)srcRow * src.nx(), sizeof(T) * src.nx() * rowNum);
+	}
+
+	template<typename T>
+	class Array2D<T, DeviceType::GPU>
+	{
+	public:
+		Array2D() {};
+
+		Array2D(uint nx, uint ny)
+		{
+			this->resize(nx, ny);
+		};
+
+		/*!
+		*	\brief	Should not release data here, call Release() explicitly.
+		*/
+		~Array2D() {};
+
+		void resize(uint nx, uint ny);
+
+		void reset();
+
+		void clear();
+
+		inline T* begin() const { return m_data; }
+
+		DYN_FUNC inline uint nx() const { return m_nx; }
+		DYN_FUNC inline uint ny() const { return m_ny; }
+		DYN_FUNC inline uint pitch() const { return m_pitch; }
+
+		GPU_FUNC inline T operator () (const uint i, const uint j) const
+		{
+			char* addr = (char*)m_data;
+			addr += j * m_pitch;
+
+			return ((T*)addr)[i];
+			//return m_data[i + j* m_pitch];
+		}
+
+		GPU_FUNC inline T& operator () (const uint i, const uint j)
+		{
+			char* addr = (char*)m_data;
+			addr += j * m_pitch;
+
+			return ((T*)addr)[i];
+
+			//return m_data[i + j* m_pitch];
+		}
+
+		DYN_FUNC inline int index(const uint i, const uint j) const
+		{
+			return i + j * m_nx;
+		}
+
+		GPU_FUNC inline T operator [] (const uint id) const
+		{
+			return m_data[id];
+		}
+
+		GPU_FUNC inline T& operator [] (const uint id)
+		{
+			return m_data[id];
+		}
+
+		DYN_FUNC inline uint size() const { return m_nx * m_ny; }
+		DYN_FUNC inline bool isCPU() const { return false; }
+		DYN_FUNC inline bool isGPU() const { return true; }
+
+		void assign(const Array2D<T, DeviceType::GPU>& src);
+		void assign(const Array2D<T, DeviceType::CPU>& src);
+
+		/**
+		 * @brief Upload rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 */
+		void assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
+
+	private:
+		uint m_nx = 0;
+		uint m_ny = 0;
+		uint m_pitch = 0;
+		T* m_data = nullptr;
+	};
+
+	template<typename T>
+	using DArray2D = Array2D<T, DeviceType::GPU>;
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::resize(uint nx, uint ny)
+	{
+		if (nullptr != m_data) clear();
+
+		//Rows are stored without padding, so that operator[] and index() agree with operator()
+		m_data = (T*)HostMemoryPool::instance()->allocate(sizeof(T) * nx * ny);
+		m_pitch = sizeof(T) * nx;
+
+		m_nx = nx;	
+		m_ny = ny;
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::reset()
+	{
+		memset((void*)m_data, 0, m_pitch * m_ny);
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::clear()
+	{
+		if (m_data != nullptr)
+			HostMemoryPool::instance()->deallocate((void*)m_data, m_pitch * m_ny);
+
+		m_nx = 0;
+		m_ny = 0;
+		m_pitch = 0;
+		m_data = nullptr;
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::assign(const Array2D<T, DeviceType::GPU>& src)
+	{
+		if (m_nx != src.size() || m_ny != src.size()){
+			this->resize(src.nx(), src.ny());
+		}
+
+		memcpy(m_data, src.begin(), m_pitch * m_ny);
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::assign(const Array2D<T, DeviceType::CPU>& src)
+	{
+		if (m_nx != src.size() || m_ny != src.size()) {
+			this->resize(src.nx(), src.ny());
+		}
+
+		memcpy(m_data, src.begin(), m_pitch * m_ny);
+	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		memcpy(m_data + (size_t)dstRow * m_nx, src.begin() + (size_t)srcRow * src.nx(), m_pitch * rowNum);
+	}
+}
@@ -0,0 +1,350 @@
+#include "ArrayTools.h"
+#include "Algorithm/Scan.h"
+#include "Algorithm/Reduction.h"
+
+namespace dyno
+{
+	template<class ElementType>
+	class ArrayList<ElementType, DeviceType::GPU>
+	{
+	public:
+		ArrayList()
+		{
+		};
+
+		/*!
+		*	\brief	Do not release memory here, call clear() explicitly.
+		*/
+		~ArrayList() {};
+
+		/**
+		 * @brief Pre-allocate space for
+		 *
+		 * @param counts
+		 * @return true
+		 * @return false
+		 */
+		bool resize(const DArray<uint>& counts);
+		bool resize(const uint arraySize, const uint eleSize);
+
+		/**
+		 * @brief Rebuild the offsets from counts without the per-list List headers, the elements are accessed through csr().
+		 *	Buffers keep their capacity, rebuilding with similar counts every frame only scans the offsets and does not allocate.
+		 */
+		bool rebuild(const DArray<uint>& counts);
+
+		inline CSRView<ElementType> csr() {
+			return CSRView<ElementType>(mIndex.begin(), mElements.begin(), mIndex.size(), mElements.size());
+		}
+
+		/**
+		 * @brief Return false if the list was rebuilt by rebuild(), operator[] is not available then
+		 */
+		DYN_FUNC inline bool hasLists() const { return mLists.size() == mIndex.size(); }
+
+
+		bool resize(uint num);
+
+		template<typename ET2>
+		bool resize(const ArrayList<ET2, DeviceType::GPU>& src);
+
+		DYN_FUNC inline uint size() const { return mIndex.size(); }
+		DYN_FUNC inline uint elementSize() const { return mElements.size(); }
+
+		GPU_FUNC inline List<ElementType>& operator [] (unsigned int id) {
+			return mLists[id];
+		}
+
+		GPU_FUNC inline List<ElementType>& operator [] (unsigned int id) const {
+			return mLists[id];
+		}
+
+		DYN_FUNC inline bool isCPU() const { return false; }
+		DYN_FUNC inline bool isGPU() const { return true; }
+		DYN_FUNC inline bool isEmpty() const { return mIndex.size() == 0; }
+
+		void clear();
+
+		void assign(const ArrayList<ElementType, DeviceType::GPU>& src);
+		void assign(const ArrayList<ElementType, DeviceType::CPU>& src);
+		void assign(const std::vector<std::vector<ElementType>>& src);
+
+		/**
+		 * @brief Upload count elements of src starting from srcOffset into the element buffer starting from dstOffset.
+		 *	Neither the offsets nor the list sizes are touched, call fillLists() once all elements are uploaded.
+		 */
+		void assignElements(const Array<ElementType, DeviceType::CPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
+
+		/**
+		 * @brief Set the size of every list to its capacity, used after the elements of lists allocated by resize() are uploaded.
+		 */
+		void fillLists();
+
+		friend std::ostream& operator<<(std::ostream& out, const ArrayList<ElementType, DeviceType::GPU>& aList)
+		{
+			ArrayList<ElementType, DeviceType::CPU> hList;
+			hList.assign(aList);
+			out << hList;
+
+			return out;
+		}
+
+		const DArray<uint>& index() const { return mIndex; }
+		const DArray<ElementType>& elements() const { return mElements; }
+		const DArray<List<ElementType>>& lists() const { return mLists; }
+
+		/*!
+		*	\brief	To avoid erroneous shallow copy.
+		*/
+		ArrayList<ElementType, DeviceType::GPU>& operator=(const ArrayList<ElementType, DeviceType::GPU>&) = delete;
+
+	private:
+		bool rebuildIndex(const DArray<uint>& counts);
+
+		DArray<uint> mIndex;
+		DArray<ElementType> mElements;
+
+		DArray<List<ElementType>> mLists;
+	};
+
+	template<typename ElementType>
+	using DArrayList = ArrayList<ElementType, DeviceType::GPU>;
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::CPU>::assign(const ArrayList<ElementType, DeviceType::GPU>& src)
+	{
+		mIndex.assign(src.index());
+		mElements.assign(src.elements());
+
+		mLists.assign(src.lists());
+
+		//redirect the element address
+		for (int i = 0; i < mLists.size(); i++)
+		{
+			mLists[i].reserve(mElements.begin() + mIndex[i], mLists[i].size());
+		}
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::clear()
+	{
+		mIndex.clear();
+		mElements.clear();
+		mLists.clear();
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::rebuildIndex(const DArray<uint>& counts)
+	{
+		if (counts.size() == 0)
+		{
+			mIndex.clear();
+			mElements.clear();
+			mLists.clear();
+
+			return false;
+		}
+
+		uint num = counts.size();
+		mIndex.resize(num, false);
+
+		//Scan directly from counts, the total number follows from the last offset
+		Scan<uint> scan;
+		scan.exclusive(mIndex.begin(), counts.begin(), num);
+
+		mElements.resize(mIndex[num - 1] + counts[num - 1], false);
+
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::rebuild(const DArray<uint>& counts)
+	{
+		if (!this->rebuildIndex(counts))
+			return false;
+
+		mLists.clear();
+
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::resize(const DArray<uint>& counts)
+	{
+		if (!this->rebuildIndex(counts))
+			return false;
+
+		mLists.resize(counts.size(), false);
+
+		parallel_allocate_for_list(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+
+		return true;
+	}
+
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::resize(const uint arraySize, const uint eleSize)
+	{
+		assert(arraySize > 0);
+		assert(eleSize > 0);
+
+		if (mIndex.size() != arraySize)
+		{
+			mIndex.resize(arraySize);
+			mLists.resize(arraySize);
+		}
+
+		CArray<uint> hIndex;
+		hIndex.resize(arraySize);
+		int accNum = 0;
+		for (size_t i = 0; i < arraySize; i++)
+		{
+			hIndex[i] = (uint)accNum;
+			accNum += eleSize;
+		}
+
+		mIndex.assign(hIndex);
+
+		mElements.resize(arraySize*eleSize);
+
+		parallel_allocate_for_list(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+
+		return true;
+	}
+
+	template<typename ElementType>
+	template<typename ET2>
+	bool ArrayList<ElementType, DeviceType::GPU>::resize(const ArrayList<ET2, DeviceType::GPU>& src) {
+		uint arraySize = src.size();
+		if (mIndex.size() != arraySize)
+		{
+			mIndex.resize(arraySize);
+			mLists.resize(arraySize);
+		}
+
+		mIndex.assign(src.index());
+		mElements.resize(src.elementSize());
+
+		parallel_allocate_for_list(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+
+		return true;
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::assign(const ArrayList<ElementType, DeviceType::GPU>& src)
+	{
+		mIndex.assign(src.index());
+		mElements.assign(src.elements());
+
+		mLists.assign(src.lists());
+
+		//redirect the element address
+		if (!mLists.isEmpty())
+			parallel_init_for_list(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::assign(const ArrayList<ElementType, DeviceType::CPU>& src)
+	{
+		mIndex.assign(src.index());
+		mElements.assign(src.elements());
+
+		mLists.assign(src.lists());
+
+		//redirect the element address
+		if (!mLists.isEmpty())
+			parallel_init_for_list(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::assign(const std::vector<std::vector<ElementType>>& src)
+	{
+		size_t indNum = src.size();
+		CArray<uint> hIndex(indNum);
+
+		CArray<ElementType> hElements;
+
+		size_t eleNum = 0;
+		for (int i = 0; i < src.size(); i++)
+		{
+			hIndex[i] = (uint)eleNum;
+			eleNum += src[i].size();
+
+			for (int j = 0; j < src[i].size(); j++)
+			{
+				hElements.pushBack(src[i][j]);
+			}
+		}
+
+		CArray<List<ElementType>> lists;
+		lists.resize(indNum);
+			
+		mIndex.assign(hIndex);
+		mElements.assign(hElements);
+		ElementType* stAdr = mElements.begin();
+
+		eleNum = 0;
+		for (int i = 0; i < src.size(); i++)
+		{
+			size_t num_i = src[i].size();
+			List<ElementType> lst;
+			lst.assign(stAdr + eleNum, num_i, num_i);
+			lists[i] = lst;
+
+			eleNum += src[i].size();
+		}
+
+		mLists.assign(lists);
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::assignElements(const Array<ElementType, DeviceType::CPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		mElements.assign(src, count, dstOffset, srcOffset);
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::fillLists()
+	{
+		//List headers are patched on the host part by part to bound the staging memory
+		const uint batch = 1 << 16;
+
+		uint num = mLists.size();
+		CArray<List<ElementType>> hLists(std::min(num, batch));
+		for (uint offset = 0; offset < num; offset += batch)
+		{
+			uint count = std::min(batch, num - offset);
+			hLists.assign(mLists, count, 0, offset);
+
+			for (uint i = 0; i < count; i++)
+			{
+				List<ElementType>& lst = hLists[i];
+				lst.assign(lst.begin(), lst.max_size(), lst.max_size());
+			}
+
+			mLists.assign(hLists, count, offset, 0);
+		}
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::CPU>::resize(uint num)
+	{
+		assert(num > 0);
+
+		mIndex.resize(num);
+		mLists.resize(num);
+		
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::resize(uint num)
+	{
+		assert(num > 0);
+
+		mIndex.resize(num);
+		mLists.resize(num);
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+#include "STL/List.h"
+#include "ThreadPool.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Point each list to its range of elements, the lists are empty afterwards
+	 */
+	template<typename T>
+	void parallel_allocate_for_list(List<T>* lists, T* elements, size_t ele_size, DArray<uint>& index)
+	{
+		uint num = index.size();
+		ThreadPool::instance()->parallelFor(0, num, [&](uint i) {
+			uint count = i == num - 1 ? (uint)ele_size - index[num - 1] : index[i + 1] - index[i];
+
+			List<T> list;
+			list.reserve(elements + index[i], count);
+
+			lists[i] = list;
+		}, 1024);
+	}
+
+	/**
+	 * @brief Redirect each list to its range of elements, the sizes of the lists are kept
+	 */
+	template<typename T>
+	void parallel_init_for_list(List<T>* lists, T* elements, size_t ele_size, DArray<uint>& index)
+	{
+		uint num = index.size();
+		ThreadPool::instance()->parallelFor(0, num, [&](uint i) {
+			uint count = i == num - 1 ? (uint)ele_size - index[num - 1] : index[i + 1] - index[i];
+
+			lists[i].reserve(elements + index[i], count);
+		}, 1024);
+	}
+}
@@ -0,0 +1,31 @@
+#include "HostKernel.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+thread_local uint3 threadIdx;
+thread_local uint3 blockIdx;
+thread_local dim3 blockDim;
+thread_local dim3 gridDim;
+
+namespace dyno
+{
+	//Minimum number of threads executed by one task
+	const uint HOST_KERNEL_GRAIN = 1024;
+
+	void hostExecuteBlocks(const dim3& grid, const dim3& block, const std::function<void()>& blockKernel)
+	{
+		uint blockNum = grid.x * grid.y * grid.z;
+		uint threadNum = block.x * block.y * block.z;
+
+		uint grain = std::max(1u, HOST_KERNEL_GRAIN / std::max(1u, threadNum));
+
+		ThreadPool::instance()->parallelFor(0, blockNum, [&](uint b) {
+			gridDim = grid;
+			blockDim = block;
+			blockIdx = make_uint3(b % grid.x, (b / grid.x) % grid.y, b / (grid.x * grid.y));
+
+			blockKernel();
+		}, grain);
+	}
+}
@@ -0,0 +1,238 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+#include <functional>
+#include <type_traits>
+
+/**
+ * Host replacements of the CUDA built-ins used by kernels, so that kernels launched by cuExecute run on the ThreadPool.
+ * Threads of a block run one after another on the same thread, kernels relying on __shared__ memory are not supported and calls to __syncthreads() fail to compile.
+ */
+#define __global__
+#define __device__
+#define __host__
+#define __forceinline__ inline
+#define __constant__
+
+struct int2
+{
+	int x, y;
+};
+
+struct int3
+{
+	int x, y, z;
+};
+
+struct uint2
+{
+	unsigned int x, y;
+};
+
+struct uint3
+{
+	unsigned int x, y, z;
+};
+
+struct dim3
+{
+	dim3(unsigned int vx = 1, unsigned int vy = 1, unsigned int vz = 1) : x(vx), y(vy), z(vz) {}
+	dim3(const uint3& v) : x(v.x), y(v.y), z(v.z) {}
+
+	operator uint3() const { uint3 v = { x, y, z }; return v; }
+
+	unsigned int x, y, z;
+};
+
+inline int2 make_int2(int x, int y) { int2 v = { x, y }; return v; }
+inline int3 make_int3(int x, int y, int z) { int3 v = { x, y, z }; return v; }
+inline uint2 make_uint2(unsigned int x, unsigned int y) { uint2 v = { x, y }; return v; }
+inline uint3 make_uint3(unsigned int x, unsigned int y, unsigned int z) { uint3 v = { x, y, z }; return v; }
+
+//Threads of a block run one after another, a barrier cannot be honored, kernels calling it fail to build
+template<typename T = void>
+inline void __syncthreads()
+{
+	static_assert(sizeof(T*) == 0, "__syncthreads() is not supported by the host backend, split the kernel into separate launches");
+}
+
+inline int __clz(int x)
+{
+	unsigned int v = (unsigned int)x;
+	int n = 32;
+	while (v != 0) { v >>= 1; n--; }
+	return n;
+}
+
+inline int __clzll(long long x)
+{
+	unsigned long long v = (unsigned long long)x;
+	int n = 64;
+	while (v != 0) { v >>= 1; n--; }
+	return n;
+}
+
+//The CUDA math library provides min and max for mixed arithmetic types in the global namespace
+template<typename T1, typename T2>
+inline typename std::enable_if<std::is_arithmetic<T1>::value && std::is_arithmetic<T2>::value, typename std::common_type<T1, T2>::type>::type
+max(T1 a, T2 b)
+{
+	return a > b ? a : b;
+}
+
+template<typename T1, typename T2>
+inline typename std::enable_if<std::is_arithmetic<T1>::value && std::is_arithmetic<T2>::value, typename std::common_type<T1, T2>::type>::type
+min(T1 a, T2 b)
+{
+	return a < b ? a : b;
+}
+
+extern thread_local uint3 threadIdx;
+extern thread_local uint3 blockIdx;
+extern thread_local dim3 blockDim;
+extern thread_local dim3 gridDim;
+
+/**
+ * Host replacements of the CUDA runtime calls made outside of kernels, device memory is host memory
+ */
+enum cudaError_t
+{
+	cudaSuccess = 0
+};
+
+enum cudaMemcpyKind
+{
+	cudaMemcpyHostToHost = 0,
+	cudaMemcpyHostToDevice = 1,
+	cudaMemcpyDeviceToHost = 2,
+	cudaMemcpyDeviceToDevice = 3,
+	cudaMemcpyDefault = 4
+};
+
+template<typename T>
+inline cudaError_t cudaMalloc(T** ptr, size_t size) { *ptr = (T*)malloc(size); return cudaSuccess; }
+
+inline cudaError_t cudaFree(void* ptr) { free(ptr); return cudaSuccess; }
+
+inline cudaError_t cudaMemset(void* ptr, int value, size_t count) { memset(ptr, value, count); return cudaSuccess; }
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, size_t count, cudaMemcpyKind kind) { memcpy(dst, src, count); return cudaSuccess; }
+
+template<typename T>
+inline cudaError_t cudaMemcpyToSymbol(T& symbol, const void* src, size_t count) { memcpy(&symbol, src, count); return cudaSuccess; }
+
+inline cudaError_t cudaDeviceSynchronize() { return cudaSuccess; }
+
+namespace dyno
+{
+	/**
+	 * @brief Run blockKernel once for every block of a grid, blocks are distributed over the global ThreadPool.
+	 *	blockIdx, blockDim and gridDim are set before each invocation.
+	 */
+	void hostExecuteBlocks(const dim3& grid, const dim3& block, const std::function<void()>& blockKernel);
+
+	/**
+	 * @brief Run kernel for every thread of a grid, threadIdx is set before each invocation.
+	 *	The threads of a block call the kernel directly, only the dispatch of a block goes through std::function.
+	 */
+	template<typename Kernel>
+	inline void hostExecute(const dim3& grid, const dim3& block, const Kernel& kernel)
+	{
+		hostExecuteBlocks(grid, block, [&]() {
+			for (unsigned int z = 0; z < block.z; z++)
+			{
+				for (unsigned int y = 0; y < block.y; y++)
+				{
+					for (unsigned int x = 0; x < block.x; x++)
+					{
+						threadIdx = make_uint3(x, y, z);
+						kernel();
+					}
+				}
+			}
+		});
+	}
+
+	template<typename T>
+	struct HostAtomicValue
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	inline std::atomic<T>* hostAtomic(T* address)
+	{
+		static_assert(sizeof(std::atomic<T>) == sizeof(T), "the type cannot be updated atomically in place");
+		return reinterpret_cast<std::atomic<T>*>(address);
+	}
+
+	//Returns the old value like the CUDA atomics
+	template<typename T, typename Op>
+	inline T hostAtomicUpdate(T* address, Op op)
+	{
+		std::atomic<T>* a = hostAtomic(address);
+		T old = a->load(std::memory_order_relaxed);
+		while (!a->compare_exchange_weak(old, op(old))) {}
+
+		return old;
+	}
+
+	template<typename T>
+	inline T hostAtomicAdd(T* address, T val, std::true_type) { return hostAtomic(address)->fetch_add(val); }
+
+	template<typename T>
+	inline T hostAtomicAdd(T* address, T val, std::false_type) { return hostAtomicUpdate(address, [val](T old) { return old + val; }); }
+}
+
+template<typename T>
+inline T atomicAdd(T* address, typename dyno::HostAtomicValue<T>::type val)
+{
+	return dyno::hostAtomicAdd(address, val, std::is_integral<T>());
+}
+
+template<typename T>
+inline T atomicSub(T* address, typename dyno::HostAtomicValue<T>::type val)
+{
+	return dyno::hostAtomicUpdate(address, [val](T old) { return old - val; });
+}
+
+template<typename T>
+inline T atomicMin(T* address, typename dyno::HostAtomicValue<T>::type val)
+{
+	return dyno::hostAtomicUpdate(address, [val](T old) { return val < old ? val : old; });
+}
+
+template<typename T>
+inline T atomicMax(T* address, typename dyno::HostAtomicValue<T>::type val)
+{
+	return dyno::hostAtomicUpdate(address, [val](T old) { return val > old ? val : old; });
+}
+
+template<typename T>
+inline T atomicExch(T* address, typename dyno::HostAtomicValue<T>::type val)
+{
+	return dyno::hostAtomic(address)->exchange(val);
+}
+
+template<typename T>
+inline T atomicCAS(T* address, typename dyno::HostAtomicValue<T>::type compare, typename dyno::HostAtomicValue<T>::type val)
+{
+	dyno::hostAtomic(address)->compare_exchange_strong(compare, val);
+	return compare;
+}
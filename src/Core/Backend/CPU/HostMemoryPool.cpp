@@ -0,0 +1,120 @@
+#include "HostMemoryPool.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace dyno
+{
+	HostMemoryPool* HostMemoryPool::instance()
+	{
+		static HostMemoryPool pool;
+		return &pool;
+	}
+
+	HostMemoryPool::~HostMemoryPool()
+	{
+		releaseCache();
+	}
+
+	void* HostMemoryPool::allocate(size_t bytes)
+	{
+		if (bytes == 0)
+			return nullptr;
+
+		size_t b = bucket(bytes);
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (b < mBuckets.size() && !mBuckets[b].empty())
+			{
+				void* ptr = mBuckets[b].back();
+				mBuckets[b].pop_back();
+				mCachedBytes -= size_t(1) << b;
+
+				return ptr;
+			}
+		}
+
+		void* ptr = alignedMalloc(size_t(1) << b);
+		if (ptr == nullptr)
+		{
+			//Give the cached blocks back and try once more before giving up
+			releaseCache();
+			ptr = alignedMalloc(size_t(1) << b);
+
+			if (ptr == nullptr)
+				throw std::bad_alloc();
+		}
+
+		return ptr;
+	}
+
+	void HostMemoryPool::deallocate(void* ptr, size_t bytes)
+	{
+		if (ptr == nullptr)
+			return;
+
+		size_t b = bucket(bytes);
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mCachedBytes + (size_t(1) << b) <= mMaxCachedBytes)
+			{
+				if (mBuckets.size() <= b)
+					mBuckets.resize(b + 1);
+
+				mBuckets[b].push_back(ptr);
+				mCachedBytes += size_t(1) << b;
+
+				return;
+			}
+		}
+
+		alignedFree(ptr);
+	}
+
+	void HostMemoryPool::releaseCache()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (size_t b = 0; b < mBuckets.size(); b++)
+		{
+			for (size_t i = 0; i < mBuckets[b].size(); i++)
+				alignedFree(mBuckets[b][i]);
+
+			mBuckets[b].clear();
+		}
+
+		mCachedBytes = 0;
+	}
+
+	void* HostMemoryPool::alignedMalloc(size_t bytes)
+	{
+#ifdef _WIN32
+		return _aligned_malloc(bytes, ALIGNMENT);
+#else
+		void* ptr = nullptr;
+		return posix_memalign(&ptr, ALIGNMENT, bytes) == 0 ? ptr : nullptr;
+#endif
+	}
+
+	void HostMemoryPool::alignedFree(void* ptr)
+	{
+#ifdef _WIN32
+		_aligned_free(ptr);
+#else
+		free(ptr);
+#endif
+	}
+
+	size_t HostMemoryPool::bucket(size_t bytes)
+	{
+		//Blocks smaller than the alignment are not worth distinguishing
+		size_t b = 6;
+		while ((size_t(1) << b) < bytes)
+			b++;
+
+		return b;
+	}
+}
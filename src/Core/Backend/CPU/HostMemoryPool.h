@@ -0,0 +1,77 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace dyno
+{
+	/**
+	 * @brief Aligned host memory backing the device arrays of the host backend.
+	 *	Block sizes are rounded up to powers of two, released blocks are cached per size and handed out again,
+	 *	so arrays that are resized every frame do not go through the system allocator.
+	 */
+	class HostMemoryPool
+	{
+	public:
+		static const size_t ALIGNMENT = 64;
+
+		static HostMemoryPool* instance();
+
+		HostMemoryPool(const HostMemoryPool&) = delete;
+		HostMemoryPool& operator=(const HostMemoryPool&) = delete;
+
+		/**
+		 * @brief Return a block of at least bytes bytes aligned to ALIGNMENT, nullptr if bytes is 0
+		 */
+		void* allocate(size_t bytes);
+
+		/**
+		 * @param bytes must be the size passed to allocate()
+		 */
+		void deallocate(void* ptr, size_t bytes);
+
+		/**
+		 * @brief Return all cached blocks to the system
+		 */
+		void releaseCache();
+
+		size_t cachedBytes() const { return mCachedBytes; }
+
+		/**
+		 * @brief Blocks released while more than maxBytes are cached are returned to the system directly
+		 */
+		void setMaxCachedBytes(size_t maxBytes) { mMaxCachedBytes = maxBytes; }
+
+	private:
+		HostMemoryPool() {};
+		~HostMemoryPool();
+
+		static void* alignedMalloc(size_t bytes);
+		static void alignedFree(void* ptr);
+
+		static size_t bucket(size_t bytes);
+
+		std::mutex mMutex;
+
+		//Free blocks of size 2^i are stored in mBuckets[i]
+		std::vector<std::vector<void*>> mBuckets;
+
+		size_t mCachedBytes = 0;
+		size_t mMaxCachedBytes = size_t(1) << 30;
+	};
+}
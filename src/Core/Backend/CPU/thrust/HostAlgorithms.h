@@ -0,0 +1,155 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+/**
+ * Host replacements of the thrust algorithms called with thrust::device, device arrays live in host memory for NO_BACKEND.
+ * Only the overloads used by the engine are provided, the sorts are stable like the ones of thrust.
+ */
+namespace thrust
+{
+	struct host_execution_policy {};
+
+	static const host_execution_policy device;
+	static const host_execution_policy host;
+
+	template<typename T>
+	struct plus
+	{
+		T operator()(const T& a, const T& b) const { return a + b; }
+	};
+
+	template<typename T>
+	struct less
+	{
+		bool operator()(const T& a, const T& b) const { return a < b; }
+	};
+
+	template<typename Iterator>
+	inline typename std::iterator_traits<Iterator>::value_type reduce(const host_execution_policy&, Iterator first, Iterator last)
+	{
+		typedef typename std::iterator_traits<Iterator>::value_type T;
+		return std::accumulate(first, last, T(0));
+	}
+
+	template<typename Iterator, typename T>
+	inline T reduce(const host_execution_policy&, Iterator first, Iterator last, T init)
+	{
+		return std::accumulate(first, last, init);
+	}
+
+	template<typename Iterator, typename T, typename BinaryOp>
+	inline T reduce(const host_execution_policy&, Iterator first, Iterator last, T init, BinaryOp op)
+	{
+		return std::accumulate(first, last, init, op);
+	}
+
+	//The input may alias the output, which std::exclusive_scan does not allow
+	template<typename InputIterator, typename OutputIterator, typename T, typename BinaryOp>
+	inline OutputIterator exclusive_scan(const host_execution_policy&, InputIterator first, InputIterator last, OutputIterator result, T init, BinaryOp op)
+	{
+		T sum = init;
+		for (; first != last; ++first, ++result)
+		{
+			T v = *first;
+			*result = sum;
+			sum = op(sum, v);
+		}
+
+		return result;
+	}
+
+	template<typename InputIterator, typename OutputIterator, typename T>
+	inline OutputIterator exclusive_scan(const host_execution_policy& exec, InputIterator first, InputIterator last, OutputIterator result, T init)
+	{
+		return thrust::exclusive_scan(exec, first, last, result, init, plus<T>());
+	}
+
+	template<typename InputIterator, typename OutputIterator>
+	inline OutputIterator exclusive_scan(const host_execution_policy& exec, InputIterator first, InputIterator last, OutputIterator result)
+	{
+		typedef typename std::iterator_traits<InputIterator>::value_type T;
+		return thrust::exclusive_scan(exec, first, last, result, T(0), plus<T>());
+	}
+
+	template<typename InputIterator, typename OutputIterator>
+	inline OutputIterator inclusive_scan(const host_execution_policy&, InputIterator first, InputIterator last, OutputIterator result)
+	{
+		return std::partial_sum(first, last, result);
+	}
+
+	template<typename Iterator>
+	inline void sort(const host_execution_policy&, Iterator first, Iterator last)
+	{
+		std::stable_sort(first, last);
+	}
+
+	template<typename Iterator, typename Compare>
+	inline void sort(const host_execution_policy&, Iterator first, Iterator last, Compare comp)
+	{
+		std::stable_sort(first, last, comp);
+	}
+
+	template<typename KeyIterator, typename ValueIterator, typename Compare>
+	inline void sort_by_key(const host_execution_policy&, KeyIterator keysFirst, KeyIterator keysLast, ValueIterator values, Compare comp)
+	{
+		typedef typename std::iterator_traits<KeyIterator>::value_type Key;
+		typedef typename std::iterator_traits<ValueIterator>::value_type Value;
+
+		size_t num = std::distance(keysFirst, keysLast);
+
+		std::vector<size_t> order(num);
+		std::iota(order.begin(), order.end(), size_t(0));
+		std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return comp(keysFirst[a], keysFirst[b]); });
+
+		std::vector<Key> keys(keysFirst, keysLast);
+		std::vector<Value> vals(values, values + num);
+		for (size_t i = 0; i < num; i++)
+		{
+			keysFirst[i] = keys[order[i]];
+			values[i] = vals[order[i]];
+		}
+	}
+
+	template<typename KeyIterator, typename ValueIterator>
+	inline void sort_by_key(const host_execution_policy& exec, KeyIterator keysFirst, KeyIterator keysLast, ValueIterator values)
+	{
+		typedef typename std::iterator_traits<KeyIterator>::value_type Key;
+		thrust::sort_by_key(exec, keysFirst, keysLast, values, less<Key>());
+	}
+
+	template<typename Iterator>
+	inline Iterator min_element(const host_execution_policy&, Iterator first, Iterator last)
+	{
+		return std::min_element(first, last);
+	}
+
+	template<typename Iterator>
+	inline Iterator max_element(const host_execution_policy&, Iterator first, Iterator last)
+	{
+		return std::max_element(first, last);
+	}
+
+	template<typename Iterator1, typename Iterator2>
+	inline bool equal(const host_execution_policy&, Iterator1 first1, Iterator1 last1, Iterator2 first2)
+	{
+		return std::equal(first1, last1, first2);
+	}
+}
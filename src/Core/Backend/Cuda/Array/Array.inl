@@ -9,6 +9,12 @@ namespace dyno
 		cuSafeCall(cudaMemcpy(this->begin(), src.begin(), src.size() * sizeof(T), cudaMemcpyDeviceToHost));
 	}
 
+	template<typename T>
+	void Array<T, DeviceType::CPU>::assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		cuSafeCall(cudaMemcpy(this->begin() + dstOffset, src.begin() + srcOffset, count * sizeof(T), cudaMemcpyDeviceToHost));
+	}
+
 	/*!
 	*	\class	Array
 	*	\brief	This class is designed to be elegant, so it can be directly passed to GPU as parameters.
@@ -31,7 +37,16 @@ namespace dyno
 		*/
 		~Array() {};
 
-		void resize(const uint n);
+		/*!
+		*	\brief	Resize the array, the content is not preserved when the buffer is reallocated.
+		*			The buffer is released if n drops to half of the capacity, pass shrink = false to keep it for later reuse.
+		*/
+		void resize(const uint n, const bool shrink = true);
+
+		/*!
+		*	\brief	Grow the buffer to hold at least n elements, the existing elements are kept.
+		*/
+		void reserve(const uint n);
 
 		/*!
 		*	\brief	Clear all data to zero.
@@ -57,6 +72,7 @@ namespace dyno
 		}
 
 		DYN_FUNC inline uint size() const { return mTotalNum; }
+		DYN_FUNC inline uint capacity() const { return mBufferNum; }
 		DYN_FUNC inline bool isCPU() const { return false; }
 		DYN_FUNC inline bool isGPU() const { return true; }
 		DYN_FUNC inline bool isEmpty() const { return mData == nullptr; }
@@ -69,6 +85,12 @@ namespace dyno
 		void assign(const Array<T, DeviceType::CPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
 		void assign(const std::vector<T>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
 
+		/*!
+		*	\brief	Append count elements of src starting from srcOffset to the end of this array.
+		*			The buffer grows geometrically, so the cost is proportional to count as long as no reallocation happens.
+		*/
+		void append(const Array<T, DeviceType::GPU>& src, const uint count, const uint srcOffset = 0);
+
 		friend std::ostream& operator<<(std::ostream &out, const Array<T, DeviceType::GPU>& dArray)
 		{
 			Array<T, DeviceType::CPU> hArray;
@@ -89,7 +111,7 @@ namespace dyno
 	using DArray = Array<T, DeviceType::GPU>;
 
 	template<typename T>
-	void Array<T, DeviceType::GPU>::resize(const uint n)
+	void Array<T, DeviceType::GPU>::resize(const uint n, const bool shrink)
 	{
 		if (mTotalNum == n) return;
 
@@ -98,11 +120,9 @@ namespace dyno
 			return;
 		}
 
-		int exp = (int)std::ceil(std::log2(float(n)));
-
-		int bound = (int)std::pow(2, exp);
+		uint bound = nextPowerOfTwo(n);
 
-		if (n > mBufferNum || n <= mBufferNum / 2) {
+		if (n > mBufferNum || (shrink && n <= mBufferNum / 2)) {
 			clear();
 
 			mTotalNum = n; 	
@@ -114,6 +134,30 @@ namespace dyno
 			mTotalNum = n;
 	}
 
+	template<typename T>
+	void Array<T, DeviceType::GPU>::reserve(const uint n)
+	{
+		if (n <= mBufferNum) return;
+
+		uint bound = nextPowerOfTwo(n);
+
+		T* data = nullptr;
+		cuSafeCall(cudaMalloc(&data, bound * sizeof(T)));
+
+		if (mTotalNum > 0)
+		{
+			cuSafeCall(cudaMemcpy(data, mData, mTotalNum * sizeof(T), cudaMemcpyDeviceToDevice));
+		}
+
+		if (mData != nullptr)
+		{
+			cuSafeCall(cudaFree((void*)mData));
+		}
+
+		mData = data;
+		mBufferNum = bound;
+	}
+
 	template<typename T>
 	void Array<T, DeviceType::GPU>::clear()
 	{
@@ -178,4 +222,16 @@ namespace dyno
 	{
 		cuSafeCall(cudaMemcpy(mData + dstOffset, src.begin() + srcOffset, count * sizeof(T), cudaMemcpyDeviceToDevice));
 	}
-}
+
+	template<typename T>
+	void Array<T, DeviceType::GPU>::append(const Array<T, DeviceType::GPU>& src, const uint count, const uint srcOffset)
+	{
+		if (count == 0) return;
+
+		uint num = mTotalNum;
+		this->reserve(num + count);
+		mTotalNum = num + count;
+
+		cuSafeCall(cudaMemcpy(mData + num, src.begin() + srcOffset, count * sizeof(T), cudaMemcpyDeviceToDevice));
+	}
+}
\ No newline at end of file
@@ -10,6 +10,12 @@ namespace dyno {
 		cuSafeCall(cudaMemcpy2D(m_data.data(), sizeof(T) * m_nx, src.begin(), src.pitch(), sizeof(T) * src.nx(), src.ny(), cudaMemcpyDeviceToHost));
 	}
 
+	template<typename T>
+	void Array2D<T, DeviceType::CPU>::assign(const Array2D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		cuSafeCall(cudaMemcpy2D(m_data.data() + (size_t)dstRow * m_nx, sizeof(T) * m_nx, (const char*)src.begin() + (size_t)srcRow * src.pitch(), src.pitch(), sizeof(T) * src.nx(), rowNum, cudaMemcpyDeviceToHost));
+	}
+
 	template<typename T>
 	class Array2D<T, DeviceType::GPU>
 	{
@@ -79,6 +85,11 @@ namespace dyno {
 		void assign(const Array2D<T, DeviceType::GPU>& src);
 		void assign(const Array2D<T, DeviceType::CPU>& src);
 
+		/**
+		 * @brief Upload rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 */
+		void assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
+
 	private:
 		uint m_nx = 0;
 		uint m_ny = 0;
@@ -137,4 +148,10 @@ namespace dyno {
 
 		cuSafeCall(cudaMemcpy2D(m_data, m_pitch, src.begin(), sizeof(T) *src.nx(), sizeof(T) * src.nx(), src.ny(), cudaMemcpyHostToDevice));
 	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		cuSafeCall(cudaMemcpy2D((char*)m_data + (size_t)dstRow * m_pitch, m_pitch, src.begin() + (size_t)srcRow * src.nx(), sizeof(T) * src.nx(), sizeof(T) * m_nx, rowNum, cudaMemcpyHostToDevice));
+	}
 }
@@ -10,6 +10,12 @@ namespace dyno {
 		cuSafeCall(cudaMemcpy2D(m_data.data(), sizeof(T) * m_nx, src.begin(), src.pitch(), sizeof(T) * src.nx(), src.ny() * src.nz(), cudaMemcpyDeviceToHost));
 	}
 
+	template<typename T>
+	void Array3D<T, DeviceType::CPU>::assign(const Array3D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		cuSafeCall(cudaMemcpy2D(m_data.data() + (size_t)dstRow * m_nx, sizeof(T) * m_nx, (const char*)src.begin() + (size_t)srcRow * src.pitch(), src.pitch(), sizeof(T) * src.nx(), rowNum, cudaMemcpyDeviceToHost));
+	}
+
 	template<typename T>
 	class Array3D<T, DeviceType::GPU>
 	{
@@ -76,6 +82,11 @@ namespace dyno {
 		void assign(const Array3D<T, DeviceType::GPU>& src);
 		void assign(const Array3D<T, DeviceType::CPU>& src);
 
+		/**
+		 * @brief Upload rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 */
+		void assign(const Array3D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
+
 	private:
 		uint m_nx = 0;
 		uint m_pitch_x = 0;
@@ -143,4 +154,11 @@ namespace dyno {
 
 		cuSafeCall(cudaMemcpy2D(m_data, m_pitch_x, src.begin(), sizeof(T) *src.nx(), sizeof(T) *src.nx(), src.ny()*src.nz(), cudaMemcpyHostToDevice));
 	}
+
+	template<typename T>
+	void Array3D<T, DeviceType::GPU>::assign(const Array3D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		//Slices are stored back to back, so row j of slice k starts at (j + k * ny) * pitch
+		cuSafeCall(cudaMemcpy2D((char*)m_data + (size_t)dstRow * m_pitch_x, m_pitch_x, src.begin() + (size_t)srcRow * src.nx(), sizeof(T) * src.nx(), sizeof(T) * m_nx, rowNum, cudaMemcpyHostToDevice));
+	}
 }
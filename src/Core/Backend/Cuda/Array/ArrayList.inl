@@ -27,13 +27,28 @@ namespace dyno
 		bool resize(const DArray<uint>& counts);
 		bool resize(const uint arraySize, const uint eleSize);
 
+		/**
+		 * @brief Rebuild the offsets from counts without the per-list List headers, the elements are accessed through csr().
+		 *	Buffers keep their capacity, rebuilding with similar counts every frame only scans the offsets and does not allocate.
+		 */
+		bool rebuild(const DArray<uint>& counts);
+
+		inline CSRView<ElementType> csr() {
+			return CSRView<ElementType>(mIndex.begin(), mElements.begin(), mIndex.size(), mElements.size());
+		}
+
+		/**
+		 * @brief Return false if the list was rebuilt by rebuild(), operator[] is not available then
+		 */
+		DYN_FUNC inline bool hasLists() const { return mLists.size() == mIndex.size(); }
+
 
 		bool resize(uint num);
 
 		template<typename ET2>
 		bool resize(const ArrayList<ET2, DeviceType::GPU>& src);
 
-		DYN_FUNC inline uint size() const { return mLists.size(); }
+		DYN_FUNC inline uint size() const { return mIndex.size(); }
 		DYN_FUNC inline uint elementSize() const { return mElements.size(); }
 
 		GPU_FUNC inline List<ElementType>& operator [] (unsigned int id) {
@@ -54,6 +69,17 @@ namespace dyno
 		void assign(const ArrayList<ElementType, DeviceType::CPU>& src);
 		void assign(const std::vector<std::vector<ElementType>>& src);
 
+		/**
+		 * @brief Upload count elements of src starting from srcOffset into the element buffer starting from dstOffset.
+		 *	Neither the offsets nor the list sizes are touched, call fillLists() once all elements are uploaded.
+		 */
+		void assignElements(const Array<ElementType, DeviceType::CPU>& src, const uint count, const uint dstOffset = 0, const uint srcOffset = 0);
+
+		/**
+		 * @brief Set the size of every list to its capacity, used after the elements of lists allocated by resize() are uploaded.
+		 */
+		void fillLists();
+
 		friend std::ostream& operator<<(std::ostream& out, const ArrayList<ElementType, DeviceType::GPU>& aList)
 		{
 			ArrayList<ElementType, DeviceType::CPU> hList;
@@ -73,6 +99,8 @@ namespace dyno
 		ArrayList<ElementType, DeviceType::GPU>& operator=(const ArrayList<ElementType, DeviceType::GPU>&) = delete;
 
 	private:
+		bool rebuildIndex(const DArray<uint>& counts);
+
 		DArray<uint> mIndex;
 		DArray<ElementType> mElements;
 
@@ -91,7 +119,7 @@ namespace dyno
 		mLists.assign(src.lists());
 
 		//redirect the element address
-		for (int i = 0; i < src.size(); i++)
+		for (int i = 0; i < mLists.size(); i++)
 		{
 			mLists[i].reserve(mElements.begin() + mIndex[i], mLists[i].size());
 		}
@@ -106,7 +134,7 @@ namespace dyno
 	}
 
 	template<class ElementType>
-	bool ArrayList<ElementType, DeviceType::GPU>::resize(const DArray<uint>& counts)
+	bool ArrayList<ElementType, DeviceType::GPU>::rebuildIndex(const DArray<uint>& counts)
 	{
 		if (counts.size() == 0)
 		{
@@ -117,24 +145,41 @@ namespace dyno
 			return false;
 		}
 
-		if (mIndex.size() != counts.size())
-		{
-			mIndex.resize(counts.size());
-			mLists.resize(counts.size());
-		}
+		uint num = counts.size();
+		mIndex.resize(num, false);
 
-		mIndex.assign(counts);
+		//Scan directly from counts, the total number follows from the last offset
+		Scan<uint> scan;
+		scan.exclusive(mIndex.begin(), counts.begin(), num);
 
-		Reduction<uint> reduce;
-		uint total_num = reduce.accumulate(mIndex.begin(), mIndex.size());
+		uint last[2];
+		cuSafeCall(cudaMemcpy(&last[0], mIndex.begin() + num - 1, sizeof(uint), cudaMemcpyDeviceToHost));
+		cuSafeCall(cudaMemcpy(&last[1], counts.begin() + num - 1, sizeof(uint), cudaMemcpyDeviceToHost));
 
-		Scan<uint> scan;
-		scan.exclusive(mIndex);
+		mElements.resize(last[0] + last[1], false);
 
-		//printf("total num 2 = %d\n", total_num);
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::rebuild(const DArray<uint>& counts)
+	{
+		if (!this->rebuildIndex(counts))
+			return false;
+
+		mLists.clear();
+
+		return true;
+	}
+
+	template<class ElementType>
+	bool ArrayList<ElementType, DeviceType::GPU>::resize(const DArray<uint>& counts)
+	{
+		if (!this->rebuildIndex(counts))
+			return false;
+
+		mLists.resize(counts.size(), false);
 
-		mElements.resize(total_num);
-		
 		parallel_allocate_for_list<sizeof(ElementType)>(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
 
 		return true;
@@ -198,7 +243,8 @@ namespace dyno
 		mLists.assign(src.lists());
 
 		//redirect the element address
-		parallel_init_for_list<sizeof(ElementType)>(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+		if (!mLists.isEmpty())
+			parallel_init_for_list<sizeof(ElementType)>(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
 	}
 
 	template<class ElementType>
@@ -210,7 +256,8 @@ namespace dyno
 		mLists.assign(src.lists());
 
 		//redirect the element address
-		parallel_init_for_list<sizeof(ElementType)>(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
+		if (!mLists.isEmpty())
+			parallel_init_for_list<sizeof(ElementType)>(mLists.begin(), mElements.begin(), mElements.size(), mIndex);
 	}
 
 	template<class ElementType>
@@ -254,6 +301,35 @@ namespace dyno
 		mLists.assign(lists);
 	}
 
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::assignElements(const Array<ElementType, DeviceType::CPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		mElements.assign(src, count, dstOffset, srcOffset);
+	}
+
+	template<class ElementType>
+	void ArrayList<ElementType, DeviceType::GPU>::fillLists()
+	{
+		//List headers are patched on the host part by part to bound the staging memory
+		const uint batch = 1 << 16;
+
+		uint num = mLists.size();
+		CArray<List<ElementType>> hLists(std::min(num, batch));
+		for (uint offset = 0; offset < num; offset += batch)
+		{
+			uint count = std::min(batch, num - offset);
+			hLists.assign(mLists, count, 0, offset);
+
+			for (uint i = 0; i < count; i++)
+			{
+				List<ElementType>& lst = hLists[i];
+				lst.assign(lst.begin(), lst.max_size(), lst.max_size());
+			}
+
+			mLists.assign(hLists, count, offset, 0);
+		}
+	}
+
 	template<class ElementType>
 	bool ArrayList<ElementType, DeviceType::CPU>::resize(uint num)
 	{
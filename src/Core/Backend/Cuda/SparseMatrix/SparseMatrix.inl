@@ -3,7 +3,6 @@
 #include "Algorithm/Arithmetic.h"
 #include "Algorithm/Function2Pt.h"
 #include "Algorithm/SMAlgorithm.h"
-#include <windows.h>
 
 namespace dyno
 {
@@ -13,6 +13,24 @@ namespace dyno
 		//cuSafeCall(cudaMemcpy(this->begin(), src.begin(), src.size() * sizeof(T), cudaMemcpyDeviceToHost));
 	}
 
+	template<typename T>
+	void Array<T, DeviceType::CPU>::assign(const Array<T, DeviceType::GPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
+	{
+		if (count == 0)
+			return;
+
+		// Only whole buffers can be downloaded, copy the range into a temporary device buffer first
+		VkDeviceArray<T> range;
+		range.resize(count);
+		vkTransfer(range, 0, *src.handle(), (uint64_t)srcOffset, (uint64_t)count);
+
+		std::vector<T> staging(count);
+		vkTransfer(staging, range);
+		range.clear();
+
+		memcpy(this->begin() + dstOffset, staging.data(), count * sizeof(T));
+	}
+
 	/*!
 	*	\class	Array
 	*	\brief	This class is designed to be elegant, so it can be directly passed to GPU as parameters.
@@ -169,7 +187,17 @@ namespace dyno
 	template<typename T>
 	void Array<T, DeviceType::GPU>::assign(const Array<T, DeviceType::CPU>& src, const uint count, const uint dstOffset, const uint srcOffset)
 	{
-		//cuSafeCall(cudaMemcpy(mData + dstOffset, src.begin() + srcOffset, count * sizeof(T), cudaMemcpyHostToDevice));
+		if (count == 0)
+			return;
+
+		std::vector<T> staging(src.begin() + srcOffset, src.begin() + srcOffset + count);
+
+		VkDeviceArray<T> range;
+		range.resize(count);
+		vkTransfer(range, staging);
+
+		vkTransfer(mData, (uint64_t)dstOffset, range, 0, (uint64_t)count);
+		range.clear();
 	}
 
 	template<typename T>
@@ -14,6 +14,16 @@ namespace dyno {
 		//cuSafeCall(cudaMemcpy2D(m_data.data(), sizeof(T) * m_nx, src.begin(), src.pitch(), sizeof(T) * src.nx(), src.ny(), cudaMemcpyDeviceToHost));
 	}
 
+	template<typename T>
+	void Array2D<T, DeviceType::CPU>::assign(const Array2D<T, DeviceType::GPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		//VkDeviceArray2D only supports whole transfers
+		std::vector<T> whole(src.size());
+		vkTransfer(whole, *src.handle());
+
+		memcpy(m_data.data() + (size_t)dstRow * m_nx, whole.data() + (size_t)srcRow * src.nx(), sizeof(T) * src.nx() * rowNum);
+	}
+
 	template<typename T>
 	class Array2D<T, DeviceType::GPU>
 	{
@@ -92,6 +102,11 @@ namespace dyno {
 		void assign(const Array2D<T, DeviceType::GPU>& src);
 		void assign(const Array2D<T, DeviceType::CPU>& src);
 
+		/**
+		 * @brief Upload rowNum rows of src starting from srcRow into the rows starting from dstRow, no resize is done.
+		 */
+		void assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow = 0, const uint srcRow = 0);
+
 	private:
 		uint m_nx = 0;
 		uint m_ny = 0;
@@ -158,4 +173,15 @@ namespace dyno {
 
 		//cuSafeCall(cudaMemcpy2D(m_data, m_pitch, src.begin(), sizeof(T) *src.nx(), sizeof(T) * src.nx(), src.ny(), cudaMemcpyHostToDevice));
 	}
+
+	template<typename T>
+	void Array2D<T, DeviceType::GPU>::assign(const Array2D<T, DeviceType::CPU>& src, const uint rowNum, const uint dstRow, const uint srcRow)
+	{
+		//VkDeviceArray2D only supports whole transfers, patch the rows on the host
+		std::vector<T> whole(this->size());
+		vkTransfer(whole, m_data);
+
+		memcpy(whole.data() + (size_t)dstRow * m_nx, src.begin() + (size_t)srcRow * src.nx(), sizeof(T) * m_nx * rowNum);
+		vkTransfer(m_data, whole);
+	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "VkDeviceArray.h"
 #include "VkProgram.h"
+#include "VkCommandRecorder.h"
 
 //SortType
 #define UP   0 //1,2,3,4,5
@@ -26,6 +27,35 @@ namespace dyno {
 		eAlgorithmVariant algorithm;
 	};
 
+	//Push constants shared by all radix sort kernels
+	struct RadixSortParameters {
+		uint32_t n;
+		uint32_t numGroups;
+		uint32_t keyWords;		//number of words moved per key
+		uint32_t word;			//word holding the current digit
+		uint32_t shift;			//bit offset of the current digit in the word
+		uint32_t keyType;
+		uint32_t descending;
+		uint32_t stride;		//words per element for gather, number of segments for the segment ids
+	};
+
+	enum RadixKeyType : uint32_t {
+		eRadixUInt = 0,
+		eRadixInt = 1,
+		eRadixFloat = 2,
+		eRadixUInt64 = 3,
+		eRadixInt64 = 4,
+		eRadixDouble = 5
+	};
+
+	template<typename T> struct RadixKeyTraits;
+	template<> struct RadixKeyTraits<uint32_t> { static const RadixKeyType type = eRadixUInt; };
+	template<> struct RadixKeyTraits<int> { static const RadixKeyType type = eRadixInt; };
+	template<> struct RadixKeyTraits<float> { static const RadixKeyType type = eRadixFloat; };
+	template<> struct RadixKeyTraits<uint64_t> { static const RadixKeyType type = eRadixUInt64; };
+	template<> struct RadixKeyTraits<int64_t> { static const RadixKeyType type = eRadixInt64; };
+	template<> struct RadixKeyTraits<double> { static const RadixKeyType type = eRadixDouble; };
+
 	template<typename T>
 	class VkSort{
 	public:
@@ -41,9 +71,54 @@ namespace dyno {
 		void sort_by_key(std::vector<T>& keys, std::vector<T>& values, uint32_t SortType);
 		void sort_by_key(VkDeviceArray<T>& keys, VkDeviceArray<T>& values, uint32_t SortType);
 
+		// LSD radix sort, 8 bits per pass, stable and without padding
+		// keys support uint32_t, int, float, uint64_t, int64_t and double --- SortType = UP /DOWN
+		void radix_sort(std::vector<T>& keys, uint32_t SortType);
+		void radix_sort(VkDeviceArray<T>& keys, uint32_t SortType);
+
+		// values of any type whose size is a multiple of 4 bytes
+		template<typename V>
+		void radix_sort_by_key(std::vector<T>& keys, std::vector<V>& values, uint32_t SortType);
+		template<typename V>
+		void radix_sort_by_key(VkDeviceArray<T>& keys, VkDeviceArray<V>& values, uint32_t SortType);
+
+		// sort the keys within each segment, segments are given by their ascending start offsets, the first one being 0
+		void segmented_sort(VkDeviceArray<T>& keys, VkDeviceArray<uint32_t>& segmentOffsets, uint32_t SortType);
+		template<typename V>
+		void segmented_sort_by_key(VkDeviceArray<T>& keys, VkDeviceArray<V>& values, VkDeviceArray<uint32_t>& segmentOffsets, uint32_t SortType);
+
 	private:
+		// record the kernels sorting the keys, the permutation ends up in mIndices[sorted], returns sorted
+		uint32_t recordRadixSort(VkDeviceArray<T>& keys, VkDeviceArray<uint32_t>* segmentOffsets, uint32_t SortType);
+
+		// record the hierarchical exclusive scan of mHistogram, level 0 being the histogram itself
+		void recordScan(uint32_t level, uint32_t n);
+
+		template<typename V>
+		void recordGather(VkDeviceArray<V>& values, VkDeviceArray<V>& source, uint32_t sorted);
+
 		std::shared_ptr<VkProgram> mSortKernel;
 		std::shared_ptr<VkProgram> mSortByKeyKernel;
+
+		std::shared_ptr<VkProgram> mRadixEncode;
+		std::shared_ptr<VkProgram> mRadixDecode;
+		std::shared_ptr<VkProgram> mRadixHistogram;
+		std::shared_ptr<VkProgram> mRadixScan;
+		std::shared_ptr<VkProgram> mRadixScanAdd;
+		std::shared_ptr<VkProgram> mRadixScatter;
+		std::shared_ptr<VkProgram> mRadixGather;
+		std::shared_ptr<VkProgram> mRadixSegments;
+
+		// ping-pong buffers of the sortable key words and the permutation
+		VkDeviceArray<uint32_t> mWords[2];
+		VkDeviceArray<uint32_t> mIndices[2];
+		VkDeviceArray<uint32_t> mHistogram;
+
+		// sums of the blocks of 1024 counts scanned at each level, four levels cover any histogram
+		VkDeviceArray<uint32_t> mBlockSums[4];
+
+		// all kernels of a radix sort are submitted at once
+		std::shared_ptr<VkCommandRecorder> mRecorder;
 	};
 }
 #include "VkSort.inl"
@@ -242,6 +242,235 @@ namespace dyno {
 		ValuesAddZeroArray.clear();
 	}
 
+	inline uint32_t RadixSortGroupNumber(uint32_t n)
+	{
+		return (n + 255) / 256;
+	}
+
+	inline uint32_t RadixScanBlockNumber(uint32_t n)
+	{
+		return (n + 1023) / 1024;
+	}
+
+	template<typename T>
+	void VkSort<T>::recordScan(uint32_t level, uint32_t n)
+	{
+		VkDeviceArray<uint32_t>& counts = level == 0 ? mHistogram : mBlockSums[level - 1];
+		VkDeviceArray<uint32_t>& sums = mBlockSums[level];
+
+		dim3 groupSize;
+		groupSize.x = RadixScanBlockNumber(n);
+
+		VkConstant<uint32_t> num;
+		num.setValue(n);
+
+		mRadixScan->flush(groupSize, &counts, &sums, &num);
+
+		if (groupSize.x > 1)
+		{
+			recordScan(level + 1, groupSize.x);
+			mRadixScanAdd->flush(groupSize, &sums, &counts, &num);
+		}
+	}
+
+	template<typename T>
+	uint32_t VkSort<T>::recordRadixSort(VkDeviceArray<T>& keys, VkDeviceArray<uint32_t>* segmentOffsets, uint32_t SortType)
+	{
+		uint32_t n = keys.size();
+		uint32_t keyWords = sizeof(T) / sizeof(uint32_t);
+		uint32_t segmentNum = segmentOffsets == nullptr ? 0 : segmentOffsets->size();
+
+		// digits of the segment ids, the segment word is the most significant one
+		uint32_t segmentPasses = 0;
+		for (uint32_t s = segmentNum > 1 ? segmentNum - 1 : 0; s > 0; s >>= 8)
+			segmentPasses++;
+
+		RadixSortParameters param;
+		param.n = n;
+		param.numGroups = RadixSortGroupNumber(n);
+		param.keyWords = segmentPasses > 0 ? keyWords + 1 : keyWords;
+		param.word = 0;
+		param.shift = 0;
+		param.keyType = RadixKeyTraits<T>::type;
+		param.descending = SortType == DOWN ? 1 : 0;
+		param.stride = segmentNum;
+
+		// the buffers only grow, so the sizes are taken from param.n in the kernels
+		mWords[0].resize(param.keyWords * n);
+		mWords[1].resize(param.keyWords * n);
+		mIndices[0].resize(n);
+		mIndices[1].resize(n);
+		mHistogram.resize(256 * param.numGroups);
+
+		uint32_t level = 0;
+		for (uint32_t num = 256 * param.numGroups; ; num = RadixScanBlockNumber(num))
+		{
+			mBlockSums[level].resize(RadixScanBlockNumber(num));
+			if (RadixScanBlockNumber(num) == 1)
+				break;
+
+			level++;
+		}
+
+		dim3 groupSize;
+		groupSize.x = param.numGroups;
+
+		// push constants are captured when a kernel is recorded, so the same constant is reused for every kernel
+		VkConstant<RadixSortParameters> constParam;
+		constParam.setValue(param);
+
+		mRecorder->begin();
+
+		mRadixEncode->flush(groupSize, &keys, &mWords[0], &mIndices[0], &constParam);
+
+		if (segmentPasses > 0)
+		{
+			param.word = keyWords;
+			constParam.setValue(param);
+			mRadixSegments->flush(groupSize, segmentOffsets, &mWords[0], &constParam);
+		}
+
+		uint32_t cur = 0;
+		auto pass = [&](uint32_t word, uint32_t shift) {
+			param.word = word;
+			param.shift = shift;
+			constParam.setValue(param);
+
+			mRadixHistogram->flush(groupSize, &mWords[cur], &mHistogram, &constParam);
+			recordScan(0, 256 * param.numGroups);
+			mRadixScatter->flush(groupSize, &mWords[cur], &mIndices[cur], &mWords[1 - cur], &mIndices[1 - cur], &mHistogram, &constParam);
+
+			cur = 1 - cur;
+		};
+
+		for (uint32_t w = 0; w < keyWords; w++)
+		{
+			for (uint32_t shift = 0; shift < 32; shift += 8)
+				pass(w, shift);
+		}
+
+		for (uint32_t p = 0; p < segmentPasses; p++)
+			pass(keyWords, 8 * p);
+
+		param.word = 0;
+		param.shift = 0;
+		constParam.setValue(param);
+		mRadixDecode->flush(groupSize, &mWords[cur], &keys, &constParam);
+
+		return cur;
+	}
+
+	template<typename T>
+	template<typename V>
+	void VkSort<T>::recordGather(VkDeviceArray<V>& values, VkDeviceArray<V>& source, uint32_t sorted)
+	{
+		static_assert(sizeof(V) % sizeof(uint32_t) == 0, "the size of values must be a multiple of 4 bytes");
+
+		RadixSortParameters param = {};
+		param.n = values.size();
+		param.stride = sizeof(V) / sizeof(uint32_t);
+
+		VkConstant<RadixSortParameters> constParam;
+		constParam.setValue(param);
+
+		mRadixGather->flush(vkDispatchSize(param.n * param.stride, 256), &source, &mIndices[sorted], &values, &constParam);
+	}
+
+	template<typename T>
+	void VkSort<T>::radix_sort(std::vector<T>& keys, uint32_t SortType)
+	{
+		VkDeviceArray<T> kArray;
+		kArray.resize(keys.size());
+		vkTransfer(kArray, keys);
+
+		radix_sort(kArray, SortType);
+
+		vkTransfer(keys, kArray);
+		kArray.clear();
+	}
+
+	template<typename T>
+	void VkSort<T>::radix_sort(VkDeviceArray<T>& keys, uint32_t SortType)
+	{
+		if (keys.size() == 0)
+			return;
+
+		recordRadixSort(keys, nullptr, SortType);
+		mRecorder->end();
+	}
+
+	template<typename T>
+	template<typename V>
+	void VkSort<T>::radix_sort_by_key(std::vector<T>& keys, std::vector<V>& values, uint32_t SortType)
+	{
+		assert(keys.size() == values.size());
+
+		VkDeviceArray<T> kArray;
+		kArray.resize(keys.size());
+		vkTransfer(kArray, keys);
+
+		VkDeviceArray<V> vArray;
+		vArray.resize(values.size());
+		vkTransfer(vArray, values);
+
+		radix_sort_by_key(kArray, vArray, SortType);
+
+		vkTransfer(keys, kArray);
+		vkTransfer(values, vArray);
+
+		kArray.clear();
+		vArray.clear();
+	}
+
+	template<typename T>
+	template<typename V>
+	void VkSort<T>::radix_sort_by_key(VkDeviceArray<T>& keys, VkDeviceArray<V>& values, uint32_t SortType)
+	{
+		assert(keys.size() == values.size());
+		if (keys.size() == 0)
+			return;
+
+		// the values are gathered from a copy, transfers cannot be recorded
+		VkDeviceArray<V> source;
+		source.resize(values.size());
+		vkTransfer(source, values);
+
+		uint32_t sorted = recordRadixSort(keys, nullptr, SortType);
+		recordGather(values, source, sorted);
+		mRecorder->end();
+
+		source.clear();
+	}
+
+	template<typename T>
+	void VkSort<T>::segmented_sort(VkDeviceArray<T>& keys, VkDeviceArray<uint32_t>& segmentOffsets, uint32_t SortType)
+	{
+		if (keys.size() == 0)
+			return;
+
+		recordRadixSort(keys, &segmentOffsets, SortType);
+		mRecorder->end();
+	}
+
+	template<typename T>
+	template<typename V>
+	void VkSort<T>::segmented_sort_by_key(VkDeviceArray<T>& keys, VkDeviceArray<V>& values, VkDeviceArray<uint32_t>& segmentOffsets, uint32_t SortType)
+	{
+		assert(keys.size() == values.size());
+		if (keys.size() == 0)
+			return;
+
+		VkDeviceArray<V> source;
+		source.resize(values.size());
+		vkTransfer(source, values);
+
+		uint32_t sorted = recordRadixSort(keys, &segmentOffsets, SortType);
+		recordGather(values, source, sorted);
+		mRecorder->end();
+
+		source.clear();
+	}
+
 	template<typename T>
 	VkSort<T>::VkSort() {
 
@@ -257,13 +486,91 @@ namespace dyno {
 			BUFFER(T),
 			BUFFER(T));
 
-		mSortKernel->load(getDynamicSpvFile<T>("shaders/glsl/core/Sort.comp.spv"));
-		mSortByKeyKernel->load(getDynamicSpvFile<T>("shaders/glsl/core/SortByKey.comp.spv"));
+		// the bitonic sort kernels only exist for 32-bit types
+		if (sizeof(T) == sizeof(uint32_t)) {
+			mSortKernel->load(getDynamicSpvFile<T>("shaders/glsl/core/Sort.comp.spv"));
+			mSortByKeyKernel->load(getDynamicSpvFile<T>("shaders/glsl/core/SortByKey.comp.spv"));
+		}
+
+		mRadixEncode = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//keys
+			BUFFER(uint32_t),				//words
+			BUFFER(uint32_t),				//indices
+			CONSTANT(RadixSortParameters));
+
+		mRadixDecode = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//words
+			BUFFER(uint32_t),				//keys
+			CONSTANT(RadixSortParameters));
+
+		mRadixHistogram = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//words
+			BUFFER(uint32_t),				//histogram
+			CONSTANT(RadixSortParameters));
+
+		mRadixScan = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//counts
+			BUFFER(uint32_t),				//block sums
+			CONSTANT(uint32_t));
+
+		mRadixScanAdd = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//block sums
+			BUFFER(uint32_t),				//counts
+			CONSTANT(uint32_t));
+
+		mRadixScatter = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//words in
+			BUFFER(uint32_t),				//indices in
+			BUFFER(uint32_t),				//words out
+			BUFFER(uint32_t),				//indices out
+			BUFFER(uint32_t),				//histogram
+			CONSTANT(RadixSortParameters));
+
+		mRadixGather = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//source
+			BUFFER(uint32_t),				//indices
+			BUFFER(uint32_t),				//destination
+			CONSTANT(RadixSortParameters));
+
+		mRadixSegments = std::make_shared<VkProgram>(
+			BUFFER(uint32_t),				//segment offsets
+			BUFFER(uint32_t),				//words
+			CONSTANT(RadixSortParameters));
+
+		mRadixEncode->load(getShaderPath() + "RadixSortEncode.comp.spv");
+		mRadixDecode->load(getShaderPath() + "RadixSortDecode.comp.spv");
+		mRadixHistogram->load(getShaderPath() + "RadixSortHistogram.comp.spv");
+		mRadixScan->load(getShaderPath() + "RadixSortScan.comp.spv");
+		mRadixScanAdd->load(getShaderPath() + "RadixSortScanAdd.comp.spv");
+		mRadixScatter->load(getShaderPath() + "RadixSortScatter.comp.spv");
+		mRadixGather->load(getShaderPath() + "RadixSortGather.comp.spv");
+		mRadixSegments->load(getShaderPath() + "RadixSortSegments.comp.spv");
+
+		mRecorder = std::make_shared<VkCommandRecorder>();
 	}
 
 	template<typename T>
 	VkSort<T>::~VkSort() {
 		mSortKernel = nullptr;
 		mSortByKeyKernel = nullptr;
+
+		mRadixEncode = nullptr;
+		mRadixDecode = nullptr;
+		mRadixHistogram = nullptr;
+		mRadixScan = nullptr;
+		mRadixScanAdd = nullptr;
+		mRadixScatter = nullptr;
+		mRadixGather = nullptr;
+		mRadixSegments = nullptr;
+
+		mWords[0].clear();
+		mWords[1].clear();
+		mIndices[0].clear();
+		mIndices[1].clear();
+		mHistogram.clear();
+		for (auto& sums : mBlockSums)
+			sums.clear();
+
+		mRecorder = nullptr;
 	}
 }
@@ -0,0 +1,241 @@
+#include "VkCommandRecorder.h"
+#include "VkSystem.h"
+#include "VulkanTools.h"
+
+#include <assert.h>
+#include <atomic>
+
+namespace dyno {
+
+	static thread_local VkCommandRecorder* sCurrentRecorder = nullptr;
+
+	static std::atomic<bool> sSynchronous(false);
+
+	//Capacity of each descriptor pool
+	const uint32_t RECORDER_MAX_SETS = 256;
+	const uint32_t RECORDER_MAX_BUFFERS_PER_SET = 16;
+	const uint32_t RECORDER_MAX_UNIFORMS_PER_SET = 8;
+
+	VkCommandRecorder::VkCommandRecorder()
+	{
+		ctx = VkSystem::instance()->currentContext();
+
+		VkCommandPoolCreateInfo cmdPoolInfo = {};
+		cmdPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		cmdPoolInfo.queueFamilyIndex = ctx->queueFamilyIndices.compute;
+		cmdPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+		VK_CHECK_RESULT(vkCreateCommandPool(ctx->deviceHandle(), &cmdPoolInfo, nullptr, &mCommandPool));
+
+		VkCommandBufferAllocateInfo cmdBufAllocateInfo =
+			vks::initializers::commandBufferAllocateInfo(mCommandPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1);
+		VK_CHECK_RESULT(vkAllocateCommandBuffers(ctx->deviceHandle(), &cmdBufAllocateInfo, &mCommandBuffer));
+
+		VkFenceCreateInfo fenceInfo = vks::initializers::fenceCreateInfo(VK_FLAGS_NONE);
+		VK_CHECK_RESULT(vkCreateFence(ctx->deviceHandle(), &fenceInfo, nullptr, &mFence));
+
+		vkGetDeviceQueue(ctx->deviceHandle(), ctx->queueFamilyIndices.compute, 0, &mQueue);
+	}
+
+	VkCommandRecorder::~VkCommandRecorder()
+	{
+		if (mRecording)
+			this->end();
+
+		for (auto pool : mDescriptorPools)
+			vkDestroyDescriptorPool(ctx->deviceHandle(), pool, nullptr);
+		mDescriptorPools.clear();
+
+		vkDestroyFence(ctx->deviceHandle(), mFence, nullptr);
+		vkDestroyCommandPool(ctx->deviceHandle(), mCommandPool, nullptr);
+	}
+
+	void VkCommandRecorder::begin()
+	{
+		assert(!mRecording);
+
+		mPrevious = sCurrentRecorder;
+		sCurrentRecorder = this;
+
+		mRecording = true;
+		mDispatchNumber = 0;
+		mBarrierNumber = 0;
+
+		this->beginCommandBuffer();
+	}
+
+	void VkCommandRecorder::end()
+	{
+		assert(mRecording && sCurrentRecorder == this);
+
+		this->submit();
+
+		sCurrentRecorder = mPrevious;
+		mPrevious = nullptr;
+
+		mRecording = false;
+	}
+
+	void VkCommandRecorder::dispatch(
+		VkPipeline pipeline,
+		VkPipelineLayout pipelineLayout,
+		VkDescriptorSetLayout descriptorSetLayout,
+		const std::vector<VkVariable*>& args,
+		uint32_t groupX,
+		uint32_t groupY,
+		uint32_t groupZ)
+	{
+		assert(mRecording);
+
+		VkDescriptorSet descriptorSet = this->allocateDescriptorSet(descriptorSetLayout);
+
+		bool hazard = false;
+		std::vector<VkWriteDescriptorSet> writeDescriptorSets;
+		for (size_t i = 0; i < args.size(); i++)
+		{
+			auto variable = args[i];
+			if (variable->type() == VariableType::DeviceBuffer && variable->bufferSize() > 0)
+			{
+				writeDescriptorSets.push_back(
+					vks::initializers::writeDescriptorSet(descriptorSet, VkVariable::descriptorType(variable->type()), i, &variable->getDescriptor()));
+
+				hazard = hazard || mPendingBuffers.count(variable->bufferHandle()) > 0;
+			}
+			else if (variable->type() == VariableType::Uniform)
+			{
+				writeDescriptorSets.push_back(
+					vks::initializers::writeDescriptorSet(descriptorSet, VkVariable::descriptorType(variable->type()), i, &variable->getDescriptor()));
+			}
+		}
+		vkUpdateDescriptorSets(ctx->deviceHandle(), static_cast<uint32_t>(writeDescriptorSets.size()), writeDescriptorSets.data(), 0, NULL);
+
+		// Kernels do not declare which buffers they write, any buffer shared with an earlier dispatch is treated as a dependency
+		if (hazard)
+		{
+			VkMemoryBarrier memoryBarrier = vks::initializers::memoryBarrier();
+			memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+			memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+			vkCmdPipelineBarrier(
+				mCommandBuffer,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_FLAGS_NONE,
+				1, &memoryBarrier,
+				0, nullptr,
+				0, nullptr);
+
+			mPendingBuffers.clear();
+			mBarrierNumber++;
+		}
+
+		for (size_t i = 0; i < args.size(); i++)
+		{
+			if (args[i]->type() == VariableType::DeviceBuffer && args[i]->bufferSize() > 0)
+				mPendingBuffers.insert(args[i]->bufferHandle());
+		}
+
+		vkCmdBindPipeline(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+		vkCmdBindDescriptorSets(mCommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &descriptorSet, 0, 0);
+
+		uint32_t offset = 0;
+		for (size_t i = 0; i < args.size(); i++)
+		{
+			auto variable = args[i];
+			if (variable->type() == VariableType::Constant) {
+				vkCmdPushConstants(mCommandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, offset, variable->bufferSize(), variable->data());
+				offset += variable->bufferSize();
+			}
+		}
+
+		vkCmdDispatch(mCommandBuffer, groupX, groupY, groupZ);
+
+		mDispatchNumber++;
+		mEmpty = false;
+
+		if (sSynchronous)
+		{
+			this->submit();
+			this->beginCommandBuffer();
+		}
+	}
+
+	VkCommandRecorder* VkCommandRecorder::current()
+	{
+		return sCurrentRecorder;
+	}
+
+	void VkCommandRecorder::setSynchronous(bool sync)
+	{
+		sSynchronous = sync;
+	}
+
+	bool VkCommandRecorder::isSynchronous()
+	{
+		return sSynchronous;
+	}
+
+	void VkCommandRecorder::beginCommandBuffer()
+	{
+		VkCommandBufferBeginInfo cmdBufInfo = vks::initializers::commandBufferBeginInfo();
+		cmdBufInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+		VK_CHECK_RESULT(vkBeginCommandBuffer(mCommandBuffer, &cmdBufInfo));
+
+		mPendingBuffers.clear();
+		mEmpty = true;
+	}
+
+	void VkCommandRecorder::submit()
+	{
+		VK_CHECK_RESULT(vkEndCommandBuffer(mCommandBuffer));
+
+		if (!mEmpty)
+		{
+			VK_CHECK_RESULT(vkResetFences(ctx->deviceHandle(), 1, &mFence));
+
+			VkSubmitInfo submitInfo = vks::initializers::submitInfo();
+			submitInfo.commandBufferCount = 1;
+			submitInfo.pCommandBuffers = &mCommandBuffer;
+
+			VK_CHECK_RESULT(vkQueueSubmit(mQueue, 1, &submitInfo, mFence));
+			VK_CHECK_RESULT(vkWaitForFences(ctx->deviceHandle(), 1, &mFence, VK_TRUE, UINT64_MAX));
+		}
+
+		// The descriptor sets are no longer in use once the fence is signaled
+		for (size_t i = 0; i <= mPoolIndex && i < mDescriptorPools.size(); i++)
+			vkResetDescriptorPool(ctx->deviceHandle(), mDescriptorPools[i], 0);
+		mPoolIndex = 0;
+
+		vkResetCommandBuffer(mCommandBuffer, 0);
+	}
+
+	VkDescriptorSet VkCommandRecorder::allocateDescriptorSet(VkDescriptorSetLayout layout)
+	{
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+		while (true)
+		{
+			if (mPoolIndex == mDescriptorPools.size())
+			{
+				std::vector<VkDescriptorPoolSize> poolSizes;
+				poolSizes.push_back(vks::initializers::descriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, RECORDER_MAX_SETS * RECORDER_MAX_BUFFERS_PER_SET));
+				poolSizes.push_back(vks::initializers::descriptorPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, RECORDER_MAX_SETS * RECORDER_MAX_UNIFORMS_PER_SET));
+
+				VkDescriptorPoolCreateInfo descriptorPoolInfo =
+					vks::initializers::descriptorPoolCreateInfo(poolSizes, RECORDER_MAX_SETS);
+
+				VkDescriptorPool pool;
+				VK_CHECK_RESULT(vkCreateDescriptorPool(ctx->deviceHandle(), &descriptorPoolInfo, nullptr, &pool));
+				mDescriptorPools.push_back(pool);
+			}
+
+			VkDescriptorSetAllocateInfo allocInfo =
+				vks::initializers::descriptorSetAllocateInfo(mDescriptorPools[mPoolIndex], &layout, 1);
+
+			if (vkAllocateDescriptorSets(ctx->deviceHandle(), &allocInfo, &descriptorSet) == VK_SUCCESS)
+				return descriptorSet;
+
+			// The pool is exhausted, continue with the next one
+			mPoolIndex++;
+		}
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "VkContext.h"
+#include "VkVariable.h"
+
+#include <set>
+#include <vector>
+
+namespace dyno {
+
+	/*!
+	 *	\class	VkCommandRecorder
+	 *	\brief	Collects the dispatches of several programs into one command buffer that is submitted once.
+	 *
+	 *	Between begin() and end(), VkProgram::flush() on the same thread records its dispatch instead of submitting it and waiting for it.
+	 *	Each dispatch gets its own descriptor set, so the same program can be recorded several times with different arguments.
+	 *	A barrier is inserted only in front of a dispatch that binds a buffer used by an earlier dispatch since the last barrier.
+	 *
+	 *	Nothing recorded has been executed before end() returns: reading results back to the host, resizing arrays from device counts
+	 *	and changing the value of a bound uniform have to happen outside of a recording. Push constants are captured when recorded.
+	 */
+	class VkCommandRecorder
+	{
+	public:
+		VkCommandRecorder();
+		~VkCommandRecorder();
+
+		/*!
+		 *	\brief	Start recording, recorders may be nested, the innermost one is used.
+		 */
+		void begin();
+
+		/*!
+		 *	\brief	Submit all recorded dispatches with a single fence and wait for them to finish.
+		 */
+		void end();
+
+		bool isRecording() const { return mRecording; }
+
+		/*!
+		 *	\brief	Record a dispatch, normally called by VkProgram::flush().
+		 */
+		void dispatch(
+			VkPipeline pipeline,
+			VkPipelineLayout pipelineLayout,
+			VkDescriptorSetLayout descriptorSetLayout,
+			const std::vector<VkVariable*>& args,
+			uint32_t groupX,
+			uint32_t groupY,
+			uint32_t groupZ);
+
+		uint32_t dispatchNumber() const { return mDispatchNumber; }
+		uint32_t barrierNumber() const { return mBarrierNumber; }
+
+		/*!
+		 *	\brief	The recording recorder of the calling thread, nullptr if there is none.
+		 */
+		static VkCommandRecorder* current();
+
+		/*!
+		 *	\brief	Submit and wait after every dispatch of all recorders, to locate a failing kernel while debugging.
+		 */
+		static void setSynchronous(bool sync);
+		static bool isSynchronous();
+
+	private:
+		void beginCommandBuffer();
+		void submit();
+
+		VkDescriptorSet allocateDescriptorSet(VkDescriptorSetLayout layout);
+
+		VkContext* ctx = nullptr;
+
+		VkQueue mQueue = VK_NULL_HANDLE;
+		VkCommandPool mCommandPool = VK_NULL_HANDLE;
+		VkCommandBuffer mCommandBuffer = VK_NULL_HANDLE;
+		VkFence mFence = VK_NULL_HANDLE;
+
+		//Descriptor pools are added when the recorded sets exceed the capacity and reset after each submission
+		std::vector<VkDescriptorPool> mDescriptorPools;
+		size_t mPoolIndex = 0;
+
+		//Buffers bound since the last barrier
+		std::set<VkBuffer> mPendingBuffers;
+
+		VkCommandRecorder* mPrevious = nullptr;
+
+		bool mRecording = false;
+		bool mEmpty = true;
+
+		uint32_t mDispatchNumber = 0;
+		uint32_t mBarrierNumber = 0;
+	};
+}
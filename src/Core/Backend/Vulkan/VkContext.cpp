@@ -3,7 +3,27 @@
 #define VMA_IMPLEMENTATION
 #include "VulkanMemoryAllocator/include/vk_mem_alloc.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 namespace dyno {
+	//Layout of the pipeline cache file, the data returned by vkGetPipelineCacheData follows the header
+	struct PipelineCacheFileHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t vendorID;
+		uint32_t deviceID;
+		uint32_t driverVersion;
+		uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+		uint64_t dataSize;
+	};
+
+	//"PDPC"
+	const uint32_t PIPELINE_CACHE_MAGIC = 0x43504450;
+	const uint32_t PIPELINE_CACHE_VERSION = 1;
+
 	/**
 * Default constructor
 *
@@ -51,6 +71,23 @@ namespace dyno {
 	*/
 	VkContext::~VkContext()
 	{
+		if (pipelineCache != VK_NULL_HANDLE)
+		{
+			savePipelineCache();
+		}
+
+		for (auto& entry : computePipelines)
+		{
+			vkDestroyPipeline(logicalDevice, entry.second.pipeline, nullptr);
+			vkDestroyPipelineLayout(logicalDevice, entry.second.layout, nullptr);
+		}
+		computePipelines.clear();
+
+		if (pipelineCache != VK_NULL_HANDLE)
+		{
+			vkDestroyPipelineCache(logicalDevice, pipelineCache, nullptr);
+		}
+
 	    for (const auto &pool : poolMap)
         {
 	        vmaDestroyPool(g_Allocator, pool.second.pool);
@@ -326,9 +363,145 @@ namespace dyno {
 
 	void VkContext::createPipelineCache()
 	{
+		std::vector<char> data;
+		bool found = readPipelineCacheFile(data);
+
 		VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
 		pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-		VK_CHECK_RESULT(vkCreatePipelineCache(logicalDevice, &pipelineCacheCreateInfo, nullptr, &pipelineCache));
+		pipelineCacheCreateInfo.initialDataSize = found ? data.size() : 0;
+		pipelineCacheCreateInfo.pInitialData = found ? data.data() : nullptr;
+
+		// Drivers may still reject data they have written themselves, start with an empty cache in that case
+		if (vkCreatePipelineCache(logicalDevice, &pipelineCacheCreateInfo, nullptr, &pipelineCache) != VK_SUCCESS)
+		{
+			pipelineCacheCreateInfo.initialDataSize = 0;
+			pipelineCacheCreateInfo.pInitialData = nullptr;
+			VK_CHECK_RESULT(vkCreatePipelineCache(logicalDevice, &pipelineCacheCreateInfo, nullptr, &pipelineCache));
+		}
+	}
+
+	bool VkContext::savePipelineCache()
+	{
+		size_t dataSize = 0;
+		if (vkGetPipelineCacheData(logicalDevice, pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+			return false;
+
+		std::vector<char> data(dataSize);
+		if (vkGetPipelineCacheData(logicalDevice, pipelineCache, &dataSize, data.data()) != VK_SUCCESS)
+			return false;
+
+		PipelineCacheFileHeader header = {};
+		header.magic = PIPELINE_CACHE_MAGIC;
+		header.version = PIPELINE_CACHE_VERSION;
+		header.vendorID = properties.vendorID;
+		header.deviceID = properties.deviceID;
+		header.driverVersion = properties.driverVersion;
+		memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+		header.dataSize = dataSize;
+
+		// Write to a temporary file first so that a crash never leaves a truncated cache behind
+		std::string fileName = pipelineCacheFile();
+		std::string tmpName = fileName + ".tmp";
+		{
+			std::ofstream output(tmpName, std::ios::binary | std::ios::trunc);
+			if (!output.is_open())
+				return false;
+
+			output.write(reinterpret_cast<const char*>(&header), sizeof(PipelineCacheFileHeader));
+			output.write(data.data(), dataSize);
+
+			if (!output.good())
+				return false;
+		}
+
+		std::remove(fileName.c_str());
+		return std::rename(tmpName.c_str(), fileName.c_str()) == 0;
+	}
+
+	bool VkContext::readPipelineCacheFile(std::vector<char>& data)
+	{
+		std::ifstream input(pipelineCacheFile(), std::ios::binary);
+		if (!input.is_open())
+			return false;
+
+		PipelineCacheFileHeader header;
+		input.read(reinterpret_cast<char*>(&header), sizeof(PipelineCacheFileHeader));
+		if (!input.good())
+			return false;
+
+		if (header.magic != PIPELINE_CACHE_MAGIC
+			|| header.version != PIPELINE_CACHE_VERSION
+			|| header.vendorID != properties.vendorID
+			|| header.deviceID != properties.deviceID
+			|| header.driverVersion != properties.driverVersion
+			|| memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0
+			|| header.dataSize == 0)
+		{
+			return false;
+		}
+
+		data.resize(header.dataSize);
+		input.read(data.data(), header.dataSize);
+		if ((uint64_t)input.gcount() != header.dataSize)
+		{
+			data.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string VkContext::pipelineCacheFile()
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "pipeline_cache_%x_%x.bin", properties.vendorID, properties.deviceID);
+
+		if (pipelineCacheDirectory.empty())
+			return std::string(name);
+
+		char last = pipelineCacheDirectory.back();
+		return last == '/' || last == '\\' ? pipelineCacheDirectory + name : pipelineCacheDirectory + "/" + name;
+	}
+
+	bool VkContext::findComputePipeline(const std::string& key, VkPipelineLayout& layout, VkPipeline& pipeline)
+	{
+		std::lock_guard<std::mutex> lock(pipelineMutex);
+
+		auto it = computePipelines.find(key);
+		if (it == computePipelines.end())
+			return false;
+
+		layout = it->second.layout;
+		pipeline = it->second.pipeline;
+
+		return true;
+	}
+
+	void VkContext::addComputePipeline(const std::string& key, VkPipelineLayout& layout, VkPipeline& pipeline)
+	{
+		std::lock_guard<std::mutex> lock(pipelineMutex);
+
+		auto it = computePipelines.find(key);
+		if (it != computePipelines.end())
+		{
+			vkDestroyPipeline(logicalDevice, pipeline, nullptr);
+			vkDestroyPipelineLayout(logicalDevice, layout, nullptr);
+
+			layout = it->second.layout;
+			pipeline = it->second.pipeline;
+			return;
+		}
+
+		ComputePipeline entry;
+		entry.layout = layout;
+		entry.pipeline = pipeline;
+		computePipelines[key] = entry;
+	}
+
+	size_t VkContext::computePipelineNumber()
+	{
+		std::lock_guard<std::mutex> lock(pipelineMutex);
+		return computePipelines.size();
 	}
 
 	/**
@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <exception>
 #include <map>
+#include <mutex>
 
 VK_DEFINE_HANDLE(VmaAllocator)
 VK_DEFINE_HANDLE(VmaPool)
@@ -21,8 +22,41 @@ namespace dyno {
 
 		VkResult createLogicalDevice(VkPhysicalDeviceFeatures enabledFeatures, std::vector<const char *> enabledExtensions, void *pNextChain, bool useSwapChain = true, VkQueueFlags requestedQueueTypes = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
 
+		/**
+		 * @brief Create the pipeline cache, initialized with the cache file of the last run if it was written by the same device and driver
+		 */
 		void createPipelineCache();
 
+		/**
+		 * @brief Write the pipeline cache to pipelineCacheFile(), called when the context is destroyed
+		 */
+		bool savePipelineCache();
+
+		/**
+		 * @brief Read the pipeline cache file, fails if it is missing or was written by another device, driver or cache version
+		 */
+		bool readPipelineCacheFile(std::vector<char>& data);
+
+		/**
+		 * @brief The cache file is named after the vendor and device ids and located in pipelineCacheDirectory
+		 */
+		std::string pipelineCacheFile();
+
+		/**
+		 * @brief Look up a compute pipeline shared by all programs of this context
+		 *
+		 * @param key identifies the shader and the pipeline layout
+		 */
+		bool findComputePipeline(const std::string& key, VkPipelineLayout& layout, VkPipeline& pipeline);
+
+		/**
+		 * @brief Register a compute pipeline, the context takes the ownership of both handles.
+		 *	If another thread has registered the same key in the meantime, the given handles are destroyed and the registered ones are returned instead.
+		 */
+		void addComputePipeline(const std::string& key, VkPipelineLayout& layout, VkPipeline& pipeline);
+
+		size_t computePipelineNumber();
+
 		inline	VkDevice		deviceHandle() { return logicalDevice; }
 		inline	VkQueue			graphicsQueueHandle() { return graphicsQueue; }
 		inline	VkQueue			computeQueueHandle() { return computeQueue; }
@@ -78,7 +112,10 @@ namespace dyno {
 		/** @brief Contains queue family indices */
 
 		// Pipeline cache object
-		VkPipelineCache pipelineCache;
+		VkPipelineCache pipelineCache = VK_NULL_HANDLE;
+
+		/** @brief Directory of the pipeline cache file, the working directory if empty */
+		std::string pipelineCacheDirectory;
 
 		struct
 		{
@@ -108,5 +145,15 @@ namespace dyno {
 		std::map<VkFlags, MemoryPoolInfo> poolMap;
 		VmaAllocator g_Allocator;
 		bool useMemoryPool = false;
+
+	private:
+		struct ComputePipeline
+		{
+			VkPipelineLayout layout;
+			VkPipeline pipeline;
+		};
+
+		std::mutex pipelineMutex;
+		std::map<std::string, ComputePipeline> computePipelines;
 	};
 }
\ No newline at end of file
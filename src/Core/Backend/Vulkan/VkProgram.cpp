@@ -12,12 +12,7 @@ namespace dyno
 		mUniformArgs.clear();
 		mConstArgs.clear();
 
-		for (auto& shderModule : shaderModules) {
-			vkDestroyShaderModule(ctx->deviceHandle(), shderModule, nullptr);
-		}
-
-		vkDestroyPipeline(ctx->deviceHandle(), pipeline, nullptr);
-		vkDestroyPipelineLayout(ctx->deviceHandle(), pipelineLayout, nullptr);
+		//The pipeline and its layout are owned by the context
 		vkDestroyDescriptorSetLayout(ctx->deviceHandle(), descriptorSetLayout, nullptr);
 		vkDestroyDescriptorPool(ctx->deviceHandle(), descriptorPool, nullptr);
 
@@ -55,6 +50,19 @@ namespace dyno
 		addComputeToComputeBarriers(mCommandBuffers);
 	}
 
+	void VkProgram::record(VkCommandRecorder* recorder, dim3 groupSize, std::vector<VkVariable*>& args)
+	{
+#ifndef NDEBUG
+		assert(mFormalParamters.size() == args.size());
+		for (std::size_t i = 0; i < args.size(); i++)
+		{
+			assert(mFormalParamters[i]->type() == args[i]->type());
+		}
+#endif // !NDEBUG
+
+		recorder->dispatch(pipeline, pipelineLayout, descriptorSetLayout, args, groupSize.x, groupSize.y, groupSize.z);
+	}
+
 	void VkProgram::end()
 	{
 		vkEndCommandBuffer(mCommandBuffers);
@@ -200,6 +208,11 @@ namespace dyno
 
 	bool VkProgram::load(std::string fileName)
 	{
+		//Programs loading the same shader with identical layouts share one pipeline
+		std::string key = fileName + "#" + this->layoutSignature();
+		if (ctx->findComputePipeline(key, pipelineLayout, pipeline))
+			return true;
+
 		//Create pipeline layout
 		std::vector<VkPushConstantRange> pushConstantRanges;
 		for (size_t i = 0; i < mFormalConstants.size(); i++)
@@ -214,14 +227,51 @@ namespace dyno
 
 		VK_CHECK_RESULT(vkCreatePipelineLayout(ctx->deviceHandle(), &pipelineLayoutCreateInfo, nullptr, &pipelineLayout));
 
-		// Create pipeline
+		// Create pipeline, the shader module is no longer needed afterwards
 		VkComputePipelineCreateInfo computePipelineCreateInfo = vks::initializers::computePipelineCreateInfo(pipelineLayout, 0);
 		computePipelineCreateInfo.stage = this->createComputeStage(fileName);
 		VK_CHECK_RESULT(vkCreateComputePipelines(ctx->deviceHandle(), ctx->pipelineCacheHandle(), 1, &computePipelineCreateInfo, nullptr, &pipeline));
 
+		vkDestroyShaderModule(ctx->deviceHandle(), computePipelineCreateInfo.stage.module, nullptr);
+
+		ctx->addComputePipeline(key, pipelineLayout, pipeline);
+
 		return true;
 	}
 
+	std::string VkProgram::layoutSignature()
+	{
+		//Descriptor set layouts built from the same parameter types are identically defined and thus compatible
+		std::string signature;
+		for (size_t i = 0; i < mFormalParamters.size(); i++)
+		{
+			switch (mFormalParamters[i]->type())
+			{
+			case VariableType::DeviceBuffer:
+				signature += "b";
+				break;
+			case VariableType::Uniform:
+				signature += "u";
+				break;
+			case VariableType::Constant:
+				signature += "c" + std::to_string(mFormalParamters[i]->bufferSize());
+				break;
+			default:
+				signature += "x";
+				break;
+			}
+		}
+
+		//Push constant ranges are part of the pipeline layout as well
+		signature += "#";
+		for (size_t i = 0; i < mFormalConstants.size(); i++)
+		{
+			signature += "p" + std::to_string(mFormalConstants[i]->bufferSize()) + ":" + std::to_string(i);
+		}
+
+		return signature;
+	}
+
 	VkPipelineShaderStageCreateInfo VkProgram::createComputeStage(std::string fileName)
 	{
 		VkPipelineShaderStageCreateInfo shaderStage = {};
@@ -230,7 +280,6 @@ namespace dyno
 		shaderStage.module = vks::tools::loadShaderModule(fileName, ctx->deviceHandle());
 		shaderStage.pName = "main";
 		assert(shaderStage.module != VK_NULL_HANDLE);
-		shaderModules.push_back(shaderStage.module);
 		return shaderStage;
 	}
 
@@ -6,6 +6,7 @@
 #include "VkDeviceArray3D.h"
 #include "VkUniform.h"
 #include "VkConstant.h"
+#include "VkCommandRecorder.h"
 #include <memory>
 #include <map>
 
@@ -129,8 +130,18 @@ namespace dyno {
 
 		void wait();
 
+		/**
+		 * @brief Execute the program and wait for it to finish, inside VkCommandRecorder::begin()/end() the dispatch is recorded instead
+		 */
 		template<typename... Args>
 		void flush(dim3 groupSize, Args... args) {
+			VkCommandRecorder* recorder = VkCommandRecorder::current();
+			if (recorder != nullptr) {
+				std::vector<VkVariable*> vars{ args... };
+				this->record(recorder, groupSize, vars);
+				return;
+			}
+
 			this->begin();
 			this->enqueue(groupSize, args...);
 			this->end();
@@ -139,6 +150,9 @@ namespace dyno {
 			this->wait();
 		}
 
+		/**
+		 * @brief Create the compute pipeline from a SPIR-V file, or reuse the one created by another program on the same context
+		 */
 		bool load(std::string fileName);
         void addMacro(std::string key, std::string value);
 
@@ -161,6 +175,8 @@ namespace dyno {
 		void restoreInherentCmdBuffer();
 
 	protected:
+		void record(VkCommandRecorder* recorder, dim3 groupSize, std::vector<VkVariable*>& args);
+
 		void pushFormalParameter(VkVariable* arg);
 		void pushFormalConstant(VkVariable* arg);
 
@@ -172,6 +188,8 @@ namespace dyno {
 	private:
 		VkPipelineShaderStageCreateInfo createComputeStage(std::string fileName);
 
+		std::string layoutSignature();
+
 		VkContext* ctx = nullptr;
 
 		std::vector<VkVariable*> mFormalParamters;
@@ -195,7 +213,6 @@ namespace dyno {
 		VkCommandBuffer mCommandBuffers = VK_NULL_HANDLE;
 
 		VkCommandBuffer mCmdBufferCopy = VK_NULL_HANDLE;
-		std::vector<VkShaderModule> shaderModules;
 	};
 
 	template<typename... Args>
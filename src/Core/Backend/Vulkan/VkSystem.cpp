@@ -123,6 +123,7 @@ namespace dyno {
 		// This is handled by a separate class that gets a logical device representation
 		// and encapsulates functions related to a device
 		ctx = new VkContext(physicalDevice);
+		ctx->pipelineCacheDirectory = pipelineCacheDirectory;
 		VkResult res = ctx->createLogicalDevice(enabledFeatures, enabledDeviceExtensions, deviceCreatepNextChain);
 		if (res != VK_SUCCESS) {
 			vks::tools::exitFatal("Could not create Vulkan device: \n" + vks::tools::errorString(res), res);
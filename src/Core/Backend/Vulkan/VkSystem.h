@@ -38,6 +38,13 @@ namespace dyno
 			return physicalDevice;
 		}
 
+		/*!
+		 *	\brief	Directory the pipeline cache is read from and written to, must be set before initialize().
+		 */
+		void setPipelineCacheDirectory(std::string dir) {
+			pipelineCacheDirectory = dir;
+		}
+
 	private:
 		VkSystem();
 		~VkSystem();
@@ -56,6 +63,7 @@ namespace dyno
 		bool useMemoryPool = true;
 		std::string name = "Vulkan";
 		uint32_t apiVersion = VK_API_VERSION_1_2;
+		std::string pipelineCacheDirectory;
 
 		/*!
 		 *	\brief	Vulkan instance, stores all per-application states.
@@ -139,4 +139,4 @@ namespace dyno
 	};
 }
 
-#include "additiveCCD.inl"
\ No newline at end of file
+#include "AdditiveCCD.inl"
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+namespace dyno
+{
+	MappedFile::~MappedFile()
+	{
+		this->close();
+	}
+
+#ifdef _WIN32
+	bool MappedFile::open(const std::string& filename)
+	{
+		this->close();
+
+		HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		mFile = file;
+		mSize = (size_t)size.QuadPart;
+		mOpened = true;
+
+		// Empty files can not be mapped
+		if (mSize == 0)
+			return true;
+
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping == NULL)
+		{
+			this->close();
+			return false;
+		}
+		mMapping = mapping;
+
+		mData = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (mData == nullptr)
+		{
+			this->close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void MappedFile::close()
+	{
+		if (mData != nullptr)
+			UnmapViewOfFile(mData);
+
+		if (mMapping != nullptr)
+			CloseHandle((HANDLE)mMapping);
+
+		if (mFile != nullptr)
+			CloseHandle((HANDLE)mFile);
+
+		mData = nullptr;
+		mMapping = nullptr;
+		mFile = nullptr;
+		mSize = 0;
+		mOpened = false;
+	}
+#else
+	bool MappedFile::open(const std::string& filename)
+	{
+		this->close();
+
+		int fd = ::open(filename.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		if (fstat(fd, &st) != 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		mSize = (size_t)st.st_size;
+
+		// Empty files can not be mapped
+		if (mSize > 0)
+		{
+			void* ptr = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (ptr == MAP_FAILED)
+			{
+				::close(fd);
+				mSize = 0;
+				return false;
+			}
+
+			madvise(ptr, mSize, MADV_SEQUENTIAL);
+			mData = (const char*)ptr;
+		}
+
+		// The mapping stays valid after the descriptor is closed
+		::close(fd);
+
+		mOpened = true;
+
+		return true;
+	}
+
+	void MappedFile::close()
+	{
+		if (mData != nullptr)
+			munmap((void*)mData, mSize);
+
+		mData = nullptr;
+		mSize = 0;
+		mOpened = false;
+	}
+#endif
+}
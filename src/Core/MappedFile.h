@@ -0,0 +1,59 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Platform.h"
+
+#include <string>
+
+namespace dyno
+{
+	/**
+	 * @brief A read-only memory mapping of a whole file
+	 */
+	class MappedFile
+	{
+	public:
+		MappedFile() {};
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		/**
+		 * @brief Map the file into memory, the previously mapped file is closed
+		 *
+		 * @return false if the file does not exist or can not be mapped
+		 */
+		bool open(const std::string& filename);
+
+		void close();
+
+		inline bool isOpen() const { return mOpened; }
+
+		inline const char* data() const { return mData; }
+		inline size_t size() const { return mSize; }
+
+	private:
+		const char* mData = nullptr;
+		size_t mSize = 0;
+
+		bool mOpened = false;
+
+		// Only used on Windows, where the file and the mapping have to be kept open while the view is alive
+		void* mFile = nullptr;
+		void* mMapping = nullptr;
+	};
+}
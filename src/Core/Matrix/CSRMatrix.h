@@ -0,0 +1,161 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+#include "Vector.h"
+#include "Matrix.h"
+
+#include <map>
+#include <vector>
+#include <memory>
+
+namespace dyno
+{
+	/**
+	 * @brief Types of the entries of a CSRMatrix, N = 1 stores scalars, otherwise NxN blocks acting on N-dimensional vectors.
+	 */
+	template<typename Real, int N>
+	struct CSRBlock
+	{
+		typedef SquareMatrix<Real, N> Block;
+		typedef Vector<Real, N> Coord;
+	};
+
+	template<typename Real>
+	struct CSRBlock<Real, 1>
+	{
+		typedef Real Block;
+		typedef Real Coord;
+	};
+
+	/**
+	 * @brief A host-side sparse matrix in the compressed sparse row format, with N > 1 it is a block sparse row matrix of NxN blocks.
+	 *
+	 *	Column indices are sorted within each row. Products with the matrix are computed by the global ThreadPool,
+	 *	rows are split into chunks holding a similar number of nonzeros so that each task streams through a contiguous range of the arrays.
+	 *	Products with the transpose use an explicitly transposed copy which is built on first use,
+	 *	so that they are as cache friendly as the products with the matrix itself.
+	 */
+	template<typename Real, int N = 1>
+	class CSRMatrix
+	{
+	public:
+		typedef typename CSRBlock<Real, N>::Block Block;
+		typedef typename CSRBlock<Real, N>::Coord Coord;
+
+		struct Triplet
+		{
+			Triplet() {};
+			Triplet(uint r, uint c, const Block& v) : row(r), col(c), value(v) {};
+
+			uint row = 0;
+			uint col = 0;
+			Block value;
+		};
+
+		CSRMatrix() {};
+		~CSRMatrix() {};
+
+		void clear();
+
+		/**
+		 * @brief Assemble the matrix from triplets, entries sharing the same position are summed up.
+		 *	Rows are sorted in parallel.
+		 */
+		void assign(const uint rows, const uint cols, const std::vector<Triplet>& triplets);
+
+		/**
+		 * @brief Assemble the matrix from one map per row, the input format of SparseMatrix
+		 */
+		void assign(const std::vector<std::map<int, Block>>& rows, const uint cols);
+
+		inline uint rows() const { return mRows; }
+		inline uint cols() const { return mCols; }
+		inline uint nonZeros() const { return mIndices.size(); }
+
+		/**
+		 * @brief Offsets of rows into indices() and values(), contains rows() + 1 entries
+		 */
+		const CArray<uint>& offsets() const { return mOffsets; }
+		const CArray<uint>& indices() const { return mIndices; }
+		const CArray<Block>& values() const { return mValues; }
+
+		/**
+		 * @brief Return the entry at (i, j), zero if it is not stored
+		 */
+		Block entry(const uint i, const uint j) const;
+
+		/**
+		 * @brief Compute y = A * x
+		 */
+		void multiply(const CArray<Coord>& x, CArray<Coord>& y) const;
+
+		/**
+		 * @brief Compute y = A^T * x
+		 */
+		void multiplyTranspose(const CArray<Coord>& x, CArray<Coord>& y) const;
+
+		void transpose(CSRMatrix<Real, N>& t) const;
+
+		/**
+		 * @brief Solve A * x = b for a symmetric positive definite A with the conjugate gradient method, x holds the initial guess
+		 *
+		 * @return the number of iterations
+		 */
+		uint CG(const CArray<Coord>& b, CArray<Coord>& x, const uint maxIter, const Real threshold) const;
+
+		/**
+		 * @brief Solve the least squares problem min |A * x - b| with the conjugate gradient method on the normal equations
+		 *
+		 * @return the number of iterations
+		 */
+		uint CGLS(const CArray<Coord>& b, CArray<Coord>& x, const uint maxIter, const Real threshold) const;
+
+	private:
+		void buildChunks();
+
+		const CSRMatrix<Real, N>& transposed() const;
+
+		uint mRows = 0;
+		uint mCols = 0;
+
+		CArray<uint> mOffsets;
+		CArray<uint> mIndices;
+		CArray<Block> mValues;
+
+		//First rows of the chunks processed by one task, the last entry equals mRows
+		std::vector<uint> mChunks;
+
+		mutable std::shared_ptr<CSRMatrix<Real, N>> mTransposed;
+	};
+
+	template<typename Real>
+	using BSRMatrix3 = CSRMatrix<Real, 3>;
+
+	template<typename Real, int N>
+	void multiply_SM_by_vector(const CSRMatrix<Real, N>& matrix_a, const CArray<typename CSRMatrix<Real, N>::Coord>& a, CArray<typename CSRMatrix<Real, N>::Coord>& Aa)
+	{
+		matrix_a.multiply(a, Aa);
+	}
+
+	template<typename Real, int N>
+	void multiply_transposedSM_by_vector(const CSRMatrix<Real, N>& matrix_a, const CArray<typename CSRMatrix<Real, N>::Coord>& a, CArray<typename CSRMatrix<Real, N>::Coord>& Aa)
+	{
+		matrix_a.multiplyTranspose(a, Aa);
+	}
+}
+
+#include "CSRMatrix.inl"
@@ -0,0 +1,393 @@
+#include "ThreadPool.h"
+
+#include <cassert>
+#include <algorithm>
+
+namespace dyno
+{
+	//Number of nonzeros processed by one task
+	const uint CSR_CHUNK_NONZEROS = 16384;
+
+	//Number of vector entries processed by one task in vector operations
+	const uint CSR_CHUNK_ENTRIES = 16384;
+
+	inline float csrTranspose(const float& v) { return v; }
+	inline double csrTranspose(const double& v) { return v; }
+
+	template<typename Real, int N>
+	inline SquareMatrix<Real, N> csrTranspose(const SquareMatrix<Real, N>& m) { return m.transpose(); }
+
+	inline float csrDot(const float& a, const float& b) { return a * b; }
+	inline double csrDot(const double& a, const double& b) { return a * b; }
+
+	template<typename Real, int N>
+	inline Real csrDot(const Vector<Real, N>& a, const Vector<Real, N>& b) { return a.dot(b); }
+
+	template<typename Real, typename Coord>
+	Real csrDot(const CArray<Coord>& a, const CArray<Coord>& b)
+	{
+		uint num = a.size();
+		uint chunkNum = (num + CSR_CHUNK_ENTRIES - 1) / CSR_CHUNK_ENTRIES;
+
+		//Sum up partial results in a fixed order to keep the result deterministic
+		std::vector<Real> partial(chunkNum, Real(0));
+		ThreadPool::instance()->parallelFor(0, chunkNum, [&](uint c) {
+			uint last = std::min(num, (c + 1) * CSR_CHUNK_ENTRIES);
+
+			Real sum = Real(0);
+			for (uint i = c * CSR_CHUNK_ENTRIES; i < last; i++)
+				sum += csrDot(a[i], b[i]);
+
+			partial[c] = sum;
+		});
+
+		Real sum = Real(0);
+		for (uint c = 0; c < chunkNum; c++)
+			sum += partial[c];
+
+		return sum;
+	}
+
+	//Compute y = x + alpha * d, y may alias x
+	template<typename Real, typename Coord>
+	void csrSaxpy(CArray<Coord>& y, const CArray<Coord>& x, const CArray<Coord>& d, const Real alpha)
+	{
+		uint num = x.size();
+		uint chunkNum = (num + CSR_CHUNK_ENTRIES - 1) / CSR_CHUNK_ENTRIES;
+
+		if (y.size() != num)
+			y.resize(num);
+
+		ThreadPool::instance()->parallelFor(0, chunkNum, [&](uint c) {
+			uint last = std::min(num, (c + 1) * CSR_CHUNK_ENTRIES);
+			for (uint i = c * CSR_CHUNK_ENTRIES; i < last; i++)
+				y[i] = x[i] + d[i] * alpha;
+		});
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::clear()
+	{
+		mRows = 0;
+		mCols = 0;
+
+		mOffsets.clear();
+		mIndices.clear();
+		mValues.clear();
+
+		mChunks.clear();
+
+		mTransposed = nullptr;
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::assign(const uint rows, const uint cols, const std::vector<Triplet>& triplets)
+	{
+		mRows = rows;
+		mCols = cols;
+		mTransposed = nullptr;
+
+		//Bucket the triplets into rows with a counting sort
+		mOffsets.assign(rows + 1, 0);
+		for (size_t t = 0; t < triplets.size(); t++)
+		{
+			assert(triplets[t].row < rows && triplets[t].col < cols);
+			mOffsets[triplets[t].row + 1]++;
+		}
+
+		for (uint i = 0; i < rows; i++)
+			mOffsets[i + 1] += mOffsets[i];
+
+		std::vector<std::pair<uint, Block>> entries(triplets.size());
+		{
+			std::vector<uint> cursor(mOffsets.begin(), mOffsets.begin() + rows);
+			for (size_t t = 0; t < triplets.size(); t++)
+			{
+				const Triplet& tri = triplets[t];
+				entries[cursor[tri.row]++] = std::make_pair(tri.col, tri.value);
+			}
+		}
+
+		//Sort each row and merge duplicates in place, the number of unique entries is stored in counts
+		std::vector<uint> counts(rows);
+		ThreadPool::instance()->parallelFor(0, rows, [&](uint i) {
+			auto first = entries.begin() + mOffsets[i];
+			auto last = entries.begin() + mOffsets[i + 1];
+
+			std::sort(first, last, [](const std::pair<uint, Block>& a, const std::pair<uint, Block>& b) { return a.first < b.first; });
+
+			uint num = 0;
+			for (auto it = first; it != last; it++)
+			{
+				if (num > 0 && (first + num - 1)->first == it->first)
+					(first + num - 1)->second += it->second;
+				else
+					*(first + num++) = *it;
+			}
+
+			counts[i] = num;
+		}, 64);
+
+		CArray<uint> offsets(rows + 1);
+		offsets[0] = 0;
+		for (uint i = 0; i < rows; i++)
+			offsets[i + 1] = offsets[i] + counts[i];
+
+		mIndices.resize(offsets[rows]);
+		mValues.resize(offsets[rows]);
+
+		ThreadPool::instance()->parallelFor(0, rows, [&](uint i) {
+			for (uint k = 0; k < counts[i]; k++)
+			{
+				const std::pair<uint, Block>& e = entries[mOffsets[i] + k];
+				mIndices[offsets[i] + k] = e.first;
+				mValues[offsets[i] + k] = e.second;
+			}
+		}, 256);
+
+		mOffsets.assign(offsets);
+
+		buildChunks();
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::assign(const std::vector<std::map<int, Block>>& rows, const uint cols)
+	{
+		mRows = (uint)rows.size();
+		mCols = cols;
+		mTransposed = nullptr;
+
+		mOffsets.resize(mRows + 1);
+		mOffsets[0] = 0;
+		for (uint i = 0; i < mRows; i++)
+			mOffsets[i + 1] = mOffsets[i] + (uint)rows[i].size();
+
+		mIndices.resize(mOffsets[mRows]);
+		mValues.resize(mOffsets[mRows]);
+
+		//Maps are already sorted by their keys
+		ThreadPool::instance()->parallelFor(0, mRows, [&](uint i) {
+			uint k = mOffsets[i];
+			for (auto it = rows[i].begin(); it != rows[i].end(); it++, k++)
+			{
+				mIndices[k] = (uint)it->first;
+				mValues[k] = it->second;
+			}
+		}, 256);
+
+		buildChunks();
+	}
+
+	template<typename Real, int N>
+	typename CSRMatrix<Real, N>::Block CSRMatrix<Real, N>::entry(const uint i, const uint j) const
+	{
+		const uint* first = mIndices.begin() + mOffsets[i];
+		const uint* last = mIndices.begin() + mOffsets[i + 1];
+
+		const uint* it = std::lower_bound(first, last, j);
+
+		return it != last && *it == j ? mValues[(uint)(it - mIndices.begin())] : Block(0);
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::multiply(const CArray<Coord>& x, CArray<Coord>& y) const
+	{
+		assert(x.size() == mCols);
+
+		if (y.size() != mRows)
+			y.resize(mRows);
+
+		if (mChunks.size() < 2)
+			return;
+
+		ThreadPool::instance()->parallelFor(0, (uint)mChunks.size() - 1, [&](uint c) {
+			for (uint i = mChunks[c]; i < mChunks[c + 1]; i++)
+			{
+				Coord sum(0);
+				for (uint k = mOffsets[i]; k < mOffsets[i + 1]; k++)
+					sum += mValues[k] * x[mIndices[k]];
+
+				y[i] = sum;
+			}
+		});
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::multiplyTranspose(const CArray<Coord>& x, CArray<Coord>& y) const
+	{
+		transposed().multiply(x, y);
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::transpose(CSRMatrix<Real, N>& t) const
+	{
+		t.mRows = mCols;
+		t.mCols = mRows;
+		t.mTransposed = nullptr;
+
+		t.mOffsets.assign(mCols + 1, 0);
+		for (uint k = 0; k < mIndices.size(); k++)
+			t.mOffsets[mIndices[k] + 1]++;
+
+		for (uint j = 0; j < mCols; j++)
+			t.mOffsets[j + 1] += t.mOffsets[j];
+
+		t.mIndices.resize(mIndices.size());
+		t.mValues.resize(mValues.size());
+
+		//Visiting the rows in order keeps the column indices of the transpose sorted
+		std::vector<uint> cursor(t.mOffsets.begin(), t.mOffsets.begin() + mCols);
+		for (uint i = 0; i < mRows; i++)
+		{
+			for (uint k = mOffsets[i]; k < mOffsets[i + 1]; k++)
+			{
+				uint dst = cursor[mIndices[k]]++;
+				t.mIndices[dst] = i;
+				t.mValues[dst] = csrTranspose(mValues[k]);
+			}
+		}
+
+		t.buildChunks();
+	}
+
+	template<typename Real, int N>
+	uint CSRMatrix<Real, N>::CG(const CArray<Coord>& b, CArray<Coord>& x, const uint maxIter, const Real threshold) const
+	{
+		assert(mRows == mCols && b.size() == mRows);
+
+		if (x.size() != mRows)
+			x.assign(mRows, Coord(0));
+
+		CArray<Coord> r, d, q;
+
+		//r = b - A * x
+		this->multiply(x, q);
+		csrSaxpy(r, b, q, Real(-1));
+		d.assign(r);
+
+		Real delta_new = csrDot<Real>(r, r);
+		Real delta_0 = delta_new;
+
+		uint itor = 0;
+		while (itor < maxIter && delta_new > threshold * threshold * delta_0)
+		{
+			this->multiply(d, q);
+
+			Real dq = csrDot<Real>(d, q);
+			if (dq <= Real(0))
+				break;
+
+			Real alpha = delta_new / dq;
+			csrSaxpy(x, x, d, alpha);
+
+			//Recompute the residual from time to time to avoid accumulating round-off errors
+			if (itor % 50 == 49)
+			{
+				this->multiply(x, q);
+				csrSaxpy(r, b, q, Real(-1));
+			}
+			else
+				csrSaxpy(r, r, q, -alpha);
+
+			Real delta_old = delta_new;
+			delta_new = csrDot<Real>(r, r);
+
+			csrSaxpy(d, r, d, delta_new / delta_old);
+
+			itor++;
+		}
+
+		return itor;
+	}
+
+	template<typename Real, int N>
+	uint CSRMatrix<Real, N>::CGLS(const CArray<Coord>& b, CArray<Coord>& x, const uint maxIter, const Real threshold) const
+	{
+		assert(b.size() == mRows);
+
+		if (x.size() != mCols)
+			x.assign(mCols, Coord(0));
+
+		CArray<Coord> b_new, temp, r, d, q;
+
+		//b_new = A^T * b
+		this->multiplyTranspose(b, b_new);
+
+		//r = b_new - A^T * A * x
+		this->multiply(x, temp);
+		this->multiplyTranspose(temp, r);
+		csrSaxpy(r, b_new, r, Real(-1));
+		d.assign(r);
+
+		Real delta_new = csrDot<Real>(r, r);
+		Real delta_0 = delta_new;
+
+		uint itor = 0;
+		while (itor < maxIter && delta_new > threshold * threshold * delta_0)
+		{
+			this->multiply(d, q);
+
+			Real qq = csrDot<Real>(q, q);
+			if (qq <= Real(0))
+				break;
+
+			Real alpha = delta_new / qq;
+			csrSaxpy(x, x, d, alpha);
+
+			if (itor % 50 == 49)
+			{
+				this->multiply(x, temp);
+				this->multiplyTranspose(temp, r);
+				csrSaxpy(r, b_new, r, Real(-1));
+			}
+			else
+			{
+				this->multiplyTranspose(q, temp);
+				csrSaxpy(r, r, temp, -alpha);
+			}
+
+			Real delta_old = delta_new;
+			delta_new = csrDot<Real>(r, r);
+
+			csrSaxpy(d, r, d, delta_new / delta_old);
+
+			itor++;
+		}
+
+		return itor;
+	}
+
+	template<typename Real, int N>
+	void CSRMatrix<Real, N>::buildChunks()
+	{
+		mChunks.clear();
+		mChunks.push_back(0);
+
+		uint nnz = 0;
+		for (uint i = 0; i < mRows; i++)
+		{
+			//Empty rows still cost a write of y
+			nnz += mOffsets[i + 1] - mOffsets[i] + 1;
+			if (nnz >= CSR_CHUNK_NONZEROS)
+			{
+				mChunks.push_back(i + 1);
+				nnz = 0;
+			}
+		}
+
+		if (mChunks.back() != mRows)
+			mChunks.push_back(mRows);
+	}
+
+	template<typename Real, int N>
+	const CSRMatrix<Real, N>& CSRMatrix<Real, N>::transposed() const
+	{
+		if (mTransposed == nullptr)
+		{
+			mTransposed = std::make_shared<CSRMatrix<Real, N>>();
+			this->transpose(*mTransposed);
+		}
+
+		return *mTransposed;
+	}
+}
@@ -5,6 +5,12 @@
 	#include "SparseMatrix/svd3_cuda.h"
 #endif // CUDA_BACKEND
 
+#ifdef NO_BACKEND
+	//The host path of svd3 is shared with the CUDA backend, its max macro would hide std::max and the host max of HostKernel.h
+	#include "../Backend/Cuda/SparseMatrix/svd3_cuda.h"
+	#undef max
+#endif // NO_BACKEND
+
 namespace dyno
 {
 	template<typename Real>
@@ -80,7 +86,7 @@ namespace dyno
 
 	}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 	template<typename Real>
 	DYN_FUNC void polarDecomposition(const SquareMatrix<Real, 3> &A, SquareMatrix<Real, 3> &R, SquareMatrix<Real, 3> &U, SquareMatrix<Real, 3> &D, SquareMatrix<Real, 3> &V)
 	{
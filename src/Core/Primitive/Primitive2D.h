@@ -50,7 +50,7 @@ namespace dyno
 	class TPoint2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TPoint2D();
@@ -106,7 +106,7 @@ namespace dyno
 	class TLine2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TLine2D();
@@ -150,7 +150,7 @@ namespace dyno
 	class TRay2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TRay2D();
@@ -195,7 +195,7 @@ namespace dyno
 	class TSegment2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TSegment2D();
@@ -235,7 +235,7 @@ namespace dyno
 	class TCircle2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TCircle2D();
@@ -251,7 +251,7 @@ namespace dyno
 	class TAlignedBox2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		DYN_FUNC TAlignedBox2D();
@@ -269,7 +269,7 @@ namespace dyno
 	class TPolygon2D
 	{
 	public:
-		typedef typename Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 2> Coord2D;
 
 	public:
 		TPolygon2D();
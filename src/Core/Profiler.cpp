@@ -0,0 +1,208 @@
+#include "Profiler.h"
+
+#include <map>
+#include <cmath>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+
+namespace dyno
+{
+	static thread_local uint tZoneDepth = 0;
+
+	static uint threadIndex()
+	{
+		static std::atomic<uint> counter(0);
+		static thread_local uint index = counter++;
+		return index;
+	}
+
+	static uint64 steadyNow()
+	{
+		return (uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static const char* levelName(Profiler::ZoneLevel level)
+	{
+		switch (level)
+		{
+		case Profiler::Frame:		return "Frame";
+		case Profiler::Node:		return "Node";
+		case Profiler::Pipeline:	return "Pipeline";
+		case Profiler::Module:		return "Module";
+		case Profiler::Kernel:		return "Kernel";
+		default:					return "Unknown";
+		}
+	}
+
+	Profiler* Profiler::instance()
+	{
+		static Profiler profiler;
+		return &profiler;
+	}
+
+	Profiler::Profiler()
+		: mEnabled(false)
+		, mCursor(0)
+	{
+		mOrigin = steadyNow();
+		mSamples.resize(1 << 16);
+	}
+
+	void Profiler::setCapacity(uint capacity)
+	{
+		mSamples.assign(std::max(capacity, 1u), Sample());
+		mCursor = 0;
+	}
+
+	uint Profiler::size() const
+	{
+		return (uint)std::min(mCursor.load(), (uint64)mSamples.size());
+	}
+
+	void Profiler::clear()
+	{
+		mCursor = 0;
+	}
+
+	void Profiler::record(const char* name, ZoneLevel level, uint depth, uint64 begin, uint64 end)
+	{
+		uint64 slot = mCursor.fetch_add(1, std::memory_order_relaxed) % mSamples.size();
+
+		Sample& s = mSamples[slot];
+		s.name = name;
+		s.level = level;
+		s.thread = threadIndex();
+		s.depth = depth;
+		s.begin = begin;
+		s.end = end;
+	}
+
+	std::vector<Profiler::Statistics> Profiler::statistics() const
+	{
+		std::map<std::pair<std::string, int>, std::vector<double>> durations;
+
+		uint num = this->size();
+		for (uint i = 0; i < num; i++)
+		{
+			const Sample& s = mSamples[i];
+			if (s.name == nullptr)
+				continue;
+
+			durations[std::make_pair(std::string(s.name), (int)s.level)].push_back((s.end - s.begin) * 1e-6);
+		}
+
+		std::vector<Statistics> ret;
+		for (auto& d : durations)
+		{
+			auto& vals = d.second;
+			std::sort(vals.begin(), vals.end());
+
+			Statistics stat;
+			stat.name = d.first.first;
+			stat.level = (ZoneLevel)d.first.second;
+			stat.count = (uint)vals.size();
+			stat.min = vals.front();
+			stat.max = vals.back();
+
+			double sum = 0.0;
+			for (auto v : vals)
+				sum += v;
+			stat.mean = sum / vals.size();
+
+			size_t rank = (size_t)std::ceil(0.95 * vals.size());
+			stat.p95 = vals[rank > 0 ? rank - 1 : 0];
+
+			ret.push_back(stat);
+		}
+
+		return ret;
+	}
+
+	bool Profiler::exportChromeTrace(const std::string& filename) const
+	{
+		std::ofstream output(filename.c_str());
+		if (!output.is_open())
+			return false;
+
+		output << "{\"traceEvents\":[";
+
+		bool first = true;
+		uint num = this->size();
+		for (uint i = 0; i < num; i++)
+		{
+			const Sample& s = mSamples[i];
+			if (s.name == nullptr)
+				continue;
+
+			if (!first)
+				output << ",";
+			first = false;
+
+			output << "\n{\"name\":\"";
+			for (const char* c = s.name; *c != '\0'; c++)
+			{
+				if (*c == '"' || *c == '\\')
+					output << '\\';
+				output << *c;
+			}
+
+			output << "\",\"cat\":\"" << levelName(s.level)
+				<< "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << s.thread
+				<< ",\"ts\":" << s.begin / 1000.0
+				<< ",\"dur\":" << (s.end - s.begin) / 1000.0
+				<< ",\"args\":{\"depth\":" << s.depth << "}}";
+		}
+
+		output << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+		return output.good();
+	}
+
+	uint64 Profiler::now() const
+	{
+		return steadyNow() - mOrigin;
+	}
+
+	ProfileZone::ProfileZone(const char* name, Profiler::ZoneLevel level, bool timing)
+		: mName(name)
+		, mLevel(level)
+	{
+		Profiler* profiler = Profiler::instance();
+
+		mRecording = profiler->isEnabled();
+		mActive = mRecording || timing;
+
+		if (mRecording)
+			tZoneDepth++;
+
+		if (mActive)
+			mBegin = profiler->now();
+	}
+
+	ProfileZone::~ProfileZone()
+	{
+		if (!mRecording)
+			return;
+
+#ifdef CUDA_BACKEND
+		// Kernels are launched asynchronously, wait for them to finish before closing the zone
+		if (mLevel == Profiler::Kernel)
+			cudaDeviceSynchronize();
+#endif
+
+		tZoneDepth--;
+
+		Profiler* profiler = Profiler::instance();
+		profiler->record(mName, mLevel, tZoneDepth, mBegin, profiler->now());
+	}
+
+	double ProfileZone::elapsedTime() const
+	{
+		if (!mActive)
+			return 0.0;
+
+		return (Profiler::instance()->now() - mBegin) * 1e-6;
+	}
+}
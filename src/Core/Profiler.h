@@ -0,0 +1,150 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Platform.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace dyno
+{
+	/**
+	 * @brief A hierarchical profiler recording scoped zones into a fixed-size ring buffer.
+	 *	Recording does not allocate, zone names must therefore outlive the profiler (string literals or class names).
+	 *	Once the ring buffer is full, the oldest samples are overwritten.
+	 */
+	class Profiler
+	{
+	public:
+		enum ZoneLevel
+		{
+			Frame,
+			Node,
+			Pipeline,
+			Module,
+			Kernel
+		};
+
+		struct Sample
+		{
+			const char* name = nullptr;
+			ZoneLevel level = Frame;
+			uint thread = 0;
+			uint depth = 0;
+			uint64 begin = 0;	//!< in nanoseconds since the profiler was created
+			uint64 end = 0;
+		};
+
+		struct Statistics
+		{
+			std::string name;
+			ZoneLevel level;
+			uint count = 0;
+
+			// All in milliseconds
+			double min = 0.0;
+			double mean = 0.0;
+			double p95 = 0.0;
+			double max = 0.0;
+		};
+
+		static Profiler* instance();
+
+		void setEnabled(bool enabled) { mEnabled.store(enabled, std::memory_order_relaxed); }
+		inline bool isEnabled() const { return mEnabled.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief Resize the ring buffer, all recorded samples are discarded
+		 */
+		void setCapacity(uint capacity);
+		uint capacity() const { return (uint)mSamples.size(); }
+
+		/**
+		 * @brief Number of samples currently held by the ring buffer
+		 */
+		uint size() const;
+
+		void clear();
+
+		void record(const char* name, ZoneLevel level, uint depth, uint64 begin, uint64 end);
+
+		/**
+		 * @brief Aggregate samples with the same name and level.
+		 *	Should not be called while other threads are recording.
+		 */
+		std::vector<Statistics> statistics() const;
+
+		/**
+		 * @brief Export samples in the Chrome trace event format, can be opened with chrome://tracing or Perfetto
+		 */
+		bool exportChromeTrace(const std::string& filename) const;
+
+		/**
+		 * @brief Current time in nanoseconds since the profiler was created
+		 */
+		uint64 now() const;
+
+	private:
+		Profiler();
+		~Profiler() {};
+
+		std::atomic<bool> mEnabled;
+		std::atomic<uint64> mCursor;
+
+		std::vector<Sample> mSamples;
+
+		uint64 mOrigin = 0;
+	};
+
+	/**
+	 * @brief Record a zone from construction to destruction
+	 */
+	class ProfileZone
+	{
+	public:
+		/**
+		 * @param timing take timestamps even if the profiler is disabled, so elapsedTime() is valid
+		 */
+		ProfileZone(const char* name, Profiler::ZoneLevel level, bool timing = false);
+		~ProfileZone();
+
+		/**
+		 * @brief Return the elapsed time in milliseconds
+		 */
+		double elapsedTime() const;
+
+	private:
+		const char* mName;
+		Profiler::ZoneLevel mLevel;
+
+		bool mActive;
+		bool mRecording;
+
+		uint64 mBegin = 0;
+	};
+}
+
+#define DYNO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define DYNO_PROFILE_CONCAT(a, b) DYNO_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Macro definition for profiling the enclosing scope
+ *
+ * name: zone name, must have a static lifetime
+ * level: one of Profiler::ZoneLevel
+ */
+#define PROFILE_ZONE(name, level) dyno::ProfileZone DYNO_PROFILE_CONCAT(profileZone, __LINE__)(name, dyno::Profiler::level)
@@ -27,7 +27,7 @@ namespace dyno
 		return this->m_startLoc + m_size - 1;;
 	}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 	template <typename T>
 	GPU_FUNC T* List<T>::atomicInsert(T val)
 	{
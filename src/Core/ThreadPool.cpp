@@ -0,0 +1,195 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace dyno
+{
+	static thread_local ThreadPool* tOwnerPool = nullptr;
+	static thread_local uint tWorkerIndex = 0;
+
+	ThreadPool::ThreadPool(uint numThreads)
+		: mNextQueue(0)
+		, mPendingNum(0)
+	{
+		for (uint i = 0; i < numThreads; i++)
+		{
+			mQueues.emplace_back(new WorkQueue);
+		}
+
+		for (uint i = 0; i < numThreads; i++)
+		{
+			mWorkers.emplace_back(&ThreadPool::workerThread, this, i);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mRunning = false;
+		}
+		mSleepCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+		{
+			if (worker.joinable())
+				worker.join();
+		}
+
+		mWorkers.clear();
+		mQueues.clear();
+	}
+
+	ThreadPool* ThreadPool::instance()
+	{
+		// The calling thread takes part in parallelFor(), so one hardware thread is left for it
+		static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+		return &pool;
+	}
+
+	void ThreadPool::submit(Task task)
+	{
+		if (mWorkers.empty())
+		{
+			task();
+			return;
+		}
+
+		// Counted before the task becomes visible, a worker taking it right away must not decrement below zero
+		mPendingNum++;
+
+		uint index = tOwnerPool == this ? tWorkerIndex : mNextQueue++ % size();
+		{
+			std::lock_guard<std::mutex> lock(mQueues[index]->mtx);
+			mQueues[index]->tasks.push_back(std::move(task));
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mSleepCondition.notify_one();
+	}
+
+	void ThreadPool::parallelFor(uint begin, uint end, const std::function<void(uint)>& func, uint grain)
+	{
+		if (end <= begin)
+			return;
+
+		uint total = end - begin;
+		grain = std::max(grain, 1u);
+
+		if (mWorkers.empty() || total <= grain)
+		{
+			for (uint i = begin; i < end; i++)
+				func(i);
+
+			return;
+		}
+
+		// Over-decompose a little so that stealing can balance uneven work
+		uint taskNum = std::min((total + grain - 1) / grain, 4 * (size() + 1));
+		uint stride = (total + taskNum - 1) / taskNum;
+		taskNum = (total + stride - 1) / stride;
+
+		std::atomic<uint> remaining(taskNum);
+		for (uint t = 0; t < taskNum; t++)
+		{
+			uint first = begin + t * stride;
+			uint last = std::min(first + stride, end);
+
+			submit([&func, &remaining, first, last]() {
+				for (uint i = first; i < last; i++)
+					func(i);
+
+				remaining--;
+			});
+		}
+
+		while (remaining.load() > 0)
+		{
+			if (!runPendingTask())
+				std::this_thread::yield();
+		}
+	}
+
+	bool ThreadPool::runPendingTask()
+	{
+		if (mWorkers.empty())
+			return false;
+
+		Task task;
+		uint index = tOwnerPool == this ? tWorkerIndex : mNextQueue.load() % size();
+
+		if (tOwnerPool == this && popTask(index, task))
+		{
+			task();
+			return true;
+		}
+
+		if (stealTask(index, task))
+		{
+			task();
+			return true;
+		}
+
+		return false;
+	}
+
+	void ThreadPool::workerThread(uint index)
+	{
+		tOwnerPool = this;
+		tWorkerIndex = index;
+
+		while (true)
+		{
+			Task task;
+			if (popTask(index, task) || stealTask(index, task))
+			{
+				task();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [&]() { return mPendingNum.load() > 0 || !mRunning; });
+
+			if (!mRunning && mPendingNum.load() == 0)
+				break;
+		}
+	}
+
+	bool ThreadPool::popTask(uint index, Task& task)
+	{
+		WorkQueue& queue = *mQueues[index];
+
+		std::lock_guard<std::mutex> lock(queue.mtx);
+		if (queue.tasks.empty())
+			return false;
+
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		mPendingNum--;
+
+		return true;
+	}
+
+	bool ThreadPool::stealTask(uint index, Task& task)
+	{
+		uint num = size();
+		for (uint i = 0; i < num; i++)
+		{
+			WorkQueue& queue = *mQueues[(index + i) % num];
+
+			std::lock_guard<std::mutex> lock(queue.mtx);
+			if (!queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				mPendingNum--;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Platform.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+namespace dyno
+{
+	/**
+	 * @brief A work-stealing thread pool shared by host-side parallel code.
+	 *	Each worker owns a task deque, pops its own tasks from the back and steals from the front of other workers' deques.
+	 *	Threads waiting on a batch of tasks help executing pending tasks, so nested parallel regions never deadlock.
+	 */
+	class ThreadPool
+	{
+	public:
+		typedef std::function<void()> Task;
+
+		/**
+		 * @param numThreads number of worker threads, 0 means the pool runs every task on the calling thread
+		 */
+		explicit ThreadPool(uint numThreads);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		 * @brief Return the global pool, created with one worker per hardware thread on first use
+		 */
+		static ThreadPool* instance();
+
+		/**
+		 * @brief Number of worker threads
+		 */
+		uint size() const { return (uint)mWorkers.size(); }
+
+		/**
+		 * @brief Enqueue a task, tasks submitted from a worker are pushed into its local deque
+		 */
+		void submit(Task task);
+
+		/**
+		 * @brief Execute func(i) for all i in [begin, end) and block until all calls finish.
+		 *
+		 * @param grain minimum number of consecutive indices handled by one task
+		 */
+		void parallelFor(uint begin, uint end, const std::function<void(uint)>& func, uint grain = 1);
+
+		/**
+		 * @brief Execute one pending task on the calling thread
+		 *
+		 * @return false if no task is available
+		 */
+		bool runPendingTask();
+
+	private:
+		struct WorkQueue
+		{
+			std::mutex mtx;
+			std::deque<Task> tasks;
+		};
+
+		void workerThread(uint index);
+
+		bool popTask(uint index, Task& task);
+		bool stealTask(uint index, Task& task);
+
+	private:
+		bool mRunning = true;
+
+		std::vector<std::thread> mWorkers;
+		std::vector<std::unique_ptr<WorkQueue>> mQueues;
+
+		std::atomic<uint> mNextQueue;
+		std::atomic<uint> mPendingNum;
+
+		std::mutex mSleepMutex;
+		std::condition_variable mSleepCondition;
+	};
+}
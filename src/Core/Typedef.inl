@@ -13,6 +13,9 @@
 #include <vector_types.h>
 #include <vector_functions.h>
 #endif // CUDA_BACKEDN
+#ifdef NO_BACKEND
+#include "Backend/CPU/HostKernel.h"
+#endif // NO_BACKEND
 #include <iostream>
 #include <stdexcept>
 #include <limits>
@@ -40,7 +43,7 @@ namespace dyno {
 	constexpr Real REAL_MIN = (std::numeric_limits<Real>::min)();
 	constexpr uint BLOCK_SIZE = 64;
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 	static uint iDivUp(uint a, uint b)
 	{
 		return (a % b != 0) ? (a / b + 1) : (a / b);
@@ -93,7 +96,9 @@ namespace dyno {
 
 		return gridDims;
 	}
+#endif
 
+#ifdef CUDA_BACKEND
 	/** check whether cuda thinks there was an error and fail with msg, if this is the case
 	* @ingroup tools
 	*/
@@ -136,8 +141,11 @@ namespace dyno {
   *
   * size: indicate how many threads are required in total.
   * Func: kernel function
+  *
+  * Each launch is recorded as a Profiler::Kernel zone named after the kernel while the profiler is enabled.
   */
 #define cuExecute(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);					\
 		uint pDims = cudaGridSize((uint)size, BLOCK_SIZE);	\
 		Func << <pDims, BLOCK_SIZE >> > (				\
 		__VA_ARGS__);									\
@@ -145,6 +153,7 @@ namespace dyno {
 	}
 
 #define cuExecute2D(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);						\
 		uint3 pDims = cudaGridSize2D(size, 8);				\
 		dim3 threadsPerBlock(8, 8, 1);		\
 		Func << <pDims, threadsPerBlock >> > (				\
@@ -153,6 +162,7 @@ namespace dyno {
 	}
 
 #define cuExecute3D(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);						\
 		dim3 pDims = cudaGridSize3D(size, 8);		\
 		dim3 threadsPerBlock(8, 8, 8);		\
 		Func << <pDims, threadsPerBlock >> > (				\
@@ -160,6 +170,38 @@ namespace dyno {
 		cuSynchronize();									\
 	}
 
+#elif defined(NO_BACKEND)
+
+#define cuSafeCall(X) X
+#define cuSynchronize() {}
+
+/**
+ * @brief Host versions of the kernel launches, the same grid as on the GPU is executed by the ThreadPool
+ */
+#define cuExecute(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);					\
+		uint pDims = cudaGridSize((uint)size, BLOCK_SIZE);	\
+		dyno::hostExecute(dim3(pDims), dim3(BLOCK_SIZE), [&]() {	\
+			Func(__VA_ARGS__);							\
+		});												\
+	}
+
+#define cuExecute2D(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);						\
+		uint3 pDims = cudaGridSize2D(size, 8);				\
+		dyno::hostExecute(dim3(pDims), dim3(8, 8, 1), [&]() {	\
+			Func(__VA_ARGS__);								\
+		});													\
+	}
+
+#define cuExecute3D(size, Func, ...){						\
+		PROFILE_ZONE(#Func, Kernel);						\
+		uint3 pDims = cudaGridSize3D(size, 8);				\
+		dyno::hostExecute(dim3(pDims), dim3(8, 8, 8), [&]() {	\
+			Func(__VA_ARGS__);								\
+		});													\
+	}
+
 #endif
 
 	class Bool
@@ -283,4 +325,7 @@ namespace TypeInfo
 	}
 }
 
-
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+//Declares the zones opened by cuExecute
+#include "Profiler.h"
+#endif
@@ -23,9 +23,8 @@ namespace dyno
 
 	template<typename TDataType>
 	DualParticleFluidSystem<TDataType>::DualParticleFluidSystem()
-		: ParticleFluid<TDataType>()
+		: DualParticleFluidSystem(2)
 	{
-		this->DualParticleFluidSystem<TDataType>::DualParticleFluidSystem(2);
 	}
 
 
@@ -1,4 +1,3 @@
-#include <cuda_runtime.h>
 #include "DualParticleIsphModule.h"
 #include "Node.h"
 #include "Field.h"
@@ -28,9 +28,9 @@ namespace dyno
 		DECLARE_TCLASS(CapillaryWave, TDataType)
 	public:
 		typedef typename TDataType::Real Real;
-		typedef typename Vector<Real, 2> Coord2D;
-		typedef typename Vector<Real, 3> Coord3D;
-		typedef typename Vector<Real, 4> Coord4D;
+		typedef Vector<Real, 2> Coord2D;
+		typedef Vector<Real, 3> Coord3D;
+		typedef Vector<Real, 4> Coord4D;
 
 		CapillaryWave();
 		~CapillaryWave() override;
@@ -69,8 +69,8 @@ namespace dyno
 	template<typename TDataType>
 	void BoundaryConstraint<TDataType>::constrain()
 	{
-		uint pDim = cudaGridSize(m_position.size(), BLOCK_SIZE);
-		K_ConstrainSDF << <pDim, BLOCK_SIZE >> > (
+		cuExecute(m_position.size(),
+			K_ConstrainSDF,
 			m_position.getData(),
 			m_velocity.getData(),
 			*m_cSDF,
@@ -82,8 +82,8 @@ namespace dyno
 	template<typename TDataType>
 	bool BoundaryConstraint<TDataType>::constrain(DArray<Coord>& position, DArray<Coord>& velocity, Real dt)
 	{
-		uint pDim = cudaGridSize(position.size(), BLOCK_SIZE);
- 		K_ConstrainSDF << <pDim, BLOCK_SIZE >> > (
+ 		cuExecute(position.size(),
+ 			K_ConstrainSDF,
 			position,
 			velocity,
 			*m_cSDF,
@@ -97,8 +97,8 @@ namespace dyno
 	template<typename TDataType>
 	void BoundaryConstraint<TDataType>::constrain(DArray<Coord>& position, DArray<Coord>& velocity, DistanceField3D<TDataType>& sdf, Real dt)
 	{
-		uint pDim = cudaGridSize(position.size(), BLOCK_SIZE);
-		K_ConstrainSDF << <pDim, BLOCK_SIZE >> > (
+		cuExecute(position.size(),
+			K_ConstrainSDF,
 			position,
 			velocity,
 			sdf,
@@ -140,7 +140,7 @@ namespace dyno
 	}
 
 	template<typename TDataType>
-	void BoundaryConstraint<TDataType>::setCylinder(Coord center, Real r, Real height, Real distance, int axis, bool inverted = false)
+	void BoundaryConstraint<TDataType>::setCylinder(Coord center, Real r, Real height, Real distance, int axis, bool inverted)
 	{
 		int nx = floor(2 * r / distance);
 		int ny = floor(0.5 * height / distance);
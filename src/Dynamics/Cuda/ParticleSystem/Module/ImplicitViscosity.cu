@@ -7,7 +7,7 @@ namespace dyno
 	ImplicitViscosity<TDataType>::ImplicitViscosity()
 		:ParticleApproximation<TDataType>()
 	{
-		this->varKernelType()->setCurrentKey(EKernelType::KT_Smooth);
+		this->varKernelType()->setCurrentKey(ParticleApproximation<TDataType>::EKernelType::KT_Smooth);
 		this->varViscosity()->setValue(Real(0.05));
 	}
 
@@ -67,9 +67,9 @@ namespace dyno
 	template<typename TDataType>
 	void ImplicitViscosity<TDataType>::compute()
 	{
-		auto& poss = this->inPosition()->getData();
+		auto& poss = this->inPosition()->constData();
 		auto& vels = this->inVelocity()->getData();
-		auto& nbrIds = this->inNeighborIds()->getData();
+		auto& nbrIds = this->inNeighborIds()->constData();
 		Real  h = this->inSmoothingLength()->getData();
 		Real dt = this->inTimeStep()->getData();
 
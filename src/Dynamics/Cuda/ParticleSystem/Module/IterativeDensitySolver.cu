@@ -186,7 +186,7 @@ namespace dyno
 		if (mPositionOld.size() != this->inPosition()->size())
 			mPositionOld.resize(this->inPosition()->size());
 
-		mPositionOld.assign(this->inPosition()->getData());
+		mPositionOld.assign(this->inPosition()->constData());
 
 		if (this->outDensity()->size() != this->inPosition()->size())
 			this->outDensity()->resize(this->inPosition()->size());
@@ -230,8 +230,8 @@ namespace dyno
 		cuFirstOrder(num, this->varKernelType()->getDataPtr()->currentKey(), this->mScalingFactor,
 			IDS_ComputeLambdas,
 			mLamda,
-			this->inPosition()->getData(),
-			this->inNeighborIds()->getData(),
+			this->inPosition()->constData(),
+			this->inNeighborIds()->constData(),
 			rho_0,
 			this->inSmoothingLength()->getValue(),
 			this->inSamplingDistance()->getValue());
@@ -246,8 +246,8 @@ namespace dyno
 			IDS_ComputeDisplacement,
 			mDeltaPos,
 			mLamda,
-			this->inPosition()->getData(),
-			this->inNeighborIds()->getData(),
+			this->inPosition()->constData(),
+			this->inNeighborIds()->constData(),
 			this->inSmoothingLength()->getValue(),
 			this->inSamplingDistance()->getValue(),
 			this->varKappa()->getValue(),
@@ -297,7 +297,7 @@ namespace dyno
 
 		cuExecute(num, DP_UpdateVelocity,
 			this->inVelocity()->getData(),
-			this->inPosition()->getData(),
+			this->inPosition()->constData(),
 			mPositionOld,
 			dt);
 	}
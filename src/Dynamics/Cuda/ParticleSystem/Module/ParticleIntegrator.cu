@@ -1,4 +1,3 @@
-#include <cuda_runtime.h>
 #include "ParticleIntegrator.h"
 #include "Node.h"
 #include "SceneGraphFactory.h"
@@ -73,7 +72,7 @@ namespace dyno
 			cuExecute(total_num,
 				K_UpdateVelocity,
 				this->inVelocity()->getData(),
-				this->inAttribute()->getData(),
+				this->inAttribute()->constData(),
 				gravity,
 				dt);
 		}
@@ -117,7 +116,7 @@ namespace dyno
 	{
 		Real dt = this->inTimeStep()->getData();
 
-		int total_num = this->inPosition()->getDataPtr()->size();
+		int total_num = this->inPosition()->size();
 		
 		
 		if (this->inAttribute()->isEmpty())
@@ -125,7 +124,7 @@ namespace dyno
 			cuExecute(total_num,
 				K_UpdatePosition,
 				this->inPosition()->getData(),
-				this->inVelocity()->getData(),
+				this->inVelocity()->constData(),
 				dt);
 		}
 		else
@@ -133,8 +132,8 @@ namespace dyno
 			cuExecute(total_num,
 				K_UpdatePosition,
 				this->inPosition()->getData(),
-				this->inVelocity()->getData(),
-				this->inAttribute()->getData(),
+				this->inVelocity()->constData(),
+				this->inAttribute()->constData(),
 				dt);
 		}
 
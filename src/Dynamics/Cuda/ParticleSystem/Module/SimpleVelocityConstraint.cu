@@ -1,4 +1,3 @@
-#include <cuda_runtime.h>
 #include "SimpleVelocityConstraint.h"
 #include <string>
 #include "Algorithm/Function2Pt.h"
@@ -897,19 +896,20 @@ namespace dyno
 		Real dt = this->inTimeStep()->getData();
 
 		int num = this->inPosition()->size();
-		uint pDims = cudaGridSize(this->inPosition()->size(), BLOCK_SIZE);
 
 
 		m_alpha.reset();
 		//compute alpha_i = sigma w_j and A_i = sigma w_ij / r_ij / r_ij
-		SIMPLE_ComputeAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_ComputeAlpha,
 			m_alpha,
 			m_position,
 			m_attribute,
 			m_neighborhood,
 			m_smoothingLength);
 
-		SIMPLE_CorrectAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_CorrectAlpha,
 			m_alpha,
 			m_maxAlpha);
 
@@ -918,7 +918,8 @@ namespace dyno
 		m_AiiFluid.reset();
 		m_AiiTotal.reset();
 
-		SIMPLE_ComputeDiagonalElement << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_ComputeDiagonalElement,
 			m_AiiFluid,
 			m_AiiTotal,
 			m_alpha,
@@ -929,7 +930,8 @@ namespace dyno
 
 		m_bSurface.reset();
 		m_Aii.reset();
-		SIMPLE_DetectSurface << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_DetectSurface,
 			m_Aii,
 			m_bSurface,
 			m_AiiFluid,
@@ -948,7 +950,8 @@ namespace dyno
 		if (IsCrossReady)
 		{
 
-			SIMPLE_CrossVis << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_CrossVis,
 				m_viscosity,
 				m_velocity,
 				m_position,
@@ -987,7 +990,8 @@ namespace dyno
 			//Incopressibility Solver -- Begin 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 			m_divergence.reset();
-			SIMPLE_ComputeDivergence << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_ComputeDivergence,
 				m_divergence,
 				m_alpha,
 				m_position,
@@ -1001,7 +1005,8 @@ namespace dyno
 				m_smoothingLength,
 				dt);
 
-			SIMPLE_CompensateSource << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_CompensateSource,
 				m_divergence,
 				m_densitySum->outDensity()->getData(),
 				m_attribute,
@@ -1011,7 +1016,8 @@ namespace dyno
 
 			m_deltaPressure.reset();
 			m_y.reset();
-			SIMPLE_ComputeAx << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_ComputeAx,
 				m_y,
 				m_deltaPressure,
 				m_Aii,
@@ -1034,7 +1040,8 @@ namespace dyno
 			while (itor < 1000 && err / initErr > 0.00001f)
 			{
 				m_y.reset();
-				SIMPLE_ComputeAx << <pDims, BLOCK_SIZE >> > (
+				cuExecute(this->inPosition()->size(),
+					SIMPLE_ComputeAx,
 					m_y,
 					m_p,
 					m_Aii,
@@ -1059,7 +1066,8 @@ namespace dyno
 				itor++;
 			}
 
-			UpdatePressure << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				UpdatePressure,
 				m_pressure,
 				m_deltaPressure);
 
@@ -1070,7 +1078,8 @@ namespace dyno
 
 
 			P_dv.reset();
-			SIMPLE_P_dv << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_P_dv,
 				P_dv,
 				m_pressure,
 				m_alpha,
@@ -1087,7 +1096,8 @@ namespace dyno
 				m_smoothingLength,
 				dt);
 
-			SIMPLE_VelUpdate << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_VelUpdate,
 				m_velocity,
 				velOld,
 				P_dv
@@ -1098,7 +1108,8 @@ namespace dyno
 			//Viscosity Solver -- Begin 
 			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 			v_y.reset();
-			SIMPLE_Vis_AxComput<Real, Coord> << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_Vis_AxComput,
 				v_y,
 				m_velocity,
 				m_position,
@@ -1112,7 +1123,8 @@ namespace dyno
 				);
 
 			v_r.reset();
-			SIMPLE_Vis_r_Comput << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				SIMPLE_Vis_r_Comput,
 				v_r,
 				v_y,
 				velOld,
@@ -1132,14 +1144,16 @@ namespace dyno
 			{
 				VisItor++;
 				//The type of "v_p" should convert to DArray<Coord>
-				SIMPLE_Vis_pToVector<Real, Coord> << <pDims, BLOCK_SIZE >> > (
+				cuExecute(this->inPosition()->size(),
+					SIMPLE_Vis_pToVector,
 					v_p,
 					v_pv,
 					m_attribute
 					);
 
 				v_y.reset();
-				SIMPLE_Vis_AxComput<Real, Coord> << <pDims, BLOCK_SIZE >> > (
+				cuExecute(this->inPosition()->size(),
+					SIMPLE_Vis_AxComput,
 					v_y,
 					v_pv,
 					//m_velocity.getValue(),
@@ -1156,7 +1170,8 @@ namespace dyno
 				float alpha = Vrr / m_arithmetic_v->Dot(v_p, v_y);
 
 				//The type of "velocity" should convert to DArray<Real>
-				SIMPLE_Vis_CoordToReal<Real, Coord> << <pDims, BLOCK_SIZE >> > (
+				cuExecute(this->inPosition()->size(),
+					SIMPLE_Vis_CoordToReal,
 					m_VelocityReal,
 					m_velocity,
 					m_attribute
@@ -1164,7 +1179,8 @@ namespace dyno
 
 				Function2Pt::saxpy(m_VelocityReal, v_p, m_VelocityReal, alpha);
 
-				SIMPLE_Vis_RealToVeloctiy<Real, Coord> << <pDims, BLOCK_SIZE >> > (
+				cuExecute(this->inPosition()->size(),
+					SIMPLE_Vis_RealToVeloctiy,
 					m_velocity,
 					m_VelocityReal,
 					m_attribute
@@ -1274,11 +1290,10 @@ namespace dyno
 		resizeVector();
 
 
-		uint pDims = cudaGridSize(this->inPosition()->size(), BLOCK_SIZE);
-
 		m_alpha.reset();
 
-		SIMPLE_ComputeAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_ComputeAlpha,
 			m_alpha,
 			m_position,
 			m_attribute,
@@ -1287,12 +1302,14 @@ namespace dyno
 
 		m_maxAlpha = m_reduce->maximum(m_alpha.begin(), m_alpha.size());
 
-		SIMPLE_CorrectAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_CorrectAlpha,
 			m_alpha,
 			m_maxAlpha);
 
 		m_AiiFluid.reset();
-		SIMPLE_ComputeDiagonalElement << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			SIMPLE_ComputeDiagonalElement,
 			m_AiiFluid,
 			m_alpha,
 			m_position,
@@ -22,8 +22,8 @@ namespace dyno
 	template<typename TDataType>
 	void SummationDensity<TDataType>::compute()
 	{
-		int p_num = this->inPosition()->getDataPtr()->size();
-		int n_num = this->inNeighborIds()->getDataPtr()->size();
+		int p_num = this->inPosition()->size();
+		int n_num = this->inNeighborIds()->size();
 		if (p_num != n_num) {
 			Log::sendMessage(Log::Error, "The input array sizes of DensitySummation are not compatible!");
 			return;
@@ -36,17 +36,17 @@ namespace dyno
 		if (this->inOther()->isEmpty()) {
 			compute(
 				this->outDensity()->getData(),
-				this->inPosition()->getData(),
-				this->inNeighborIds()->getData(),
+				this->inPosition()->constData(),
+				this->inNeighborIds()->constData(),
 				this->inSmoothingLength()->getData(),
 				m_particle_mass);
 		}
 		else {
 			compute(
 				this->outDensity()->getData(),
-				this->inPosition()->getData(),
-				this->inOther()->getData(),
-				this->inNeighborIds()->getData(),
+				this->inPosition()->constData(),
+				this->inOther()->constData(),
+				this->inNeighborIds()->constData(),
 				this->inSmoothingLength()->getData(),
 				m_particle_mass);
 		}
@@ -112,8 +112,8 @@ namespace dyno
 	template<typename TDataType>
 	void SummationDensity<TDataType>::compute(
 		DArray<Real>& rho, 
-		DArray<Coord>& pos,
-		DArrayList<int>& neighbors,
+		const DArray<Coord>& pos,
+		const DArrayList<int>& neighbors,
 		Real smoothingLength,
 		Real mass)
 	{
@@ -127,7 +127,7 @@ namespace dyno
 	}
 
 	template<typename TDataType>
-	void SummationDensity<TDataType>::compute(DArray<Real>& rho, DArray<Coord>& pos, DArray<Coord>& posQueried, DArrayList<int>& neighbors, Real smoothingLength, Real mass)
+	void SummationDensity<TDataType>::compute(DArray<Real>& rho, const DArray<Coord>& pos, const DArray<Coord>& posQueried, const DArrayList<int>& neighbors, Real smoothingLength, Real mass)
 	{
 		cuZerothOrder(rho.size(), this->varKernelType()->getDataPtr()->currentKey(), this->mScalingFactor,
 			SD_ComputeDensity,
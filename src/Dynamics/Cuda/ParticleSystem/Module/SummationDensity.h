@@ -38,16 +38,16 @@ namespace dyno {
 	public:
 		void compute(
 			DArray<Real>& rho,
-			DArray<Coord>& pos,
-			DArrayList<int>& neighbors,
+			const DArray<Coord>& pos,
+			const DArrayList<int>& neighbors,
 			Real smoothingLength,
 			Real mass);
 
 		void compute(
 			DArray<Real>& rho,
-			DArray<Coord>& pos,
-			DArray<Coord>& posQueried,
-			DArrayList<int>& neighbors,
+			const DArray<Coord>& pos,
+			const DArray<Coord>& posQueried,
+			const DArrayList<int>& neighbors,
 			Real smoothingLength,
 			Real mass);
 
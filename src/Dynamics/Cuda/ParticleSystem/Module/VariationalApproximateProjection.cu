@@ -788,10 +788,9 @@ namespace dyno
 			m_reduce = Reduction<float>::Create(num);
 			m_arithmetic = Arithmetic<float>::Create(num);
 
-			uint pDims = cudaGridSize(num, BLOCK_SIZE);
-
 			mAlpha.reset();
-			VAP_ComputeAlpha << <pDims, BLOCK_SIZE >> > (
+			cuExecute(num,
+				VAP_ComputeAlpha,
 				mAlpha,
 				this->inPosition()->getData(),
 				this->inAttribute()->getData(),
@@ -800,12 +799,14 @@ namespace dyno
 
 			mAlphaMax = m_reduce->maximum(mAlpha.begin(), mAlpha.size());
 
-			VAP_CorrectAlpha << <pDims, BLOCK_SIZE >> > (
+			cuExecute(num,
+				VAP_CorrectAlpha,
 				mAlpha,
 				mAlphaMax);
 
 			mAiiFluid.reset();
-			VAP_ComputeDiagonalElement << <pDims, BLOCK_SIZE >> > (
+			cuExecute(num,
+				VAP_ComputeDiagonalElement,
 				mAiiFluid,
 				mAlpha,
 				this->inPosition()->getData(),
@@ -825,20 +826,23 @@ namespace dyno
 
 		//compute alpha_i = sigma w_j and A_i = sigma w_ij / r_ij / r_ij
 		mAlpha.reset();
-		VAP_ComputeAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_ComputeAlpha,
 			mAlpha, 
 			this->inPosition()->getData(),
 			this->inAttribute()->getData(),
 			this->inNeighborIds()->getData(), 
 			this->inSmoothingLength()->getValue());
-		VAP_CorrectAlpha << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_CorrectAlpha,
 			mAlpha, 
 			mAlphaMax);
 
 		//compute the diagonal elements of the coefficient matrix
 		mAiiFluid.reset();
 		mAiiTotal.reset();
-		VAP_ComputeDiagonalElement << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_ComputeDiagonalElement,
 			mAiiFluid, 
 			mAiiTotal, 
 			mAlpha, 
@@ -849,7 +853,8 @@ namespace dyno
 
 		mIsSurface.reset();
 		mAii.reset();
-		VAP_DetectSurface << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_DetectSurface,
 			mAii, 
 			mIsSurface, 
 			mAiiFluid,
@@ -867,7 +872,8 @@ namespace dyno
 		//compute the source term
 		mDensityCalculator->compute();
 		mDivergence.reset();
-		VAP_ComputeDivergence << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_ComputeDivergence,
 			mDivergence, 
 			mAlpha, 
 			mDensityCalculator->outDensity()->getData(),
@@ -883,7 +889,8 @@ namespace dyno
 			this->inSmoothingLength()->getData(),
 			dt);
 
-		VAP_CompensateSource << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_CompensateSource,
 			mDivergence, 
 			mDensityCalculator->outDensity()->getData(),
 			this->inAttribute()->getData(),
@@ -893,7 +900,8 @@ namespace dyno
 		
 		//solve the linear system of equations with a conjugate gradient method.
 		m_y.reset();
-		VAP_ComputeAx << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_ComputeAx,
 			m_y, 
 			mPressure, 
 			mAii, 
@@ -913,7 +921,8 @@ namespace dyno
 		{
 			m_y.reset();
 			//VC_ComputeAx << <pDims, BLOCK_SIZE >> > (*yArr, *pArr, *aiiArr, *alphaArr, *posArr, *attArr, *neighborArr);
-			VAP_ComputeAx << <pDims, BLOCK_SIZE >> > (
+			cuExecute(this->inPosition()->size(),
+				VAP_ComputeAx,
 				m_y, 
 				m_p, 
 				mAii, 
@@ -956,7 +965,8 @@ namespace dyno
 // 			this->inSmoothingLength()->getData(),
 // 			dt);
 
-		VAP_UpdateVelocity1rd << <pDims, BLOCK_SIZE >> > (
+		cuExecute(this->inPosition()->size(),
+			VAP_UpdateVelocity1rd,
 			mPressure,
 			mAlpha,
 			mIsSurface,
@@ -25,10 +25,10 @@ namespace dyno
 	ParticleFluid<TDataType>::ParticleFluid()
 		: ParticleSystem<TDataType>()
 	{
-		auto smoothingLength = this->animationPipeline()->createModule<FloatingNumber<TDataType>>();
+		auto smoothingLength = this->animationPipeline()->template createModule<FloatingNumber<TDataType>>();
 		smoothingLength->varValue()->setValue(Real(0.006));
 
-		auto samplingDistance = this->animationPipeline()->createModule<FloatingNumber<TDataType>>();
+		auto samplingDistance = this->animationPipeline()->template createModule<FloatingNumber<TDataType>>();
 		samplingDistance->varValue()->setValue(Real(0.005));
 
 		auto integrator = std::make_shared<ParticleIntegrator<TDataType>>();
@@ -75,58 +75,17 @@ namespace dyno
 	{
 		auto emitters = this->getParticleEmitters();
 
-		int curNum = this->statePosition()->size();
-		int totalNum = curNum;
-		if (emitters.size() > 0)
+		//Append the emitted particles in place, only the new particles are copied unless the buffers have to grow
+		for (int i = 0; i < emitters.size(); i++)
 		{
-			for (int i = 0; i < emitters.size(); i++)
+			int num = emitters[i]->sizeOfParticles();
+			if (num > 0)
 			{
-				totalNum += emitters[i]->sizeOfParticles();
-			}
-
-			if (totalNum > curNum)
-			{
-				DArray<Coord> pBuf;
-				DArray<Coord> vBuf;
-
-				if (curNum > 0)
-				{
-					pBuf.assign(this->statePosition()->getData());
-					vBuf.assign(this->stateVelocity()->getData());
-				}
-
-				this->statePosition()->resize(totalNum);
-				this->stateVelocity()->resize(totalNum);
-
-				DArray<Coord>& new_pos = this->statePosition()->getData();
-				DArray<Coord>& new_vel = this->stateVelocity()->getData();
-
-				//Assign attributes from initial states
-				if (curNum > 0)
-				{
-					new_pos.assign(pBuf, curNum, 0, 0);
-					new_vel.assign(vBuf, curNum, 0, 0);
-
-					pBuf.clear();
-					vBuf.clear();
-				}
-
-				//Assign attributes from emitters
-				int offset = curNum;
-				for (int i = 0; i < emitters.size(); i++)
-				{
-					int num = emitters[i]->sizeOfParticles();
-					if (num > 0)
-					{
-						DArray<Coord>& points = emitters[i]->getPositions();
-						DArray<Coord>& vels = emitters[i]->getVelocities();
+				auto new_pos = this->statePosition()->allocate();
+				auto new_vel = this->stateVelocity()->allocate();
 
-						new_pos.assign(points, num, offset, 0);
-						new_vel.assign(vels, num, offset, 0);
-
-						offset += num;
-					}
-				}
+				new_pos->append(emitters[i]->getPositions(), num);
+				new_vel->append(emitters[i]->getVelocities(), num);
 			}
 		}
 
@@ -144,6 +103,18 @@ namespace dyno
 		}
 	}
 
+	template<typename TDataType>
+	void ParticleFluid<TDataType>::removeParticles(DArray<bool>& removed)
+	{
+		if (this->statePosition()->isEmpty())
+			return;
+
+		ParticleSystemHelper<TDataType>::removeParticles(
+			this->statePosition()->getData(),
+			this->stateVelocity()->getData(),
+			removed);
+	}
+
 	template<typename TDataType>
 	void ParticleFluid<TDataType>::loadInitialStates()
 	{
@@ -39,6 +39,11 @@ namespace dyno
 
 		DEF_NODE_PORTS(ParticleSystem<TDataType>, InitialState, "Initial Fluid Particles");
 
+		/**
+		 * @brief Compact the particle states by removing the particles flagged in removed, the order of the remaining particles is kept
+		 */
+		void removeParticles(DArray<bool>& removed);
+
 	protected:
 		void resetStates() override;
 
@@ -1,6 +1,7 @@
 #include "ParticleSystemHelper.h"
 
 #include "Algorithm/Reduction.h"
+#include "Algorithm/Scan.h"
 
 #include <thrust/sort.h>
 
@@ -111,5 +112,83 @@ namespace dyno
 		buffer.clear();
 	}
 
+	__global__ void PSH_CountRemainingParticles(
+		DArray<uint> counter,
+		DArray<bool> removed)
+	{
+		int pId = threadIdx.x + (blockIdx.x * blockDim.x);
+		if (pId >= removed.size()) return;
+
+		counter[pId] = removed[pId] ? 0 : 1;
+	}
+
+	template<typename Coord>
+	__global__ void PSH_CompactParticles(
+		DArray<Coord> newPos,
+		DArray<Coord> newVel,
+		DArray<Coord> pos,
+		DArray<Coord> vel,
+		DArray<uint> radix,
+		DArray<bool> removed)
+	{
+		int pId = threadIdx.x + (blockIdx.x * blockDim.x);
+		if (pId >= removed.size()) return;
+
+		if (!removed[pId])
+		{
+			uint id = radix[pId];
+			newPos[id] = pos[pId];
+			newVel[id] = vel[pId];
+		}
+	}
+
+	template<typename TDataType>
+	uint ParticleSystemHelper<TDataType>::removeParticles(
+		DArray<Coord>& pos,
+		DArray<Coord>& vel,
+		DArray<bool>& removed)
+	{
+		uint num = pos.size();
+		if (num == 0) return 0;
+
+		DArray<uint> radix(num);
+
+		cuExecute(num,
+			PSH_CountRemainingParticles,
+			radix,
+			removed);
+
+		Reduction<uint> reduce;
+		uint remaining = reduce.accumulate(radix.begin(), radix.size());
+
+		if (remaining < num)
+		{
+			Scan<uint> scan;
+			scan.exclusive(radix.begin(), radix.size());
+
+			DArray<Coord> newPos(remaining);
+			DArray<Coord> newVel(remaining);
+
+			cuExecute(num,
+				PSH_CompactParticles,
+				newPos,
+				newVel,
+				pos,
+				vel,
+				radix,
+				removed);
+
+			pos.assign(newPos);
+			vel.assign(newVel);
+
+			newPos.clear();
+			newVel.clear();
+		}
+
+		radix.clear();
+
+		return remaining;
+	}
+
 	template class ParticleSystemHelper<DataType3f>;
 }
\ No newline at end of file
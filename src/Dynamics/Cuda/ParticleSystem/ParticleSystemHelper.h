@@ -39,5 +39,15 @@ namespace dyno
 			DArray<Coord>& pos,
 			DArray<Coord>& vel,
 			DArray<OcKey>& morton);
+
+		/**
+		 * @brief Remove the particles flagged in removed while keeping the order of the remaining ones
+		 *
+		 * @return the number of remaining particles
+		 */
+		static uint removeParticles(
+			DArray<Coord>& pos,
+			DArray<Coord>& vel,
+			DArray<bool>& removed);
 	};
 }
\ No newline at end of file
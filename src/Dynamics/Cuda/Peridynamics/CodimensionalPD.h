@@ -21,7 +21,7 @@ namespace dyno
 		typedef typename TDataType::Real Real;
 		typedef typename TDataType::Coord Coord;
 		typedef typename TDataType::Matrix Matrix;
-		typedef typename TBond<TDataType> Bond;
+		typedef TBond<TDataType> Bond;
 
 		CodimensionalPD();
 		~CodimensionalPD() override;
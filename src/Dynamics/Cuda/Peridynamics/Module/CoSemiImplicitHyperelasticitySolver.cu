@@ -1,7 +1,6 @@
 #include "CoSemiImplicitHyperelasticitySolver.h"
 #include "Matrix/MatrixFunc.h"
 #include "ParticleSystem/Module/Kernel.h"
-#include "curand_kernel.h"
 #include "Algorithm/CudaRand.h"
 
 namespace dyno
@@ -36,19 +35,20 @@ namespace dyno
 	void CoSemiImplicitHyperelasticitySolver<TDataType>::initializeVolume()
 	{
 		int numOfParticles = this->inY()->getData().size();
-		uint pDims = cudaGridSize(numOfParticles, BLOCK_SIZE);
 		std::cout << "dev: " << numOfParticles << " particles\n";
-		HM_InitVolume << <pDims, BLOCK_SIZE >> > (m_volume, m_objectVolume, m_objectVolumeSet, m_particleVolume, m_particleVolumeSet);
+		cuExecute(numOfParticles,
+			HM_InitVolume,
+			m_volume, m_objectVolume, m_objectVolumeSet, m_particleVolume, m_particleVolumeSet);
 	}
 
 	template<typename TDataType>
 	CoSemiImplicitHyperelasticitySolver<TDataType>::~CoSemiImplicitHyperelasticitySolver()
 	{
-		mWeights.clear();
-		mDisplacement.clear();
-		mInvK.clear();
-		mF.clear();
-		mPosBuf.clear();
+		this->mWeights.clear();
+		this->mDisplacement.clear();
+		this->mInvK.clear();
+		this->mF.clear();
+		this->mPosBuf.clear();
 		mPosBuf_March.clear();
 	}
 
@@ -81,7 +81,8 @@ namespace dyno
 	template<typename TDataType>
 	void CoSemiImplicitHyperelasticitySolver<TDataType>::solveElasticity()
 	{
-		cudaMemcpyToSymbol(ENERGY_FUNC, &this->inEnergyModels()->getData(), sizeof(EnergyModels<Real>));
+		EnergyModels<Real> models = this->inEnergyModels()->getData();
+		cudaMemcpyToSymbol(ENERGY_FUNC, &models, sizeof(EnergyModels<Real>));
 
 		enforceHyperelasticity();
 	}
@@ -856,7 +857,7 @@ namespace dyno
 		m_source.resize(num);         
 		m_A.resize(num);
 		m_gradientMagnitude.resize(num);
-		mPosBuf.resize(num);
+		this->mPosBuf.resize(num);
 
 		m_fraction.resize(num);
 
@@ -885,7 +886,6 @@ namespace dyno
 		resizeAllFields();
 
 		int numOfParticles = this->inY()->getData().size();
-		uint pDims = cudaGridSize(numOfParticles, BLOCK_SIZE);
 
 		std::cout << "enforceElasticity Particles: " << numOfParticles << std::endl;
 
@@ -898,7 +898,7 @@ namespace dyno
 		/*====================================== Jacobi method ======================================*/
 		// initialize y_now, y_next_iter
 		y_current.assign(this->inY()->getData());
-		mPosBuf.assign(this->inY()->getData());
+		this->mPosBuf.assign(this->inY()->getData());
 
 
 		// do Jacobi method Loop
@@ -914,7 +914,8 @@ namespace dyno
 				m_source.reset();
 				m_A.reset();
 
-				HM_ComputeF << <pDims, BLOCK_SIZE >> > (
+				cuExecute(numOfParticles,
+					HM_ComputeF,
 					m_F,
 					m_eigenValues,
 					m_invK,
@@ -931,7 +932,8 @@ namespace dyno
 					this->inNorm()->getData());
 				cuSynchronize();
 
-				HM_JacobiStepNonsymmetric << <pDims, BLOCK_SIZE >> > (
+				cuExecute(numOfParticles,
+					HM_JacobiStepNonsymmetric,
 					m_source,
 					m_A,
 					this->inX()->getData(),
@@ -954,7 +956,7 @@ namespace dyno
 				cuExecute(y_current.size(),
 					HM_ComputeNextPosition,
 					y_next,
-					mPosBuf,
+					this->mPosBuf,
 					m_volume,
 					m_source,
 					m_A);
@@ -1021,13 +1023,13 @@ namespace dyno
 			mContactRule->inNewPosition()->assign(y_next);
 			mContactRule->initCCDBroadPhase();
 
-			mContactRule->inNewPosition()->assign(mPosBuf);
+			mContactRule->inNewPosition()->assign(this->mPosBuf);
 			convergeFlag = false; // converge or not
 			iterCount = 0;
 			alpha = 1.0f;
 			max_grad_mag = 1e3;
 	}
-		mPosBuf_March.assign(mPosBuf);
+		mPosBuf_March.assign(this->mPosBuf);
 
 
 		auto& cntPos = mContactRule->inNewPosition()->getData();
@@ -1036,7 +1038,8 @@ namespace dyno
 			m_A.reset();
 			y_current.assign(cntPos);
 
-			HM_ComputeF << <pDims, BLOCK_SIZE >> > (
+			cuExecute(numOfParticles,
+				HM_ComputeF,
 				m_F,
 				m_eigenValues,
 				m_invK,
@@ -1053,7 +1056,8 @@ namespace dyno
 				this->inNorm()->getData());
 			cuSynchronize();
 
-			HM_JacobiStepNonsymmetric << <pDims, BLOCK_SIZE >> > (
+			cuExecute(numOfParticles,
+				HM_JacobiStepNonsymmetric,
 				m_source,
 				m_A,
 				this->inX()->getData(),
@@ -1154,7 +1158,7 @@ namespace dyno
 			this->inY()->getData(),
 			this->inVelocity()->getData(),
 			cntPos,
-			mPosBuf,
+			this->mPosBuf,
 			this->inAttribute()->getData(),
 			this->inTimeStep()->getData());
 		
@@ -46,7 +46,7 @@ namespace dyno
 			return 1.0f;
 	}
 
-	template <typename Real, typename Coord, typename Matrix, typename Bond>
+	template <typename Real, typename Coord, typename Bond>
 	__global__ void PM_ComputeInvariants(
 		DArray<bool> bYield,
 		DArray<Real> yield_I1,
@@ -180,7 +180,7 @@ namespace dyno
 		arrI1[i] = I1_i;
 	}
 
-	template <typename Real, typename Coord, typename Matrix, typename Bond>
+	template <typename Real, typename Coord, typename Bond>
 	__global__ void PM_ApplyYielding(
 		DArray<Real> yield_I1,
 		DArray<Real> yield_J2,
@@ -297,12 +297,12 @@ namespace dyno
 	void ElastoplasticityModule<TDataType>::applyYielding()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
 		Real A = computeA();
 		Real B = computeB();
 
-		PM_ComputeInvariants<Real, Coord, Matrix, Bond> << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			PM_ComputeInvariants,
 			m_bYield,
 			m_yiled_I1,
 			m_yield_J2,
@@ -318,7 +318,8 @@ namespace dyno
 			this->varLambda()->getData());
 		cuSynchronize();
 		// 
-		PM_ApplyYielding<Real, Coord, Matrix, Bond> << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			PM_ApplyYielding,
 			m_yiled_I1,
 			m_yield_J2,
 			m_I1,
@@ -549,7 +550,7 @@ namespace dyno
 		cuSynchronize();
 	}
 
-	template <typename Real, typename Coord, typename Matrix, typename Bond>
+	template <typename Real, typename Coord, typename Bond>
 	__global__ void EM_RotateRestShape(
 		DArray<Coord> X,
 		DArray<Coord> Y,
@@ -557,6 +558,8 @@ namespace dyno
 		DArrayList<Bond> bonds,
 		Real smoothingLength)
 	{
+		typedef SquareMatrix<Real, 3> Matrix;
+
 		int pId = threadIdx.x + (blockIdx.x * blockDim.x);
 		if (pId >= Y.size()) return;
 
@@ -633,9 +636,9 @@ namespace dyno
 	void ElastoplasticityModule<TDataType>::rotateRestShape()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
-		EM_RotateRestShape <Real, Coord, Matrix, Bond> << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			EM_RotateRestShape,
 			this->inX()->getData(),
 			this->inY()->getData(),
 			m_bYield,
@@ -24,7 +24,7 @@ namespace dyno {
 		typedef typename TDataType::Real Real;
 		typedef typename TDataType::Coord Coord;
 		typedef typename TDataType::Matrix Matrix;
-		typedef typename TBond<TDataType> Bond;
+		typedef TBond<TDataType> Bond;
 
 		ElastoplasticityModule();
 		~ElastoplasticityModule() override;
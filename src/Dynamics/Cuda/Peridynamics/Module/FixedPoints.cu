@@ -1,4 +1,3 @@
-#include <cuda_runtime.h>
 #include "Log.h"
 #include "Node.h"
 #include "FixedPoints.h"
@@ -150,9 +149,9 @@ namespace dyno
 		}
 
 
-		uint pDims = cudaGridSize(m_bFixed.size(), BLOCK_SIZE);
-
-		K_DoFixPoints<Coord> << < pDims, BLOCK_SIZE >> > (this->inPosition()->getData(), this->inVelocity()->getData(), m_bFixed, m_fixed_positions);
+		cuExecute(m_bFixed.size(),
+			K_DoFixPoints,
+			this->inPosition()->getData(), this->inVelocity()->getData(), m_bFixed, m_fixed_positions);
 	}
 	
 
@@ -175,9 +174,9 @@ namespace dyno
 	template<typename TDataType>
 	void FixedPoints<TDataType>::constrainPositionToPlane(Coord pos, Coord dir)
 	{
-		uint pDims = cudaGridSize(m_bFixed.size(), BLOCK_SIZE);
-
-		K_DoPlaneConstrain<< < pDims, BLOCK_SIZE >> > (this->inPosition()->getData(), pos, dir);
+		cuExecute(m_bFixed.size(),
+			K_DoPlaneConstrain,
+			this->inPosition()->getData(), pos, dir);
 	}
 
 	DEFINE_CLASS(FixedPoints);
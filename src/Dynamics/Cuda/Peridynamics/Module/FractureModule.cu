@@ -112,12 +112,12 @@ namespace dyno
 	void FractureModule<TDataType>::applyPlasticity()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
 		Real A = this->computeA();
 		Real B = this->computeB();
 
-		PM_ComputeInvariants<< <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			PM_ComputeInvariants,
 			this->mBulkStiffness,
 			this->inX()->getData(),
 			this->inY()->getData(),
@@ -12,7 +12,7 @@ namespace dyno {
 	public:
 		typedef typename TDataType::Real Real;
 		typedef typename TDataType::Coord Coord;
-		typedef typename TBond<TDataType> Bond;
+		typedef TBond<TDataType> Bond;
 
 		FractureModule();
 		~FractureModule() override {};
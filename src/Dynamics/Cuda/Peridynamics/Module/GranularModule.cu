@@ -41,11 +41,11 @@ namespace dyno
 	void GranularModule<TDataType>::computeMaterialStiffness()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
 		m_densitySum->compute();
 
-		PM_ComputeStiffness << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			PM_ComputeStiffness,
 			this->mBulkStiffness,
 			m_densitySum->outDensity()->getData());
 		cuSynchronize();
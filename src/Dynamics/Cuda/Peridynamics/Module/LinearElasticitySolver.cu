@@ -18,12 +18,14 @@ namespace dyno
 	}
 
 
-	template <typename Real, typename Coord, typename Matrix, typename Bond>
+	template <typename Coord, typename Matrix, typename Bond>
 	__global__ void EM_PrecomputeShape(
 		DArray<Matrix> invK,
 		DArray<Coord> X,
 		DArrayList<Bond> bonds)
 	{
+		typedef typename Coord::VarType Real;
+
 		int pId = threadIdx.x + (blockIdx.x * blockDim.x);
 		if (pId >= invK.size()) return;
 
@@ -272,12 +274,12 @@ namespace dyno
 	void LinearElasticitySolver<TDataType>::enforceElasticity()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
 		mDisplacement.reset();
 		mWeights.reset();
 
-		EM_EnforceElasticity << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			EM_EnforceElasticity,
 			mDisplacement,
 			mWeights,
 			mBulkStiffness,
@@ -289,7 +291,8 @@ namespace dyno
 			this->varLambda()->getData());
 		cuSynchronize();
 
-		K_UpdatePosition << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			K_UpdatePosition,
 			this->inY()->getData(),
 			mPosBuf,
 			mDisplacement,
@@ -311,8 +314,9 @@ namespace dyno
 	{
 		int num = this->inY()->size();
 
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
-		EM_InitBulkStiffness << <pDims, BLOCK_SIZE >> > (mBulkStiffness);
+		cuExecute(num,
+			EM_InitBulkStiffness,
+			mBulkStiffness);
 	}
 
 
@@ -320,9 +324,9 @@ namespace dyno
 	void LinearElasticitySolver<TDataType>::computeInverseK()
 	{
 		auto& restShapes = this->inBonds()->getData();
-		uint pDims = cudaGridSize(restShapes.size(), BLOCK_SIZE);
 
-		EM_PrecomputeShape <Real, Coord, Matrix, Bond> << <pDims, BLOCK_SIZE >> > (
+		cuExecute(restShapes.size(),
+			EM_PrecomputeShape,
 			mInvK,
 			this->inX()->getData(),
 			restShapes);
@@ -351,11 +355,11 @@ namespace dyno
 	void LinearElasticitySolver<TDataType>::updateVelocity()
 	{
 		int num = this->inY()->size();
-		uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
 		Real dt = this->inTimeStep()->getData();
 
-		K_UpdateVelocity << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			K_UpdateVelocity,
 			this->inVelocity()->getData(),
 			mPosBuf,
 			this->inY()->getData(),
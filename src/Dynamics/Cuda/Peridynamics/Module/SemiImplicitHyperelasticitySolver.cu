@@ -2,7 +2,6 @@
 
 #include "Matrix/MatrixFunc.h"
 #include "ParticleSystem/Module/Kernel.h"
-#include "curand_kernel.h"
 #include "Algorithm/CudaRand.h"
 
 namespace dyno
@@ -35,11 +34,11 @@ namespace dyno
 	template<typename TDataType>
 	SemiImplicitHyperelasticitySolver<TDataType>::~SemiImplicitHyperelasticitySolver()
 	{
-		mWeights.clear();
-		mDisplacement.clear();
-		mInvK.clear();
-		mF.clear();
-		mPosBuf.clear();
+		this->mWeights.clear();
+		this->mDisplacement.clear();
+		this->mInvK.clear();
+		this->mF.clear();
+		this->mPosBuf.clear();
 	}
 
 	template <typename Real, typename Coord, typename Matrix>
@@ -86,7 +85,8 @@ namespace dyno
 	template<typename TDataType>
 	void SemiImplicitHyperelasticitySolver<TDataType>::solveElasticity()
 	{
-		cudaMemcpyToSymbol(ENERGY_FUNC, &this->inEnergyModels()->getData(), sizeof(EnergyModels<Real>));
+		EnergyModels<Real> models = this->inEnergyModels()->getData();
+		cudaMemcpyToSymbol(ENERGY_FUNC, &models, sizeof(EnergyModels<Real>));
 
 		enforceHyperelasticity();
 	}
@@ -835,7 +835,7 @@ namespace dyno
 		m_source.resize(num);
 		m_A.resize(num);
 
-		mPosBuf.resize(num);
+		this->mPosBuf.resize(num);
 
 		m_fraction.resize(num);
 
@@ -856,7 +856,6 @@ namespace dyno
 		resizeAllFields();
 
 		int numOfParticles = this->inY()->size();
-		uint pDims = cudaGridSize(numOfParticles, BLOCK_SIZE);
 
 		std::cout << "enforceElasticity " << numOfParticles << std::endl;
 
@@ -868,7 +867,7 @@ namespace dyno
 		// initialize y_now, y_next_iter
 		y_current.assign(this->inY()->getData());
 		y_next.assign(this->inY()->getData());
-		mPosBuf.assign(this->inY()->getData());
+		this->mPosBuf.assign(this->inY()->getData());
 
 		// do Jacobi method Loop
 		bool convergeFlag = false; // converge or not
@@ -884,7 +883,8 @@ namespace dyno
 			
 			m_source.reset();
 			m_A.reset();
-			HM_ComputeF << <pDims, BLOCK_SIZE >> > (
+			cuExecute(numOfParticles,
+				HM_ComputeF,
 				m_F,
 				m_eigenValues,
 				m_invK,
@@ -899,7 +899,8 @@ namespace dyno
 				this->inHorizon()->getData());
 			cuSynchronize();
 			
-			HM_JacobiStepNonsymmetric << <pDims, BLOCK_SIZE >> > (
+			cuExecute(numOfParticles,
+				HM_JacobiStepNonsymmetric,
 				m_source,
 				m_A,
 				y_current,
@@ -922,7 +923,7 @@ namespace dyno
 				HM_ComputeNextPosition,
 				y_next,
 				y_current,
-				mPosBuf,
+				this->mPosBuf,
 				m_source,
 				m_A,
 				this->inVolume()->getData(),
@@ -991,7 +992,7 @@ namespace dyno
 			this->inY()->getData(),
 			this->inVelocity()->getData(),
 			y_next,
-			mPosBuf,
+			this->mPosBuf,
 			this->inAttribute()->getData(),
 			this->inTimeStep()->getData());
 		printf("outside\n");
@@ -28,11 +28,11 @@ namespace dyno
 		typedef typename TDataType::Coord Coord;
 		typedef typename TDataType::Matrix Matrix;
 
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 		typedef typename dyno::Quat<Real> TQuat;
 
 		CarDriver();
@@ -37,11 +37,11 @@ namespace dyno
 		typedef typename ::dyno::TContactPair<Real> ContactPair;
 		typedef typename ::dyno::TConstraintPair<Real> Constraint;
 
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 
 		PCGConstraintSolver();
 		~PCGConstraintSolver();
@@ -494,6 +494,7 @@ namespace dyno
 			dt
 		);
 
+		uint velocityIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
 			int contact_size = this->inContacts()->size();
@@ -503,8 +504,27 @@ namespace dyno
 
 
 
-			for (int i = 0; i < this->varIterationNumberForVelocitySolver()->getValue(); i++)
+			bool hasFriction = this->varFrictionEnabled()->getValue();
+			bool warmStart = this->varWarmStartEnabled()->getValue() && !this->inContacts()->isEmpty();
+			if (warmStart)
 			{
+				mContactCache.warmStart(
+					mLambda,
+					mImpulseC,
+					mB,
+					mContactsInLocalFrame,
+					hasFriction,
+					this->varWarmStartFactor()->getValue());
+			}
+
+			Real tolerance = this->varVelocityTolerance()->getValue();
+			uint maxIter = this->varIterationNumberForVelocitySolver()->getValue();
+			for (uint j = 0; j < maxIter; j++)
+			{
+				bool check = tolerance > 0 && (j + 1) % CONVERGENCE_CHECK_INTERVAL == 0;
+				if (check)
+					mImpulsePrev.assign(mImpulseC);
+
 				JacobiIteration(
 					mLambda,
 					mImpulseC,
@@ -521,8 +541,15 @@ namespace dyno
 					this->varGravityValue()->getData(),
 					dt
 				);
+				velocityIter++;
+
+				if (check && maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+					break;
 			}
 
+			if (warmStart)
+				mContactCache.update(mLambda, mContactsInLocalFrame, hasFriction);
+
 			Real norm = checkOutError(
 				mJ,
 				mImpulseC,
@@ -604,9 +631,10 @@ namespace dyno
 			);
 		}
 
+		if (this->inContacts()->isEmpty() || !this->varWarmStartEnabled()->getValue())
+			mContactCache.clear();
 
-		
-		
+		this->outVelocityIterationNumber()->setValue(velocityIter);
 	}
 
 	DEFINE_CLASS(PJSConstraintSolver);
@@ -21,6 +21,8 @@
 
 #include "Topology/DiscreteElements.h"
 
+#include "RigidContactCache.h"
+
 namespace dyno
 {
 	template<typename TDataType>
@@ -36,11 +38,11 @@ namespace dyno
 		typedef typename ::dyno::TContactPair<Real> ContactPair;
 		typedef typename ::dyno::TConstraintPair<Real> Constraint;
 
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 
 		PJSConstraintSolver();
 		~PJSConstraintSolver();
@@ -64,6 +66,14 @@ namespace dyno
 
 		DEF_VAR(Real, AngularDamping, 0.1, "");
 
+		DEF_VAR(bool, WarmStartEnabled, false, "Start the velocity solver with the contact impulses of the last step");
+
+		DEF_VAR(Real, WarmStartFactor, 0.9, "Fraction of the cached contact impulses applied at the beginning of a step");
+
+		DEF_VAR(Real, VelocityTolerance, 0.0001, "The velocity solver stops once no body velocity changes by more than the tolerance in an iteration, 0 runs all iterations");
+
+		DEF_VAR_OUT(uint, VelocityIterationNumber, "Number of velocity iterations performed in the last step");
+
 	public:
 		DEF_VAR_IN(Real, TimeStep, "Time step size");
 
@@ -121,5 +131,9 @@ namespace dyno
 		DArray<Real> mErrors;
 		DArray<Real> mA;
 
+		RigidContactCache mContactCache;
+
+		DArray<Coord> mImpulsePrev;
+		DArray<Real> mImpulseChange;
 	};
 }
\ No newline at end of file
@@ -455,12 +455,32 @@ namespace dyno
 		}
 
 		//Velocity Solver
+		uint velocityIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
 			initializeJacobian(dt);
-			int constraint_size = mVelocityConstraints.size();
-			for (int i = 0; i < this->varIterationNumberForVelocitySolver()->getValue(); i++)
+
+			bool hasFriction = this->varFrictionEnabled()->getValue();
+			bool warmStart = this->varWarmStartEnabled()->getValue() && !this->inContacts()->isEmpty();
+			if (warmStart)
 			{
+				mContactCache.warmStart(
+					mLambda,
+					mImpulseC,
+					mB,
+					mContactsInLocalFrame,
+					hasFriction,
+					this->varWarmStartFactor()->getValue());
+			}
+
+			Real tolerance = this->varVelocityTolerance()->getValue();
+			uint maxIter = this->varIterationNumberForVelocitySolver()->getValue();
+			while (velocityIter < maxIter)
+			{
+				bool check = tolerance > 0 && (velocityIter + 1) % CONVERGENCE_CHECK_INTERVAL == 0;
+				if (check)
+					mImpulsePrev.assign(mImpulseC);
+
 				JacobiIteration(
 					mLambda,
 					mImpulseC,
@@ -477,9 +497,22 @@ namespace dyno
 					this->varGravityValue()->getData(),
 					dt
 				);
+				velocityIter++;
+
+				if (check && maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+					break;
 			}
+
+			//The position solver below reuses mLambda, store the contact impulses before
+			if (warmStart)
+				mContactCache.update(mLambda, mContactsInLocalFrame, hasFriction);
 		}
 
+		if (this->inContacts()->isEmpty() || !this->varWarmStartEnabled()->getValue())
+			mContactCache.clear();
+
+		this->outVelocityIterationNumber()->setValue(velocityIter);
+
 		updateVelocity(
 			this->inVelocity()->getData(),
 			this->inAngularVelocity()->getData(),
@@ -501,9 +534,19 @@ namespace dyno
 		);
 
 		// Position Solver
+		uint positionIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
-			for (int i = 0; i < this->varIterationNumberForPositionSolver()->getValue(); i++)
+			//The corrections start from zero in each iteration, they are compared against a zero array
+			Real tolerance = this->varPositionTolerance()->getValue();
+			if (tolerance > 0)
+			{
+				mImpulsePrev.resize(bodyNum * 2);
+				mImpulsePrev.reset();
+			}
+
+			uint maxIter = this->varIterationNumberForPositionSolver()->getValue();
+			while (positionIter < maxIter)
 			{
 				mImpulseC.reset();
 				mLambda.reset();
@@ -533,8 +576,15 @@ namespace dyno
 					this->inInitialInertia()->getData(),
 					mImpulseC
 				);
+				positionIter++;
+
+				if (tolerance > 0 && positionIter % CONVERGENCE_CHECK_INTERVAL == 0
+					&& maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+					break;
 			}
 		}
+
+		this->outPositionIterationNumber()->setValue(positionIter);
 	}
 	DEFINE_CLASS(PJSNJSConstraintSolver);
 }
\ No newline at end of file
@@ -282,12 +282,32 @@ namespace dyno
 			dt
 		);
 
+		uint velocityIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
 			initializeJacobian(dt);
-			int constraint_size = mVelocityConstraints.size();
-			for (int i = 0; i < this->varIterationNumberForVelocitySolver()->getValue(); i++)
+
+			bool hasFriction = this->varFrictionEnabled()->getValue();
+			bool warmStart = this->varWarmStartEnabled()->getValue() && !this->inContacts()->isEmpty();
+			if (warmStart)
+			{
+				mContactCache.warmStart(
+					mLambda,
+					mImpulseC,
+					mB,
+					mContactsInLocalFrame,
+					hasFriction,
+					this->varWarmStartFactor()->getValue());
+			}
+
+			Real tolerance = this->varVelocityTolerance()->getValue();
+			uint maxIter = this->varIterationNumberForVelocitySolver()->getValue();
+			for (uint i = 0; i < maxIter; i++)
 			{
+				bool check = tolerance > 0 && (i + 1) % CONVERGENCE_CHECK_INTERVAL == 0;
+				if (check)
+					mImpulsePrev.assign(mImpulseC);
+
 				JacobiIterationForSoft(
 					mLambda,
 					mImpulseC,
@@ -306,7 +326,14 @@ namespace dyno
 					this->varDampingRatio()->getValue(),
 					this->varHertz()->getValue()
 				);
+				velocityIter++;
+
+				if (check && maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+					break;
 			}
+
+			if (warmStart)
+				mContactCache.update(mLambda, mContactsInLocalFrame, hasFriction);
 		}
 
 		updateVelocity(
@@ -328,6 +355,11 @@ namespace dyno
 			this->inInitialInertia()->getData(),
 			dt
 		);
+
+		if (this->inContacts()->isEmpty() || !this->varWarmStartEnabled()->getValue())
+			mContactCache.clear();
+
+		this->outVelocityIterationNumber()->setValue(velocityIter);
 	}
 
 	DEFINE_CLASS(PJSoftConstraintSolver);
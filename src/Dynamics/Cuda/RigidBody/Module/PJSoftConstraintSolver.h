@@ -21,6 +21,8 @@
 
 #include "Topology/DiscreteElements.h"
 
+#include "RigidContactCache.h"
+
 namespace dyno
 {
 	template<typename TDataType>
@@ -36,11 +38,11 @@ namespace dyno
 		typedef typename ::dyno::TContactPair<Real> ContactPair;
 		typedef typename ::dyno::TConstraintPair<Real> Constraint;
 
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 
 		PJSoftConstraintSolver();
 		~PJSoftConstraintSolver();
@@ -66,6 +68,13 @@ namespace dyno
 
 		DEF_VAR(Real, Hertz, 300, "");
 
+		DEF_VAR(bool, WarmStartEnabled, false, "Start the velocity solver with the contact impulses of the last step");
+
+		DEF_VAR(Real, WarmStartFactor, 0.9, "Fraction of the cached contact impulses applied at the beginning of a step");
+
+		DEF_VAR(Real, VelocityTolerance, 0.0001, "The velocity solver stops once no body velocity changes by more than the tolerance in an iteration, 0 runs all iterations");
+
+		DEF_VAR_OUT(uint, VelocityIterationNumber, "Number of velocity iterations performed in the last step");
 
 	public:
 		DEF_VAR_IN(Real, TimeStep, "Time step size");
@@ -115,5 +124,10 @@ namespace dyno
 		DArray<Real> mK_1;
 		DArray<Mat2f> mK_2;
 		DArray<Matrix> mK_3;
+
+		RigidContactCache mContactCache;
+
+		DArray<Coord> mImpulsePrev;
+		DArray<Real> mImpulseChange;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include "RigidBodyIslands.h"
+
+#include "Algorithm/Reduction.h"
+
+namespace dyno
+{
+	IMPLEMENT_TCLASS(RigidBodyIslands, TDataType)
+
+	template<typename TDataType>
+	RigidBodyIslands<TDataType>::RigidBodyIslands()
+		: ComputeModule()
+	{
+		this->inContacts()->tagOptional(true);
+		this->inFrameNumber()->tagOptional(true);
+	}
+
+	template<typename TDataType>
+	RigidBodyIslands<TDataType>::~RigidBodyIslands()
+	{
+		mParent.clear();
+		mRestTime.clear();
+
+		mIslandAwake.clear();
+		mIslandFlag.clear();
+		mContactFlag.clear();
+		mContactIndex.clear();
+	}
+
+	//Parents are written by other threads concurrently, they have to be read from memory every time
+	DYN_FUNC inline int RBI_Find(volatile int* parent, int i)
+	{
+		int p = parent[i];
+		while (p != i)
+		{
+			i = p;
+			p = parent[i];
+		}
+
+		return i;
+	}
+
+	//Hook the larger root onto the smaller one, retry if another thread has hooked the root in the meantime
+	GPU_FUNC inline void RBI_Union(int* parent, int a, int b)
+	{
+		if (a < 0 || b < 0)
+			return;
+
+		a = RBI_Find(parent, a);
+		b = RBI_Find(parent, b);
+
+		while (a != b)
+		{
+			if (a > b)
+			{
+				int t = a; a = b; b = t;
+			}
+
+			int old = atomicCAS(parent + b, b, a);
+			if (old == b)
+				return;
+
+			b = RBI_Find(parent, old);
+			a = RBI_Find(parent, a);
+		}
+	}
+
+	__global__ void RBI_InitParent(
+		DArray<int> parent)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= parent.size()) return;
+
+		parent[tId] = tId;
+	}
+
+	template<typename Pair>
+	__global__ void RBI_UnionPairs(
+		DArray<int> parent,
+		DArray<Pair> pairs)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= pairs.size()) return;
+
+		RBI_Union(parent.begin(), pairs[tId].bodyId1, pairs[tId].bodyId2);
+	}
+
+	__global__ void RBI_Compress(
+		DArray<int> parent)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= parent.size()) return;
+
+		parent[tId] = RBI_Find(parent.begin(), tId);
+	}
+
+	template<typename Real, typename Coord>
+	__global__ void RBI_UpdateRestTime(
+		DArray<Real> restTime,
+		DArray<Coord> velocity,
+		DArray<Coord> angularVelocity,
+		Real linearThreshold,
+		Real angularThreshold,
+		Real dt)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= restTime.size()) return;
+
+		bool rest = velocity[tId].normSquared() < linearThreshold * linearThreshold
+			&& angularVelocity[tId].normSquared() < angularThreshold * angularThreshold;
+
+		restTime[tId] = rest ? restTime[tId] + dt : Real(0);
+	}
+
+	template<typename Real>
+	__global__ void RBI_MarkAwakeIslands(
+		DArray<int> islandAwake,
+		DArray<int> parent,
+		DArray<Real> restTime,
+		Real delay,
+		bool sleepingEnabled)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= parent.size()) return;
+
+		if (!sleepingEnabled || restTime[tId] < delay)
+			islandAwake[parent[tId]] = 1;
+	}
+
+	__global__ void RBI_FlagRoots(
+		DArray<int> islandFlag,
+		DArray<bool> sleeping,
+		DArray<int> parent,
+		DArray<int> islandAwake)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= parent.size()) return;
+
+		islandFlag[tId] = parent[tId] == tId ? 1 : 0;
+		sleeping[tId] = islandAwake[parent[tId]] == 0;
+	}
+
+	__global__ void RBI_SetupIslandIndex(
+		DArray<int> islandIndex,
+		DArray<int> parent,
+		DArray<int> islandFlag)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= parent.size()) return;
+
+		islandIndex[tId] = islandFlag[parent[tId]];
+	}
+
+	template<typename Contact>
+	__global__ void RBI_FlagAwakeContacts(
+		DArray<int> contactFlag,
+		DArray<Contact> contacts,
+		DArray<bool> sleeping)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= contacts.size()) return;
+
+		int bodyId = contacts[tId].bodyId1 >= 0 ? contacts[tId].bodyId1 : contacts[tId].bodyId2;
+		contactFlag[tId] = bodyId >= 0 && sleeping[bodyId] ? 0 : 1;
+	}
+
+	template<typename Contact>
+	__global__ void RBI_CompactContacts(
+		DArray<Contact> awakeContacts,
+		DArray<Contact> contacts,
+		DArray<int> contactFlag,
+		DArray<int> contactIndex)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= contacts.size()) return;
+
+		if (contactFlag[tId] == 1)
+			awakeContacts[contactIndex[tId]] = contacts[tId];
+	}
+
+	template<typename TDataType>
+	template<typename Joint>
+	void RigidBodyIslands<TDataType>::unionJoints(DArray<Joint>& joints)
+	{
+		cuExecute(joints.size(),
+			RBI_UnionPairs,
+			mParent,
+			joints);
+	}
+
+	template<typename TDataType>
+	void RigidBodyIslands<TDataType>::compute()
+	{
+		uint bodyNum = this->inVelocity()->size();
+
+		//Bodies have been added or removed or the scene has been reset, all of them start awake
+		uint frame = this->inFrameNumber()->isEmpty() ? mFrameNumber : this->inFrameNumber()->getValue();
+		if (mRestTime.size() != bodyNum || frame < mFrameNumber)
+		{
+			mRestTime.resize(bodyNum);
+			mRestTime.reset();
+		}
+		mFrameNumber = frame;
+
+		mParent.resize(bodyNum);
+		mIslandAwake.resize(bodyNum);
+		mIslandFlag.resize(bodyNum);
+
+		this->outIslandIndex()->resize(bodyNum);
+		this->outSleeping()->resize(bodyNum);
+
+		auto& islandIndex = this->outIslandIndex()->getData();
+		auto& sleeping = this->outSleeping()->getData();
+
+		if (bodyNum == 0)
+		{
+			this->outAwakeContacts()->resize(0);
+
+			this->outIslandNumber()->setValue(0);
+			this->outAwakeIslandNumber()->setValue(0);
+			return;
+		}
+
+		//Build the islands
+		cuExecute(bodyNum,
+			RBI_InitParent,
+			mParent);
+
+		bool hasContacts = !this->inContacts()->isEmpty();
+		if (hasContacts)
+		{
+			auto& contacts = this->inContacts()->getData();
+
+			cuExecute(contacts.size(),
+				RBI_UnionPairs,
+				mParent,
+				contacts);
+		}
+
+		auto topo = this->inDiscreteElements()->getDataPtr();
+		if (topo != nullptr)
+		{
+			unionJoints(topo->ballAndSocketJoints());
+			unionJoints(topo->sliderJoints());
+			unionJoints(topo->hingeJoints());
+			unionJoints(topo->fixedJoints());
+			unionJoints(topo->pointJoints());
+		}
+
+		cuExecute(bodyNum,
+			RBI_Compress,
+			mParent);
+
+		//Islands with at least one moving body are awake
+		cuExecute(bodyNum,
+			RBI_UpdateRestTime,
+			mRestTime,
+			this->inVelocity()->getData(),
+			this->inAngularVelocity()->getData(),
+			this->varSleepLinearVelocity()->getValue(),
+			this->varSleepAngularVelocity()->getValue(),
+			this->inTimeStep()->getValue());
+
+		mIslandAwake.reset();
+		cuExecute(bodyNum,
+			RBI_MarkAwakeIslands,
+			mIslandAwake,
+			mParent,
+			mRestTime,
+			this->varSleepDelay()->getValue(),
+			this->varSleepingEnabled()->getValue());
+
+		cuExecute(bodyNum,
+			RBI_FlagRoots,
+			mIslandFlag,
+			sleeping,
+			mParent,
+			mIslandAwake);
+
+		Reduction<int> reduce;
+		uint islandNum = reduce.accumulate(mIslandFlag.begin(), mIslandFlag.size());
+		uint awakeIslandNum = reduce.accumulate(mIslandAwake.begin(), mIslandAwake.size());
+
+		mScan.exclusive(mIslandFlag, true);
+
+		cuExecute(bodyNum,
+			RBI_SetupIslandIndex,
+			islandIndex,
+			mParent,
+			mIslandFlag);
+
+		this->outIslandNumber()->setValue(islandNum);
+		this->outAwakeIslandNumber()->setValue(awakeIslandNum);
+
+		//Pass on the contacts of awake islands only
+		if (!hasContacts)
+		{
+			this->outAwakeContacts()->resize(0);
+			return;
+		}
+
+		auto& contacts = this->inContacts()->getData();
+		uint contactNum = contacts.size();
+
+		mContactFlag.resize(contactNum);
+		cuExecute(contactNum,
+			RBI_FlagAwakeContacts,
+			mContactFlag,
+			contacts,
+			sleeping);
+
+		uint awakeContactNum = reduce.accumulate(mContactFlag.begin(), mContactFlag.size());
+
+		this->outAwakeContacts()->resize(awakeContactNum);
+		auto& awakeContacts = this->outAwakeContacts()->getData();
+
+		if (awakeContactNum == contactNum)
+		{
+			awakeContacts.assign(contacts);
+			return;
+		}
+
+		mContactIndex.assign(mContactFlag);
+		mScan.exclusive(mContactIndex, true);
+
+		cuExecute(contactNum,
+			RBI_CompactContacts,
+			awakeContacts,
+			contacts,
+			mContactFlag,
+			mContactIndex);
+	}
+
+	DEFINE_CLASS(RigidBodyIslands);
+}
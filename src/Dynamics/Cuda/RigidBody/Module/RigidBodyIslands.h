@@ -0,0 +1,103 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Module/ComputeModule.h"
+
+#include "Collision/CollisionData.h"
+#include "Topology/DiscreteElements.h"
+
+#include "Algorithm/Scan.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Split the rigid bodies into islands connected by contacts and joints, and put islands at rest to sleep.
+	 *
+	 *	The islands are built with a lock-free union-find over the contacts and all joint arrays.
+	 *	An island falls asleep once all its bodies have moved slower than the sleep thresholds for SleepDelay seconds,
+	 *	a contact or joint connecting it to an awake body merges both into one awake island, which wakes it up again.
+	 *	Only the contacts of awake islands are passed on to the constraint solver, SleepingBodyFreezer keeps the sleeping bodies in place.
+	 *
+	 *	Sleeping is disabled by default. RigidBodySystem and Vechicle contain both modules,
+	 *	pipelines assembled by hand have to insert them between the collision detection and the solver to let bodies sleep.
+	 */
+	template<typename TDataType>
+	class RigidBodyIslands : public ComputeModule
+	{
+		DECLARE_TCLASS(RigidBodyIslands, TDataType)
+	public:
+		typedef typename TDataType::Real Real;
+		typedef typename TDataType::Coord Coord;
+		typedef typename ::dyno::TContactPair<Real> ContactPair;
+
+		RigidBodyIslands();
+		~RigidBodyIslands() override;
+
+	public:
+		DEF_VAR(bool, SleepingEnabled, false, "Islands at rest are excluded from the simulation");
+
+		DEF_VAR(Real, SleepLinearVelocity, 0.05, "Bodies slower than the threshold are at rest");
+
+		DEF_VAR(Real, SleepAngularVelocity, 0.05, "Bodies rotating slower than the threshold are at rest");
+
+		DEF_VAR(Real, SleepDelay, 0.5, "Time in seconds all bodies of an island have to rest before the island falls asleep");
+
+	public:
+		DEF_VAR_IN(Real, TimeStep, "Time step size");
+
+		DEF_VAR_IN(uint, FrameNumber, "Frame number, all bodies are woken up when it goes back after a reset");
+
+		DEF_ARRAY_IN(Coord, Velocity, DeviceType::GPU, "Velocity of rigid bodies");
+
+		DEF_ARRAY_IN(Coord, AngularVelocity, DeviceType::GPU, "Angular velocity of rigid bodies");
+
+		DEF_ARRAY_IN(ContactPair, Contacts, DeviceType::GPU, "");
+
+		DEF_INSTANCE_IN(DiscreteElements<TDataType>, DiscreteElements, "");
+
+		DEF_ARRAY_OUT(ContactPair, AwakeContacts, DeviceType::GPU, "Contacts of the awake islands");
+
+		DEF_ARRAY_OUT(int, IslandIndex, DeviceType::GPU, "Island index of each rigid body");
+
+		DEF_ARRAY_OUT(bool, Sleeping, DeviceType::GPU, "Whether each rigid body belongs to a sleeping island");
+
+		DEF_VAR_OUT(uint, IslandNumber, "Number of islands");
+
+		DEF_VAR_OUT(uint, AwakeIslandNumber, "Number of awake islands");
+
+	protected:
+		void compute() override;
+
+	private:
+		template<typename Joint>
+		void unionJoints(DArray<Joint>& joints);
+
+		//Parent of each body in the union-find forest, roots point to themselves
+		DArray<int> mParent;
+
+		//Time each body has been at rest
+		DArray<Real> mRestTime;
+
+		uint mFrameNumber = 0;
+
+		DArray<int> mIslandAwake;
+		DArray<int> mIslandFlag;
+		DArray<int> mContactFlag;
+		DArray<int> mContactIndex;
+
+		Scan<int> mScan;
+	};
+}
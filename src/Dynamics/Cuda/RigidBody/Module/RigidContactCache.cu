@@ -0,0 +1,226 @@
+#include "RigidContactCache.h"
+
+#include "Algorithm/Reduction.h"
+
+#include <thrust/sort.h>
+
+namespace dyno
+{
+	//Normals of matched contacts must not deviate by more than about 25 degrees
+	#define RCC_NORMAL_COSINE 0.9f
+
+	DYN_FUNC inline uint64 RCC_PairKey(int id1, int id2)
+	{
+		return ((uint64)(uint)id1 << 32) | (uint64)(uint)id2;
+	}
+
+	GPU_FUNC inline void RCC_ApplyImpulse(
+		DArray<Vec3f>& impulse,
+		DArray<Vec3f>& B,
+		int cId,
+		int idx1,
+		int idx2,
+		float lambda)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			atomicAdd(&impulse[idx1 * 2][i], B[4 * cId][i] * lambda);
+			atomicAdd(&impulse[idx1 * 2 + 1][i], B[4 * cId + 1][i] * lambda);
+		}
+
+		if (idx2 != INVALID)
+		{
+			for (int i = 0; i < 3; i++)
+			{
+				atomicAdd(&impulse[idx2 * 2][i], B[4 * cId + 2][i] * lambda);
+				atomicAdd(&impulse[idx2 * 2 + 1][i], B[4 * cId + 3][i] * lambda);
+			}
+		}
+	}
+
+	template<typename Contact>
+	__global__ void RCC_WarmStart(
+		DArray<float> lambda,
+		DArray<Vec3f> impulse,
+		DArray<Vec3f> B,
+		DArray<Contact> contacts,
+		DArray<uint64> keys,
+		DArray<Vec3f> points,
+		DArray<Vec3f> normals,
+		DArray<Vec3f> impulses,
+		DArray<int> matched,
+		bool hasFriction,
+		float factor,
+		float distance)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= contacts.size()) return;
+
+		Contact c = contacts[tId];
+		uint64 key = RCC_PairKey(c.bodyId1, c.bodyId2);
+
+		//Find the first entry of the pair
+		int lo = 0;
+		int hi = keys.size();
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (keys[mid] < key)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		int best = -1;
+		float bestDist = distance * distance;
+		for (int k = lo; k < keys.size() && keys[k] == key; k++)
+		{
+			float d = (points[k] - c.pos1).normSquared();
+			if (d < bestDist && normals[k].dot(c.normal1) > RCC_NORMAL_COSINE)
+			{
+				best = k;
+				bestDist = d;
+			}
+		}
+
+		matched[tId] = best < 0 ? 0 : 1;
+		if (best < 0) return;
+
+		Vec3f cached = impulses[best] * factor;
+
+		lambda[tId] = cached[0];
+		RCC_ApplyImpulse(impulse, B, tId, c.bodyId1, c.bodyId2, cached[0]);
+
+		if (hasFriction)
+		{
+			int fId = contacts.size() + 2 * tId;
+
+			lambda[fId] = cached[1];
+			RCC_ApplyImpulse(impulse, B, fId, c.bodyId1, c.bodyId2, cached[1]);
+
+			lambda[fId + 1] = cached[2];
+			RCC_ApplyImpulse(impulse, B, fId + 1, c.bodyId1, c.bodyId2, cached[2]);
+		}
+	}
+
+	template<typename Contact>
+	__global__ void RCC_SetupKeys(
+		DArray<uint64> keys,
+		DArray<int> order,
+		DArray<Contact> contacts)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= contacts.size()) return;
+
+		keys[tId] = RCC_PairKey(contacts[tId].bodyId1, contacts[tId].bodyId2);
+		order[tId] = tId;
+	}
+
+	template<typename Contact>
+	__global__ void RCC_Store(
+		DArray<Vec3f> points,
+		DArray<Vec3f> normals,
+		DArray<Vec3f> impulses,
+		DArray<int> order,
+		DArray<Contact> contacts,
+		DArray<float> lambda,
+		bool hasFriction)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= order.size()) return;
+
+		int cId = order[tId];
+		int fId = contacts.size() + 2 * cId;
+
+		points[tId] = contacts[cId].pos1;
+		normals[tId] = contacts[cId].normal1;
+		impulses[tId] = hasFriction ? Vec3f(lambda[cId], lambda[fId], lambda[fId + 1]) : Vec3f(lambda[cId], 0, 0);
+	}
+
+	RigidContactCache::~RigidContactCache()
+	{
+		this->clear();
+	}
+
+	void RigidContactCache::clear()
+	{
+		mKeys.clear();
+		mPoints.clear();
+		mNormals.clear();
+		mImpulses.clear();
+
+		mOrder.clear();
+		mMatched.clear();
+	}
+
+	uint RigidContactCache::warmStart(
+		DArray<float>& lambda,
+		DArray<Vec3f>& impulse,
+		DArray<Vec3f>& B,
+		DArray<TContactPair<float>>& contactsInLocalFrame,
+		bool hasFriction,
+		float factor)
+	{
+		uint num = contactsInLocalFrame.size();
+		if (num == 0 || mKeys.size() == 0)
+			return 0;
+
+		mMatched.resize(num, false);
+
+		cuExecute(num,
+			RCC_WarmStart,
+			lambda,
+			impulse,
+			B,
+			contactsInLocalFrame,
+			mKeys,
+			mPoints,
+			mNormals,
+			mImpulses,
+			mMatched,
+			hasFriction,
+			factor,
+			mMatchingDistance);
+
+		Reduction<int> reduce;
+		return (uint)reduce.accumulate(mMatched.begin(), mMatched.size());
+	}
+
+	void RigidContactCache::update(
+		DArray<float>& lambda,
+		DArray<TContactPair<float>>& contactsInLocalFrame,
+		bool hasFriction)
+	{
+		uint num = contactsInLocalFrame.size();
+		if (num == 0)
+		{
+			mKeys.clear();
+			return;
+		}
+
+		//Buffers keep their capacity since the number of contacts changes a little from step to step
+		mKeys.resize(num, false);
+		mOrder.resize(num, false);
+		mPoints.resize(num, false);
+		mNormals.resize(num, false);
+		mImpulses.resize(num, false);
+
+		cuExecute(num,
+			RCC_SetupKeys,
+			mKeys,
+			mOrder,
+			contactsInLocalFrame);
+
+		thrust::sort_by_key(thrust::device, mKeys.begin(), mKeys.begin() + num, mOrder.begin());
+
+		cuExecute(num,
+			RCC_Store,
+			mPoints,
+			mNormals,
+			mImpulses,
+			mOrder,
+			contactsInLocalFrame,
+			lambda,
+			hasFriction);
+	}
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+#include "Vector.h"
+
+#include "Collision/CollisionData.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Contact impulses of the last solve, used to warm start the contact constraints of the next one.
+	 *
+	 *	Contacts carry no feature ids, a contact is identified by its body pair and its contact point in the local frame of the first body.
+	 *	A new contact takes over the impulses of the closest cached contact of the same pair whose point lies within the matching distance
+	 *	and whose normal points in a similar direction. Entries are sorted by the body pair, so the lookup is a binary search.
+	 *
+	 *	The constraints are expected in the layout of setUpContactAndFrictionConstraints(): one non-penetration constraint per contact,
+	 *	followed by two friction constraints per contact if friction is enabled.
+	 */
+	class RigidContactCache
+	{
+	public:
+		RigidContactCache() {};
+		~RigidContactCache();
+
+		void clear();
+
+		/**
+		 * @brief Initialize lambda of the contact constraints with the cached impulses scaled by factor and add the resulting velocity changes to impulse
+		 *
+		 * @param contactsInLocalFrame contacts produced by setUpContactsInLocalFrame()
+		 * @return the number of contacts that are warm started
+		 */
+		uint warmStart(
+			DArray<float>& lambda,
+			DArray<Vec3f>& impulse,
+			DArray<Vec3f>& B,
+			DArray<TContactPair<float>>& contactsInLocalFrame,
+			bool hasFriction,
+			float factor);
+
+		/**
+		 * @brief Replace the cached impulses with lambda of the contact constraints
+		 */
+		void update(
+			DArray<float>& lambda,
+			DArray<TContactPair<float>>& contactsInLocalFrame,
+			bool hasFriction);
+
+		/**
+		 * @brief Contacts of the same pair are matched if their points in the local frame are closer than distance
+		 */
+		void setMatchingDistance(float distance) { mMatchingDistance = distance; }
+
+		uint size() const { return mKeys.size(); }
+
+	private:
+		DArray<uint64> mKeys;
+		DArray<Vec3f> mPoints;
+		DArray<Vec3f> mNormals;
+
+		//Impulses of the non-penetration constraint and the two friction constraints
+		DArray<Vec3f> mImpulses;
+
+		DArray<int> mOrder;
+		DArray<int> mMatched;
+
+		float mMatchingDistance = 0.02f;
+	};
+}
@@ -5374,4 +5374,39 @@ namespace dyno
 			constraints);
 	}
 
+	template<typename Real, typename Coord>
+	__global__ void SF_calculateImpulseChange(
+		DArray<Real> change,
+		DArray<Coord> impulse,
+		DArray<Coord> impulsePrev
+	)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= impulse.size())
+			return;
+
+		change[tId] = (impulse[tId] - impulsePrev[tId]).norm();
+	}
+
+	float maximumImpulseChange(
+		DArray<Vec3f>& impulse,
+		DArray<Vec3f>& impulsePrev,
+		DArray<float>& change
+	)
+	{
+		int n = impulse.size();
+		if (n == 0)
+			return 0.0f;
+
+		change.resize(n, false);
+
+		cuExecute(n,
+			SF_calculateImpulseChange,
+			change,
+			impulse,
+			impulsePrev);
+
+		Reduction<float> reduce;
+		return reduce.maximum(change.begin(), n);
+	}
 }
\ No newline at end of file
@@ -13,6 +13,9 @@
 
 namespace dyno 
 {
+	//Number of iterations between two convergence checks of the iterative solvers, each check reads a value back from the GPU
+	const uint CONVERGENCE_CHECK_INTERVAL = 4;
+
 	void ApplyTransform(
 		DArrayList<Transform3f>& instanceTransform,
 		const DArray<Vec3f>& diff,
@@ -462,4 +465,16 @@ namespace dyno
 		DArray<float>& CFM,
 		DArray<TConstraintPair<float>>& constraints
 	);
+
+	/**
+	 * @brief Return the largest change of the linear or angular velocity stored in impulse since impulsePrev was taken,
+	 *	solvers stop iterating once it drops below their tolerance
+	 *
+	 * @param change scratch buffer, resized to the size of impulse
+	 */
+	float maximumImpulseChange(
+		DArray<Vec3f>& impulse,
+		DArray<Vec3f>& impulsePrev,
+		DArray<float>& change
+	);
 }
@@ -0,0 +1,79 @@
+#include "SleepingBodyFreezer.h"
+
+namespace dyno
+{
+	IMPLEMENT_TCLASS(SleepingBodyFreezer, TDataType)
+
+	template<typename TDataType>
+	SleepingBodyFreezer<TDataType>::~SleepingBodyFreezer()
+	{
+		mCenter.clear();
+		mRotationMatrix.clear();
+		mInertia.clear();
+		mQuaternion.clear();
+	}
+
+	template<typename Coord, typename Matrix, typename Quat>
+	__global__ void SBF_Restore(
+		DArray<Coord> center,
+		DArray<Coord> velocity,
+		DArray<Coord> angularVelocity,
+		DArray<Matrix> rotationMatrix,
+		DArray<Matrix> inertia,
+		DArray<Quat> quaternion,
+		DArray<Coord> lastCenter,
+		DArray<Matrix> lastRotationMatrix,
+		DArray<Matrix> lastInertia,
+		DArray<Quat> lastQuaternion,
+		DArray<bool> sleeping)
+	{
+		int tId = threadIdx.x + blockIdx.x * blockDim.x;
+		if (tId >= sleeping.size()) return;
+
+		if (!sleeping[tId])
+			return;
+
+		center[tId] = lastCenter[tId];
+		rotationMatrix[tId] = lastRotationMatrix[tId];
+		inertia[tId] = lastInertia[tId];
+		quaternion[tId] = lastQuaternion[tId];
+
+		velocity[tId] = Coord(0);
+		angularVelocity[tId] = Coord(0);
+	}
+
+	template<typename TDataType>
+	void SleepingBodyFreezer<TDataType>::compute()
+	{
+		auto& center = this->inCenter()->getData();
+		auto& rotationMatrix = this->inRotationMatrix()->getData();
+		auto& inertia = this->inInertia()->getData();
+		auto& quaternion = this->inQuaternion()->getData();
+
+		//Nothing is stored yet after the bodies have changed, islands start awake in that case anyway
+		auto& sleeping = this->inSleeping()->getData();
+		if (sleeping.size() == center.size() && mCenter.size() == center.size())
+		{
+			cuExecute(sleeping.size(),
+				SBF_Restore,
+				center,
+				this->inVelocity()->getData(),
+				this->inAngularVelocity()->getData(),
+				rotationMatrix,
+				inertia,
+				quaternion,
+				mCenter,
+				mRotationMatrix,
+				mInertia,
+				mQuaternion,
+				sleeping);
+		}
+
+		mCenter.assign(center);
+		mRotationMatrix.assign(rotationMatrix);
+		mInertia.assign(inertia);
+		mQuaternion.assign(quaternion);
+	}
+
+	DEFINE_CLASS(SleepingBodyFreezer);
+}
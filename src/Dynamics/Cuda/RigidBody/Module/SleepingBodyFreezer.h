@@ -0,0 +1,65 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Module/ComputeModule.h"
+
+namespace dyno
+{
+	/**
+	 * @brief Undo the integration of bodies in sleeping islands, to be placed after the constraint solver.
+	 *
+	 *	The constraint solver still applies gravity to sleeping bodies since their contacts are not solved,
+	 *	this module puts them back to the pose they had at the end of the last step and clears their velocities.
+	 */
+	template<typename TDataType>
+	class SleepingBodyFreezer : public ComputeModule
+	{
+		DECLARE_TCLASS(SleepingBodyFreezer, TDataType)
+	public:
+		typedef typename TDataType::Real Real;
+		typedef typename TDataType::Coord Coord;
+		typedef typename TDataType::Matrix Matrix;
+		typedef typename ::dyno::Quat<Real> TQuat;
+
+		SleepingBodyFreezer() {};
+		~SleepingBodyFreezer() override;
+
+	public:
+		DEF_ARRAY_IN(bool, Sleeping, DeviceType::GPU, "Whether each rigid body belongs to a sleeping island");
+
+		DEF_ARRAY_IN(Coord, Center, DeviceType::GPU, "Center of rigid bodies");
+
+		DEF_ARRAY_IN(Coord, Velocity, DeviceType::GPU, "Velocity of rigid bodies");
+
+		DEF_ARRAY_IN(Coord, AngularVelocity, DeviceType::GPU, "Angular velocity of rigid bodies");
+
+		DEF_ARRAY_IN(Matrix, RotationMatrix, DeviceType::GPU, "Rotation matrix of rigid bodies");
+
+		DEF_ARRAY_IN(Matrix, Inertia, DeviceType::GPU, "Interial matrix");
+
+		DEF_ARRAY_IN(TQuat, Quaternion, DeviceType::GPU, "Quaternion");
+
+	protected:
+		void compute() override;
+
+	private:
+		//Poses at the end of the last step
+		DArray<Coord> mCenter;
+		DArray<Matrix> mRotationMatrix;
+		DArray<Matrix> mInertia;
+		DArray<TQuat> mQuaternion;
+	};
+}
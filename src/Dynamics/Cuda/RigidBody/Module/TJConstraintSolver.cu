@@ -255,7 +255,7 @@ namespace dyno
 
 		Real dt = this->inTimeStep()->getData();
 
-
+		uint velocityIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
 			if (mContactsInLocalFrame.size() != this->inContacts()->size()) {
@@ -294,8 +294,27 @@ namespace dyno
 
 				mImpulseC.reset();
 				initializeJacobian(dh);
-				for (int j = 0; j < this->varIterationNumberForVelocitySolver()->getValue(); j++)
+				bool hasFriction = this->varFrictionEnabled()->getValue();
+				bool warmStart = this->varWarmStartEnabled()->getValue() && !this->inContacts()->isEmpty();
+				if (warmStart)
 				{
+					mContactCache.warmStart(
+						mLambda,
+						mImpulseC,
+						mB,
+						mContactsInLocalFrame,
+						hasFriction,
+						this->varWarmStartFactor()->getValue());
+				}
+
+				Real tolerance = this->varVelocityTolerance()->getValue();
+				uint maxIter = this->varIterationNumberForVelocitySolver()->getValue();
+				for (uint j = 0; j < maxIter; j++)
+				{
+					bool check = tolerance > 0 && (j + 1) % CONVERGENCE_CHECK_INTERVAL == 0;
+					if (check)
+						mImpulsePrev.assign(mImpulseC);
+
 					JacobiIteration(
 						mLambda,
 						mImpulseC,
@@ -312,8 +331,15 @@ namespace dyno
 						this->varGravityValue()->getData(),
 						dh
 					);
+					velocityIter++;
+
+					if (check && maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+						break;
 				}
 
+				if (warmStart)
+					mContactCache.update(mLambda, mContactsInLocalFrame, hasFriction);
+
 				updateVelocity(
 					this->inVelocity()->getData(),
 					this->inAngularVelocity()->getData(),
@@ -369,6 +395,10 @@ namespace dyno
 			);
 		}
 
+		if (this->inContacts()->isEmpty() || !this->varWarmStartEnabled()->getValue())
+			mContactCache.clear();
+
+		this->outVelocityIterationNumber()->setValue(velocityIter);
 	}
 
 	DEFINE_CLASS(TJConstraintSolver);
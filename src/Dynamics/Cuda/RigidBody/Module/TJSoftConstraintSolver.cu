@@ -457,7 +457,7 @@ namespace dyno
 
 		Real dt = this->inTimeStep()->getData();
 
-
+		uint velocityIter = 0;
 		if (!this->inContacts()->isEmpty() || topo->totalJointSize() > 0)
 		{
 			if (mContactsInLocalFrame.size() != this->inContacts()->size()) {
@@ -496,8 +496,27 @@ namespace dyno
 
 				mImpulseC.reset();
 				initializeJacobian(dh);
-				for (int j = 0; j < this->varIterationNumberForVelocitySolver()->getValue(); j++)
+				bool hasFriction = this->varFrictionEnabled()->getValue();
+				bool warmStart = this->varWarmStartEnabled()->getValue() && !this->inContacts()->isEmpty();
+				if (warmStart)
 				{
+					mContactCache.warmStart(
+						mLambda,
+						mImpulseC,
+						mB,
+						mContactsInLocalFrame,
+						hasFriction,
+						this->varWarmStartFactor()->getValue());
+				}
+
+				Real tolerance = this->varVelocityTolerance()->getValue();
+				uint maxIter = this->varIterationNumberForVelocitySolver()->getValue();
+				for (uint j = 0; j < maxIter; j++)
+				{
+					bool check = tolerance > 0 && (j + 1) % CONVERGENCE_CHECK_INTERVAL == 0;
+					if (check)
+						mImpulsePrev.assign(mImpulseC);
+
 					JacobiIterationForSoft(
 						mLambda,
 						mImpulseC,
@@ -516,8 +535,15 @@ namespace dyno
 						this->varDampingRatio()->getValue(),
 						this->varHertz()->getValue()
 					);
+					velocityIter++;
+
+					if (check && maximumImpulseChange(mImpulseC, mImpulsePrev, mImpulseChange) < tolerance)
+						break;
 				}
 
+				if (warmStart)
+					mContactCache.update(mLambda, mContactsInLocalFrame, hasFriction);
+
 				updateVelocity(
 					this->inVelocity()->getData(),
 					this->inAngularVelocity()->getData(),
@@ -608,6 +634,10 @@ namespace dyno
 			);
 		}
 
+		if (this->inContacts()->isEmpty() || !this->varWarmStartEnabled()->getValue())
+			mContactCache.clear();
+
+		this->outVelocityIterationNumber()->setValue(velocityIter);
 	}
 
 	DEFINE_CLASS(TJSoftConstraintSolver);
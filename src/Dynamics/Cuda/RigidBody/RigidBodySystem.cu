@@ -14,6 +14,8 @@
 
 //Module headers
 #include "RigidBody/Module/ContactsUnion.h"
+#include "RigidBody/Module/RigidBodyIslands.h"
+#include "RigidBody/Module/SleepingBodyFreezer.h"
 
 namespace dyno
 {
@@ -45,6 +47,15 @@ namespace dyno
 
 		this->animationPipeline()->pushModule(merge);
 
+		auto islands = std::make_shared<RigidBodyIslands<TDataType>>();
+		this->stateTimeStep()->connect(islands->inTimeStep());
+		this->stateFrameNumber()->connect(islands->inFrameNumber());
+		this->stateVelocity()->connect(islands->inVelocity());
+		this->stateAngularVelocity()->connect(islands->inAngularVelocity());
+		this->stateTopology()->connect(islands->inDiscreteElements());
+		merge->outContacts()->connect(islands->inContacts());
+		this->animationPipeline()->pushModule(islands);
+
 		auto iterSolver = std::make_shared<PJSoftConstraintSolver<TDataType>>();
 		this->stateTimeStep()->connect(iterSolver->inTimeStep());
 		this->varFrictionEnabled()->connect(iterSolver->varFrictionEnabled());
@@ -52,6 +63,7 @@ namespace dyno
 		this->varGravityValue()->connect(iterSolver->varGravityValue());
 		this->varFrictionCoefficient()->connect(iterSolver->varFrictionCoefficient());
 		this->varSlop()->connect(iterSolver->varSlop());
+		this->varWarmStartEnabled()->connect(iterSolver->varWarmStartEnabled());
 		this->stateMass()->connect(iterSolver->inMass());
 		
 		this->stateCenter()->connect(iterSolver->inCenter());
@@ -62,9 +74,19 @@ namespace dyno
 		this->stateQuaternion()->connect(iterSolver->inQuaternion());
 		this->stateInitialInertia()->connect(iterSolver->inInitialInertia());
 		this->stateTopology()->connect(iterSolver->inDiscreteElements());
-		merge->outContacts()->connect(iterSolver->inContacts());
+		islands->outAwakeContacts()->connect(iterSolver->inContacts());
 		this->animationPipeline()->pushModule(iterSolver);
 
+		auto freezer = std::make_shared<SleepingBodyFreezer<TDataType>>();
+		islands->outSleeping()->connect(freezer->inSleeping());
+		this->stateCenter()->connect(freezer->inCenter());
+		this->stateVelocity()->connect(freezer->inVelocity());
+		this->stateAngularVelocity()->connect(freezer->inAngularVelocity());
+		this->stateRotationMatrix()->connect(freezer->inRotationMatrix());
+		this->stateInertia()->connect(freezer->inInertia());
+		this->stateQuaternion()->connect(freezer->inQuaternion());
+		this->animationPipeline()->pushModule(freezer);
+
 
 		this->setDt(0.016f);
 	}
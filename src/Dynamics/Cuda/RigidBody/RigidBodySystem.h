@@ -43,11 +43,11 @@ namespace dyno
 
 		typedef typename dyno::TContactPair<Real> ContactPair;
 		
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 
 
 		RigidBodySystem();
@@ -155,6 +155,8 @@ namespace dyno
 
 		DEF_VAR(Real, Slop, 0.0001, "");
 
+		DEF_VAR(bool, WarmStartEnabled, true, "Start the contact solver with the impulses of the last step");
+
 		DEF_INSTANCE_STATE(DiscreteElements<TDataType>, Topology, "Topology");
 
 		/**
@@ -10,6 +10,8 @@
 #include "Module/PJSConstraintSolver.h"
 #include "Module/PCGConstraintSolver.h"
 #include "Module/CarDriver.h"
+#include "Module/RigidBodyIslands.h"
+#include "Module/SleepingBodyFreezer.h"
 
 #include "Collision/NeighborElementQuery.h"
 #include "Collision/CollistionDetectionBoundingBox.h"
@@ -61,6 +63,15 @@ namespace dyno
 		cdBV->outContacts()->connect(merge->inContactsB());
 		this->animationPipeline()->pushModule(merge);
 
+		auto islands = std::make_shared<RigidBodyIslands<TDataType>>();
+		this->stateTimeStep()->connect(islands->inTimeStep());
+		this->stateFrameNumber()->connect(islands->inFrameNumber());
+		this->stateVelocity()->connect(islands->inVelocity());
+		this->stateAngularVelocity()->connect(islands->inAngularVelocity());
+		this->stateTopology()->connect(islands->inDiscreteElements());
+		merge->outContacts()->connect(islands->inContacts());
+		this->animationPipeline()->pushModule(islands);
+
 		auto iterSolver = std::make_shared<TJConstraintSolver<TDataType>>();
 		this->stateTimeStep()->connect(iterSolver->inTimeStep());
 		this->varFrictionEnabled()->connect(iterSolver->varFrictionEnabled());
@@ -69,6 +80,7 @@ namespace dyno
 		//this->varFrictionCoefficient()->connect(iterSolver->varFrictionCoefficient());
 		this->varFrictionCoefficient()->setValue(20.0f);
 		this->varSlop()->connect(iterSolver->varSlop());
+		this->varWarmStartEnabled()->connect(iterSolver->varWarmStartEnabled());
 		this->stateMass()->connect(iterSolver->inMass());
 		this->stateCenter()->connect(iterSolver->inCenter());
 		this->stateVelocity()->connect(iterSolver->inVelocity());
@@ -80,10 +92,20 @@ namespace dyno
 
 		this->stateTopology()->connect(iterSolver->inDiscreteElements());
 
-		merge->outContacts()->connect(iterSolver->inContacts());
+		islands->outAwakeContacts()->connect(iterSolver->inContacts());
 
 		this->animationPipeline()->pushModule(iterSolver);
 
+		auto freezer = std::make_shared<SleepingBodyFreezer<TDataType>>();
+		islands->outSleeping()->connect(freezer->inSleeping());
+		this->stateCenter()->connect(freezer->inCenter());
+		this->stateVelocity()->connect(freezer->inVelocity());
+		this->stateAngularVelocity()->connect(freezer->inAngularVelocity());
+		this->stateRotationMatrix()->connect(freezer->inRotationMatrix());
+		this->stateInertia()->connect(freezer->inInertia());
+		this->stateQuaternion()->connect(freezer->inQuaternion());
+		this->animationPipeline()->pushModule(freezer);
+
 		/*auto driver = std::make_shared<SimpleVechicleDriver>();
 
 		this->stateFrameNumber()->connect(driver->inFrameNumber());
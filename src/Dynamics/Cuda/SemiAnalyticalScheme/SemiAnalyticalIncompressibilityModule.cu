@@ -5,7 +5,6 @@
  *               introduced in the paper <Semi-analytical Solid Boundary Conditions for Free Surface Flows>
  * @version    : 1.1
  */
-#include <cuda_runtime.h>
 #include "SemiAnalyticalIncompressibilityModule.h"
 
 #include "ParticleSystem/Module/SummationDensity.h"
@@ -1382,14 +1381,11 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
 
     std::cout << "Element Count: " << m_particle_position.size() << std::endl;
 
-    uint pDims = cudaGridSize(m_particle_position.size(), BLOCK_SIZE);
-
     //compute alpha_i = sigma w_j and A_i = sigma w_ij / r_ij / r_ij
 
     printf("inside VC constraint NEW %d %d %d %d\n", m_particle_velocity.getData().size(), m_particle_mass.size(), m_particle_attribute.size(), m_particle_position.size());
 
     int  numTri = m_triangle_vertex.size();
-    uint pDimsT = cudaGridSize(numTri, BLOCK_SIZE);
 
     if (!m_particle_position.isEmpty())
     {
@@ -1437,7 +1433,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     m_alpha.reset();
     //printf("sampling_distance = %.10lf; smoothing_length = %.10lf\n", m_sampling_distance.getValue(), m_smoothing_length.getValue());
 
-    VC_TriVelTmp<<<pDimsT, BLOCK_SIZE>>>(
+    cuExecute(numTri,
+    	VC_TriVelTmp,
         m_triangle_vertex_old.getData(),
         m_triangle_vertex.getData(),
         m_meshVel,
@@ -1449,7 +1446,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
 //         m_triangle_vertex.getData(),
 //         m_neighborhood_triangles.getData());
 
-    VC_ComputeAlphaTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeAlphaTmp,
         m_alpha,
         Rho_alpha,
         m_particle_mass.getData(),
@@ -1467,7 +1465,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     //Real m_maxAlpha2 = m_reduce->maximum(m_alpha.getDataPtr(), m_alpha.size());
     //m_maxAlpha = max(m_maxAlpha2, m_maxAlpha);
 
-    VC_CorrectAlphaTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_CorrectAlphaTmp,
         m_alpha,
         Rho_alpha,
         m_particle_mass.getData(),
@@ -1476,7 +1475,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     //compute the diagonal elements of the coefficient matrix
     m_AiiFluid.reset();
     m_AiiTotal.reset();
-    VC_ComputeDiagonalElementTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeDiagonalElementTmp,
         m_AiiFluid,
         m_AiiTotal,
         m_alpha,
@@ -1492,7 +1492,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
 
     m_bSurface.reset();
     m_Aii.reset();
-    VC_DetectSurfaceTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_DetectSurfaceTmp,
         m_Aii,
         m_bSurface,
         m_AiiFluid,
@@ -1511,7 +1512,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     //m_density = m_densitySum->outDensity()->getValue();
 
     m_divergence.reset();
-    VC_ComputeDivergenceTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeDivergenceTmp,
         m_divergence,
         m_alpha,
         m_densitySum->outDensity()->getData(),
@@ -1534,7 +1536,9 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
         dt,
         m_flip.getData());
 
-    VC_CompensateSourceTmp<<<pDims, BLOCK_SIZE>>>(  // no need
+    cuExecute(num,
+    	VC_CompensateSourceTmp,
+    	// no need
         m_divergence,
         m_densitySum->outDensity()->getData(),
         m_particle_attribute.getData(),
@@ -1545,7 +1549,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     //solve the linear system of equations with a conjugate gradient method.
     m_y.reset();
     m_pressure.reset();
-    VC_ComputeAxTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeAxTmp,
         m_y,
         m_pressure,
         m_Aii,
@@ -1567,7 +1572,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     {
         m_y.reset();
         //VC_ComputeAx << <pDims, BLOCK_SIZE >> > (*yArr, *pArr, *aiiArr, *alphaArr, *posArr, *attArr, *neighborArr);
-        VC_ComputeAxTmp<<<pDims, BLOCK_SIZE>>>(
+        cuExecute(num,
+        	VC_ComputeAxTmp,
             m_y,
             m_p,
             m_Aii,
@@ -1594,7 +1600,8 @@ void SemiAnalyticalIncompressibilityModule<TDataType>::constrain()
     }
     //return true;
     //update the each particle's velocity
-    VC_UpdateVelocityBoundaryCorrectedTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_UpdateVelocityBoundaryCorrectedTmp,
         m_pressure,
         m_alpha,
         m_bSurface,
@@ -1641,7 +1648,6 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
     {
         printf("warning from second step!");
         int  num   = m_particle_position.size();
-        uint pDims = cudaGridSize(num, BLOCK_SIZE);
 
         m_particle_attribute.resize(num);
         m_particle_mass.resize(num);
@@ -1649,7 +1655,8 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
         //			m_particle_normal.resize(num);
         //if (m_particle_attribute.isEmpty())printf("???\n");
         m_particle_attribute.getDataPtr()->reset();
-        VC_InitAttrTmp<<<pDims, BLOCK_SIZE>>>(
+        cuExecute(num,
+        	VC_InitAttrTmp,
             m_particle_attribute.getData(),
             m_particle_mass.getData());
     }
@@ -1663,9 +1670,9 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
     int  numt = m_triangle_vertex.size();
 
     m_meshVel.resize(numt);
-    uint pDims = cudaGridSize(numt, BLOCK_SIZE);
 
-    VC_TriVelTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(numt,
+    	VC_TriVelTmp,
         m_triangle_vertex_old.getData(),
         m_triangle_vertex.getData(),
         m_meshVel,
@@ -1718,16 +1725,17 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
     m_reduce     = Reduction<float>::Create(num);
     m_arithmetic = Arithmetic<float>::Create(num);
 
-    pDims = cudaGridSize(num, BLOCK_SIZE);
     /*
-		VC_Sort_Neighbors << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			VC_Sort_Neighbors,
 			m_particle_position.getValue(),
 			m_triangle_index.getValue(),
 			m_triangle_vertex.getValue(),
 			m_neighborhood_triangles.getValue()
 			);
 
-		VC_Calc_SolidAngle << <pDims, BLOCK_SIZE >> > (
+		cuExecute(num,
+			VC_Calc_SolidAngle,
 			m_particle_position.getValue(),
 			m_triangle_index.getValue(),
 			m_triangle_vertex.getValue(),
@@ -1740,7 +1748,8 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
     //		printf("NEI1:%d\n", m_neighborhood.isEmpty());
     m_alpha.reset();
     printf("FLIP: %d\n", m_flip.getData().size());
-    VC_ComputeAlphaTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeAlphaTmp,
         m_alpha,
         Rho_alpha,
         m_particle_mass.getData(),
@@ -1756,14 +1765,16 @@ bool SemiAnalyticalIncompressibilityModule<TDataType>::initializeImpl()
 
     m_maxAlpha = m_reduce->maximum(m_alpha.begin(), m_alpha.size());
 
-    VC_CorrectAlphaTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_CorrectAlphaTmp,
         m_alpha,
         Rho_alpha,
         m_particle_mass.getData(),
         m_maxAlpha);
 
     m_AiiFluid.reset();
-    VC_ComputeDiagonalElementTmp<<<pDims, BLOCK_SIZE>>>(
+    cuExecute(num,
+    	VC_ComputeDiagonalElementTmp,
         m_AiiFluid,
         m_alpha,
         m_particle_position.getData(),
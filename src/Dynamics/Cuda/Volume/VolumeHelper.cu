@@ -621,15 +621,12 @@ namespace dyno
 		}
 	}
 
-	template <typename Real, typename Coord>
-	__global__ void SO_FIMUpLevelGrids(
+	template <typename Coord>
+	__global__ void SO_FIMUpLevelNeighbors(
 		DArray<VoxelOctreeNode<Coord>> nodes,
-		DArray<Real> nodes_value,
 		DArray<IndexNode> x_index,
 		DArray<IndexNode> y_index,
 		DArray<IndexNode> z_index,
-		DArray<Coord> nodes_object,
-		DArray<Coord> nodes_normal,
 		int nx_,
 		int ny_,
 		int nz_)
@@ -654,8 +651,18 @@ namespace dyno
 			nodes[z_index[tId].node_index].m_neighbor[4] = z_index[tId - 1].node_index;
 		if ((znz != (nz_ - 1) && tId < (nodes.size() - 1)) && (z_index[tId + 1].xyz_index == (z_index[tId].xyz_index + 1)))
 			nodes[z_index[tId].node_index].m_neighbor[5] = z_index[tId + 1].node_index;
+	}
 
-		__syncthreads();
+	//Neighbors are set up by SO_FIMUpLevelNeighbors in a separate launch, a block-level barrier does not cover neighbors in other blocks
+	template <typename Real, typename Coord>
+	__global__ void SO_FIMUpLevelGrids(
+		DArray<VoxelOctreeNode<Coord>> nodes,
+		DArray<Real> nodes_value,
+		DArray<Coord> nodes_object,
+		DArray<Coord> nodes_normal)
+	{
+		int tId = threadIdx.x + (blockIdx.x * blockDim.x);
+		if (tId >= nodes.size()) return;
 
 		for (int i = 0; i < 6; i++)
 		{
@@ -1382,20 +1389,24 @@ namespace dyno
 		thrust::sort(thrust::device, zIndex.begin(), zIndex.begin() + zIndex.size(), IndexCmp());
 
 		//FIM
+		cuExecute(grid1_num,
+			SO_FIMUpLevelNeighbors,
+			grid1,
+			xIndex,
+			yIndex,
+			zIndex,
+			up_nx,
+			up_ny,
+			up_nz);
+
 		for (int i = 0; i < 3; i++)
 		{
 			cuExecute(grid1_num,
 				SO_FIMUpLevelGrids,
 				grid1,
 				grid1_value,
-				xIndex,
-				yIndex,
-				zIndex,
 				grid1_object,
-				grid1_normal,
-				up_nx,
-				up_ny,
-				up_nz);
+				grid1_normal);
 		}
 
 		xIndex.clear();
@@ -34,9 +34,7 @@ namespace dyno
 		if (this->varFileName()->isModified())
 		{
 			auto levelset = this->stateLevelSet()->getDataPtr();
-			levelset->getSDF().loadSDF(this->varFileName()->getValue().string(), false);
-
-			return true;
+			return levelset->getSDF().loadSDF(this->varFileName()->getValue().string(), false);
 		}
 
 		return false;
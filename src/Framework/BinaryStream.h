@@ -0,0 +1,680 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Platform.h"
+
+#include "Array/Array.h"
+#include "Array/Array2D.h"
+#include "Array/Array3D.h"
+#include "Array/ArrayList.h"
+
+#include "Log.h"
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+namespace dyno
+{
+	/**
+	 * @brief Helpers to stream raw binary data, used by checkpoints.
+	 *	Device arrays are moved through a host staging buffer of at most BinaryChunkSize bytes,
+	 *	so that streaming large arrays does not require a full host copy.
+	 */
+	const uint64 BinaryChunkSize = 16 * 1024 * 1024;
+
+	template<typename T>
+	inline bool writeBinaryValue(std::ostream& out, const T& val)
+	{
+		out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+		return out.good();
+	}
+
+	template<typename T>
+	inline bool readBinaryValue(std::istream& in, T& val)
+	{
+		in.read(reinterpret_cast<char*>(&val), sizeof(T));
+		return in.good();
+	}
+
+	/**
+	 * @brief Return false and fail the stream if fewer than num bytes are left, so that a corrupted size is rejected before anything is allocated.
+	 *	Streams that cannot seek are not checked.
+	 */
+	inline bool hasBinaryBytes(std::istream& in, uint64 num)
+	{
+		std::streampos cur = in.tellg();
+		if (cur == std::streampos(-1))
+			return true;
+
+		in.seekg(0, std::ios::end);
+		std::streampos end = in.tellg();
+		in.seekg(cur);
+
+		if (end == std::streampos(-1) || uint64(end - cur) >= num)
+			return true;
+
+		in.setstate(std::ios::failbit);
+		return false;
+	}
+
+	inline bool writeBinaryString(std::ostream& out, const std::string& str)
+	{
+		writeBinaryValue(out, (uint)str.size());
+		out.write(str.data(), str.size());
+		return out.good();
+	}
+
+	inline bool readBinaryString(std::istream& in, std::string& str)
+	{
+		uint num = 0;
+		if (!readBinaryValue(in, num) || !hasBinaryBytes(in, num))
+			return false;
+
+		str.resize(num);
+		if (num > 0)
+			in.read(&str[0], num);
+
+		return in.good();
+	}
+
+	template<typename T>
+	inline bool writeBinaryBuffer(std::ostream& out, const T* data, uint64 num)
+	{
+		if (num > 0)
+			out.write(reinterpret_cast<const char*>(data), num * sizeof(T));
+
+		return out.good();
+	}
+
+	template<typename T>
+	inline bool readBinaryBuffer(std::istream& in, T* data, uint64 num)
+	{
+		if (num > 0)
+			in.read(reinterpret_cast<char*>(data), num * sizeof(T));
+
+		return in.good();
+	}
+
+	template<typename T>
+	inline uint binaryChunkNum()
+	{
+		return (uint)std::max<uint64>(BinaryChunkSize / sizeof(T), 1);
+	}
+
+	/**
+	 * @brief Whether array elements of type T can be stored as raw bytes.
+	 *	Vectors, matrices and primitives declare their own copy constructors and are not trivially copyable,
+	 *	yet they are copied bytewise between host and device like any other array element.
+	 *	Polymorphic types, pointers and types owning host memory are rejected.
+	 */
+	template<typename T>
+	struct IsBinaryCopyable
+	{
+		static const bool value = !std::is_polymorphic<T>::value && !std::is_pointer<T>::value;
+	};
+
+	template<typename T>
+	struct IsBinaryCopyable<std::shared_ptr<T>> { static const bool value = false; };
+
+	template<typename T>
+	struct IsBinaryCopyable<std::vector<T>> { static const bool value = false; };
+
+	template<>
+	struct IsBinaryCopyable<std::string> { static const bool value = false; };
+
+	/**
+	 * Arrays are stored as the element count followed by the raw elements, see IsBinaryCopyable for the supported element types
+	 */
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const CArray<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		writeBinaryValue(out, arr.size());
+		return writeBinaryBuffer(out, arr.begin(), arr.size());
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, CArray<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = 0;
+		if (!readBinaryValue(in, num) || !hasBinaryBytes(in, uint64(num) * sizeof(T)))
+			return false;
+
+		arr.resize(num);
+		return readBinaryBuffer(in, arr.begin(), num);
+	}
+
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const DArray<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = arr.size();
+		writeBinaryValue(out, num);
+
+		CArray<T> staging(std::min(num, binaryChunkNum<T>()));
+		for (uint offset = 0; offset < num; offset += staging.size())
+		{
+			uint count = std::min(staging.size(), num - offset);
+
+			staging.assign(arr, count, 0, offset);
+			if (!writeBinaryBuffer(out, staging.begin(), count))
+				return false;
+		}
+
+		return out.good();
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, DArray<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = 0;
+		if (!readBinaryValue(in, num) || !hasBinaryBytes(in, uint64(num) * sizeof(T)))
+			return false;
+
+		arr.resize(num);
+
+		CArray<T> staging(std::min(num, binaryChunkNum<T>()));
+		for (uint offset = 0; offset < num; offset += staging.size())
+		{
+			uint count = std::min(staging.size(), num - offset);
+
+			if (!readBinaryBuffer(in, staging.begin(), count))
+				return false;
+
+			arr.assign(staging, count, offset, 0);
+		}
+
+		return true;
+	}
+
+	/**
+	 * CArray<bool> is backed by std::vector<bool>, which does not store its elements contiguously, each boolean is stored as one byte
+	 */
+	inline bool writeBinaryArray(std::ostream& out, const CArray<bool>& arr)
+	{
+		const std::vector<bool>& data = *arr.handle();
+
+		uint num = arr.size();
+		writeBinaryValue(out, num);
+
+		std::vector<unsigned char> staging(std::min(num, binaryChunkNum<unsigned char>()));
+		for (uint offset = 0; offset < num; offset += (uint)staging.size())
+		{
+			uint count = std::min((uint)staging.size(), num - offset);
+			for (uint i = 0; i < count; i++)
+				staging[i] = data[offset + i] ? 1 : 0;
+
+			if (!writeBinaryBuffer(out, staging.data(), count))
+				return false;
+		}
+
+		return out.good();
+	}
+
+	inline bool readBinaryArray(std::istream& in, CArray<bool>& arr)
+	{
+		uint num = 0;
+		if (!readBinaryValue(in, num) || !hasBinaryBytes(in, num))
+			return false;
+
+		arr.resize(num);
+		std::vector<bool>& data = *arr.handle();
+
+		std::vector<unsigned char> staging(std::min(num, binaryChunkNum<unsigned char>()));
+		for (uint offset = 0; offset < num; offset += (uint)staging.size())
+		{
+			uint count = std::min((uint)staging.size(), num - offset);
+			if (!readBinaryBuffer(in, staging.data(), count))
+				return false;
+
+			for (uint i = 0; i < count; i++)
+				data[offset + i] = staging[i] != 0;
+		}
+
+		return true;
+	}
+
+	/**
+	 * DArray<bool> cannot be staged through CArray<bool>, the transfer is refused instead of being skipped silently
+	 */
+	inline bool writeBinaryArray(std::ostream& out, const DArray<bool>& arr)
+	{
+		Log::sendMessage(Log::Error, "Boolean device arrays cannot be written to a binary stream, use uint instead");
+		return false;
+	}
+
+	inline bool readBinaryArray(std::istream& in, DArray<bool>& arr)
+	{
+		Log::sendMessage(Log::Error, "Boolean device arrays cannot be read from a binary stream, use uint instead");
+		return false;
+	}
+
+	/**
+	 * 2D and 3D arrays are stored as their dimensions followed by the raw elements.
+	 *	Device memory is pitched, so device arrays are staged on the host a few rows at a time, row j of slice k being row j + k * ny.
+	 */
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const CArray2D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		writeBinaryValue(out, arr.nx());
+		writeBinaryValue(out, arr.ny());
+		return writeBinaryBuffer(out, arr.begin(), arr.size());
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, CArray2D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = 0, ny = 0;
+		if (!readBinaryValue(in, nx) || !readBinaryValue(in, ny) || !hasBinaryBytes(in, uint64(nx) * ny * sizeof(T)))
+			return false;
+
+		arr.resize(nx, ny);
+		return readBinaryBuffer(in, arr.handle()->data(), arr.size());
+	}
+
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const CArray3D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		writeBinaryValue(out, arr.nx());
+		writeBinaryValue(out, arr.ny());
+		writeBinaryValue(out, arr.nz());
+		return writeBinaryBuffer(out, arr.begin(), arr.size());
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, CArray3D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = 0, ny = 0, nz = 0;
+		if (!readBinaryValue(in, nx) || !readBinaryValue(in, ny) || !readBinaryValue(in, nz) || !hasBinaryBytes(in, uint64(nx) * ny * nz * sizeof(T)))
+			return false;
+
+		arr.resize(nx, ny, nz);
+		return readBinaryBuffer(in, arr.handle()->data(), arr.size());
+	}
+
+	template<typename DeviceArray, typename HostArray>
+	bool writeBinaryRows(std::ostream& out, const DeviceArray& arr, HostArray& staging, uint nx, uint rowNum)
+	{
+		uint chunk = staging.ny();
+		for (uint row = 0; row < rowNum; row += chunk)
+		{
+			uint count = std::min(chunk, rowNum - row);
+
+			staging.assign(arr, count, 0, row);
+			if (!writeBinaryBuffer(out, staging.begin(), uint64(count) * nx))
+				return false;
+		}
+
+		return out.good();
+	}
+
+	template<typename DeviceArray, typename HostArray>
+	bool readBinaryRows(std::istream& in, DeviceArray& arr, HostArray& staging, uint nx, uint rowNum)
+	{
+		uint chunk = staging.ny();
+		for (uint row = 0; row < rowNum; row += chunk)
+		{
+			uint count = std::min(chunk, rowNum - row);
+
+			if (!readBinaryBuffer(in, staging.handle()->data(), uint64(count) * nx))
+				return false;
+
+			arr.assign(staging, count, row, 0);
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	inline uint binaryChunkRows(uint nx, uint rowNum)
+	{
+		return std::min(rowNum, std::max(binaryChunkNum<T>() / std::max(nx, 1u), 1u));
+	}
+
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const DArray2D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = arr.nx(), ny = arr.ny();
+		writeBinaryValue(out, nx);
+		writeBinaryValue(out, ny);
+
+		if (nx == 0 || ny == 0)
+			return out.good();
+
+		CArray2D<T> staging(nx, binaryChunkRows<T>(nx, ny));
+		return writeBinaryRows(out, arr, staging, nx, ny);
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, DArray2D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = 0, ny = 0;
+		if (!readBinaryValue(in, nx) || !readBinaryValue(in, ny) || !hasBinaryBytes(in, uint64(nx) * ny * sizeof(T)))
+			return false;
+
+		arr.resize(nx, ny);
+		if (nx == 0 || ny == 0)
+			return true;
+
+		CArray2D<T> staging(nx, binaryChunkRows<T>(nx, ny));
+		return readBinaryRows(in, arr, staging, nx, ny);
+	}
+
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const DArray3D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = arr.nx(), ny = arr.ny(), nz = arr.nz();
+		writeBinaryValue(out, nx);
+		writeBinaryValue(out, ny);
+		writeBinaryValue(out, nz);
+
+		if (nx == 0 || ny == 0 || nz == 0)
+			return out.good();
+
+		CArray3D<T> staging(nx, binaryChunkRows<T>(nx, ny * nz), 1);
+		return writeBinaryRows(out, arr, staging, nx, ny * nz);
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, DArray3D<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint nx = 0, ny = 0, nz = 0;
+		if (!readBinaryValue(in, nx) || !readBinaryValue(in, ny) || !readBinaryValue(in, nz) || !hasBinaryBytes(in, uint64(nx) * ny * nz * sizeof(T)))
+			return false;
+
+		arr.resize(nx, ny, nz);
+		if (nx == 0 || ny == 0 || nz == 0)
+			return true;
+
+		CArray3D<T> staging(nx, binaryChunkRows<T>(nx, ny * nz), 1);
+		return readBinaryRows(in, arr, staging, nx, ny * nz);
+	}
+
+	/**
+	 * Array lists are stored as the list count, the size of each list and the elements of all lists in order.
+	 *	Device array lists are staged on the host in chunks, both for the list sizes and the elements.
+	 */
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, CArrayList<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = arr.size();
+		writeBinaryValue(out, num);
+
+		// Lists rebuilt in the CSR layout are always full
+		if (!arr.hasLists())
+		{
+			auto csr = arr.csr();
+			for (uint i = 0; i < num; i++)
+				writeBinaryValue(out, csr.size(i));
+
+			return writeBinaryBuffer(out, csr.begin(0), csr.elementSize());
+		}
+
+		for (uint i = 0; i < num; i++)
+			writeBinaryValue(out, arr[i].size());
+
+		for (uint i = 0; i < num; i++)
+		{
+			auto& list = arr[i];
+			if (!writeBinaryBuffer(out, list.begin(), list.size()))
+				return false;
+		}
+
+		return out.good();
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, CArrayList<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = 0;
+		if (!readBinaryValue(in, num))
+			return false;
+
+		if (num == 0)
+		{
+			arr.clear();
+			return true;
+		}
+
+		if (!hasBinaryBytes(in, uint64(num) * sizeof(uint)))
+			return false;
+
+		CArray<uint> counts(num);
+		if (!readBinaryBuffer(in, counts.begin(), num))
+			return false;
+
+		// Lists keep their sizes across resize(), start from empty ones
+		arr.clear();
+		arr.resize(counts);
+
+		// Lists are laid out in order, all elements are read in one block
+		auto csr = arr.csr();
+		if (!hasBinaryBytes(in, uint64(csr.elementSize()) * sizeof(T)))
+			return false;
+
+		if (!readBinaryBuffer(in, csr.begin(0), csr.elementSize()))
+			return false;
+
+		for (uint i = 0; i < num; i++)
+			arr[i].assign(csr.begin(i), counts[i], counts[i]);
+
+		return true;
+	}
+
+	/**
+	 * @brief Download the offsets and sizes of count lists starting from first.
+	 *	Lists rebuilt in the CSR layout are full, their sizes follow from the offsets, otherwise the list headers are downloaded as well.
+	 */
+	template<typename T>
+	void loadBinaryListSizes(const DArrayList<T>& arr, uint first, uint count, CArray<uint>& offsets, CArray<uint>& sizes, CArray<List<T>>& lists)
+	{
+		uint num = arr.size();
+		if (arr.hasLists())
+		{
+			offsets.assign(arr.index(), count, 0, first);
+			lists.assign(arr.lists(), count, 0, first);
+
+			for (uint i = 0; i < count; i++)
+				sizes[i] = lists[i].size();
+
+			return;
+		}
+
+		uint next = first + count < num ? 1 : 0;
+		offsets.assign(arr.index(), count + next, 0, first);
+
+		for (uint i = 0; i < count; i++)
+		{
+			uint end = i + 1 < count + next ? offsets[i + 1] : arr.elementSize();
+			sizes[i] = end - offsets[i];
+		}
+	}
+
+	template<typename T>
+	bool writeBinaryArray(std::ostream& out, const DArrayList<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = arr.size();
+		writeBinaryValue(out, num);
+
+		if (num == 0)
+			return out.good();
+
+		uint batch = std::min(num, binaryChunkNum<List<T>>());
+		CArray<uint> offsets(batch + 1);
+		CArray<uint> sizes(batch);
+		CArray<List<T>> lists(arr.hasLists() ? batch : 0);
+
+		for (uint first = 0; first < num; first += batch)
+		{
+			uint count = std::min(batch, num - first);
+
+			loadBinaryListSizes(arr, first, count, offsets, sizes, lists);
+			if (!writeBinaryBuffer(out, sizes.begin(), count))
+				return false;
+		}
+
+		// Elements are downloaded through a window over the element buffer, lists larger than the window are streamed on their own
+		CArray<T> window(std::min(arr.elementSize(), binaryChunkNum<T>()));
+		uint winBegin = 0, winEnd = 0;
+
+		for (uint first = 0; first < num; first += batch)
+		{
+			uint count = std::min(batch, num - first);
+
+			loadBinaryListSizes(arr, first, count, offsets, sizes, lists);
+			for (uint i = 0; i < count; i++)
+			{
+				uint start = offsets[i];
+				uint size = sizes[i];
+
+				if (size == 0)
+					continue;
+
+				if (size > window.size())
+				{
+					for (uint k = 0; k < size; k += window.size())
+					{
+						uint part = std::min(window.size(), size - k);
+
+						window.assign(arr.elements(), part, 0, start + k);
+						if (!writeBinaryBuffer(out, window.begin(), part))
+							return false;
+					}
+
+					winBegin = winEnd = 0;
+					continue;
+				}
+
+				if (start < winBegin || start + size > winEnd)
+				{
+					winBegin = start;
+					winEnd = std::min(start + window.size(), arr.elementSize());
+					window.assign(arr.elements(), winEnd - winBegin, 0, winBegin);
+				}
+
+				if (!writeBinaryBuffer(out, window.begin() + (start - winBegin), size))
+					return false;
+			}
+		}
+
+		return out.good();
+	}
+
+	template<typename T>
+	bool readBinaryArray(std::istream& in, DArrayList<T>& arr)
+	{
+		if (!IsBinaryCopyable<T>::value)
+			return false;
+
+		uint num = 0;
+		if (!readBinaryValue(in, num))
+			return false;
+
+		if (num == 0)
+		{
+			arr.clear();
+			return true;
+		}
+
+		if (!hasBinaryBytes(in, uint64(num) * sizeof(uint)))
+			return false;
+
+		DArray<uint> counts(num);
+		CArray<uint> hCounts(std::min(num, binaryChunkNum<uint>()));
+
+		uint64 total = 0;
+		for (uint offset = 0; offset < num; offset += hCounts.size())
+		{
+			uint count = std::min(hCounts.size(), num - offset);
+			if (!readBinaryBuffer(in, hCounts.begin(), count))
+				return false;
+
+			for (uint i = 0; i < count; i++)
+				total += hCounts[i];
+
+			counts.assign(hCounts, count, offset, 0);
+		}
+
+		if (total > std::numeric_limits<uint>::max() || !hasBinaryBytes(in, total * sizeof(T)))
+			return false;
+
+		// Lists allocated by resize() start empty, they are filled once all elements are uploaded
+		arr.resize(counts);
+		counts.clear();
+
+		CArray<T> staging(std::min((uint)total, binaryChunkNum<T>()));
+		for (uint offset = 0; offset < total; offset += staging.size())
+		{
+			uint count = std::min(staging.size(), (uint)total - offset);
+			if (!readBinaryBuffer(in, staging.begin(), count))
+				return false;
+
+			arr.assignElements(staging, count, offset, 0);
+		}
+
+		arr.fillLists();
+
+		return true;
+	}
+}
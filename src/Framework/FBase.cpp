@@ -3,11 +3,19 @@
 
 #include "Node.h"
 #include "Module.h"
+#include "SceneGraph.h"
 
 #include "FCallbackFunc.h"
 
 namespace dyno
 {
+	//Lock-free maximum, tack() may be called on several sinks of the same top field concurrently
+	static void raiseLatestTackTime(std::atomic<uint64>& latest, uint64 tack)
+	{
+		uint64 cur = latest.load(std::memory_order_relaxed);
+		while (cur < tack && !latest.compare_exchange_weak(cur, tack, std::memory_order_release, std::memory_order_relaxed)) {}
+	}
+
 	std::string FormatConnectionInfo(FBase* fin, FBase* fout, bool connecting, bool succeeded)
 	{
 		OBase* pIn = fin != nullptr ? fin->parent() : nullptr;
@@ -47,6 +55,23 @@ namespace dyno
 	{
 		m_derived = source == nullptr ? false : true;
 		mSource = source;
+
+		this->resolveTopField();
+	}
+
+	void FBase::resolveTopField()
+	{
+		mTopField = mSource == nullptr ? nullptr : mSource->getTopField();
+
+		//Let the new top field know the latest tack() of this field, it would skip the next tick() otherwise
+		if (mTopField != nullptr)
+			raiseLatestTackTime(mTopField->mLatestTackTime, mTackTime.value());
+
+		for (auto sink : mSinks)
+		{
+			if (sink != nullptr)
+				sink->resolveTopField();
+		}
 	}
 
 	FBase* FBase::getSource()
@@ -113,12 +138,12 @@ namespace dyno
 //			f->setDerived(true);
 			f->setSource(this);
 
-			Log::sendMessage(Log::Info, FormatConnectionInfo(this, f, true, true));
+			DYNO_LOG(Log::Info, FormatConnectionInfo(this, f, true, true));
 
 			return;
 		}
 
-		Log::sendMessage(Log::Info, FormatConnectionInfo(this, f, true, false));
+		DYNO_LOG(Log::Info, FormatConnectionInfo(this, f, true, false));
 	}
 
 	bool FBase::removeSink(FBase* f)
@@ -132,12 +157,12 @@ namespace dyno
 //			f->setDerived(false);
 			f->setSource(nullptr);
 
-			Log::sendMessage(Log::Info, FormatConnectionInfo(this, f, false, true));
+			DYNO_LOG(Log::Info, FormatConnectionInfo(this, f, false, true));
 
 			return true;
 		}
 
-		Log::sendMessage(Log::Info, FormatConnectionInfo(this, f, false, false));
+		DYNO_LOG(Log::Info, FormatConnectionInfo(this, f, false, false));
 
 		return false;
 	}
@@ -178,6 +203,13 @@ namespace dyno
 		// fprintf(stderr,"%s ----> %s\n",this->m_name.c_str(), dst->m_name.c_str());
 		this->addSink(dst);
 
+		//Keep the execution queue in order if two nodes are connected
+		Node* srcNode = dynamic_cast<Node*>(this->parent());
+		if (srcNode != nullptr && node != nullptr && srcNode->getSceneGraph() != nullptr)
+		{
+			srcNode->getSceneGraph()->notifyConnection(srcNode, node);
+		}
+
 		this->update();
 
 		return true;
@@ -193,11 +225,6 @@ namespace dyno
 		return this->disconnectField(dst);
 	}
 
-	FBase* FBase::getTopField()
-	{
-		return mSource == nullptr ? this : mSource->getTopField();
-	}
-
 	void FBase::update()
 	{
 		if (!this->isEmpty())
@@ -251,12 +278,21 @@ namespace dyno
 	{
 		FBase* topField = this->getTopField();
 
+		//No sink has been tacked since the last tick, all sinks still see this field as modified.
+		//A tack() racing with the check is ordered before this tick(), as with any unsynchronized read.
+		if (topField->mTickTime.value() > topField->mLatestTackTime.load(std::memory_order_acquire))
+			return;
+
 		topField->mTickTime.mark();
 	}
 
 	void FBase::tack()
 	{
+		FBase* topField = this->getTopField();
+
 		this->mTackTime.mark();
+
+		raiseLatestTackTime(topField->mLatestTackTime, mTackTime.value());
 	}
 
 	bool FBase::isOptional()
@@ -20,7 +20,9 @@
 #include <typeinfo>
 #include <string>
 #include <functional>
+#include <iosfwd>
 #include <cfloat>
+#include <atomic>
 
 namespace dyno {
 	class OBase;
@@ -94,7 +96,18 @@ public:
 	virtual std::string serialize() { return ""; }
 	virtual bool deserialize(const std::string& str) { return false; }
 
-	FBase* getTopField();
+	/**
+	 * @brief Stream the data owned by the field in a binary form, used to checkpoint a scene.
+	 *	Return false if the field does not support binary streaming.
+	 */
+	virtual bool writeBinary(std::ostream& out) { return false; }
+	virtual bool readBinary(std::istream& in) { return false; }
+
+	/**
+	 * @brief Return the field at the root of the connection chain, which owns the data.
+	 *	The result is resolved when fields are connected or disconnected, so the call is cheap.
+	 */
+	inline FBase* getTopField() { return mTopField != nullptr ? mTopField : this; }
 	FBase* getSource();
 
 	/**
@@ -144,6 +157,9 @@ protected:
 	FieldTypeEnum m_fType = FieldTypeEnum::Param;
 
 private:
+	//Refresh the cached top field of this field and all its sinks
+	void resolveTopField();
+
 	std::string m_name;
 	std::string m_description;
 
@@ -159,14 +175,25 @@ private:
 
 	FBase* mSource = nullptr;
 
+	//nullptr if this field is the top field itself
+	FBase* mTopField = nullptr;
+
 	std::vector<FBase*> mSinks;
 
 	TimeStamp mTickTime;
 	TimeStamp mTackTime;
 
+	//Only used by top fields, the latest time stamp marked by tack() on the field or any of its sinks
+	std::atomic<uint64> mLatestTackTime{ 0 };
+
 	std::vector<std::shared_ptr<FCallBackFunc>> mCallbackFunc;
 };
 
+/**
+ * Fields can only be connected to fields of the same type, the top field is therefore cast statically.
+ * getDataPtr()/getData() are meant for writing and mark the field as modified,
+ * use constDataPtr()/constData() for read-only access.
+ */
 #define DEFINE_FIELD_FUNC(DerivedField, Data, FieldName)						\
 FieldName() : FBase("", ""){}								\
 \
@@ -178,16 +205,14 @@ const std::string getClassName() override { return std::string(#FieldName); }
 \
 std::shared_ptr<Data>& getDataPtr()									\
 {																	\
-	FBase* topField = this->getTopField();						\
-	DerivedField* derived = dynamic_cast<DerivedField*>(topField);	\
+	DerivedField* derived = static_cast<DerivedField*>(this->getTopField());	\
 	derived->tick();												\
 	return derived->m_data;											\
 }																	\
 \
 std::shared_ptr<Data>& constDataPtr()								\
 {																	\
-	FBase* topField = this->getTopField();						\
-	DerivedField* derived = dynamic_cast<DerivedField*>(topField);	\
+	DerivedField* derived = static_cast<DerivedField*>(this->getTopField());	\
 	return derived->m_data;											\
 }																	\
 \
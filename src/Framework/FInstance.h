@@ -16,6 +16,7 @@
 #pragma once
 #include <iostream>
 #include "FBase.h"
+#include "Object.h"
 
 namespace dyno {
 
@@ -61,7 +62,7 @@ namespace dyno {
 		const std::string getClassName() final { return InstanceBase::className(); }
 
 		std::shared_ptr<T> getDataPtr() {
-			InstanceBase* ins = dynamic_cast<InstanceBase*>(this->getTopField());
+			InstanceBase* ins = static_cast<InstanceBase*>(this->getTopField());
 			std::shared_ptr<T> data = std::static_pointer_cast<T>(ins->objectPointer());
 
 			this->tick();
@@ -70,7 +71,7 @@ namespace dyno {
 		}
 
 		std::shared_ptr<T> constDataPtr() {
-			InstanceBase* ins = dynamic_cast<InstanceBase*>(this->getTopField());
+			InstanceBase* ins = static_cast<InstanceBase*>(this->getTopField());
 			std::shared_ptr<T> data = std::static_pointer_cast<T>(ins->objectPointer());
 
 			return data;
@@ -78,7 +79,7 @@ namespace dyno {
 
 		void setDataPtr(std::shared_ptr<T> sPtr)
 		{
-			InstanceBase* ins = dynamic_cast<InstanceBase*>(this->getTopField());
+			InstanceBase* ins = static_cast<InstanceBase*>(this->getTopField());
 			ins->setObjectPointer(sPtr);
 
 			this->tick();
@@ -121,6 +122,19 @@ namespace dyno {
 
 		uint size() override { return 1; }
 
+		bool writeBinary(std::ostream& out) override {
+			auto obj = static_cast<InstanceBase*>(this->getTopField())->objectPointer();
+			return obj == nullptr ? false : obj->writeBinary(out);
+		}
+
+		bool readBinary(std::istream& in) override {
+			auto obj = static_cast<InstanceBase*>(this->getTopField())->objectPointer();
+			if (obj == nullptr)
+				obj = this->allocate();
+
+			return obj->readBinary(in);
+		}
+
 	public:
 		std::shared_ptr<Object> objectPointer() final {
 			return std::dynamic_pointer_cast<Object>(mData);
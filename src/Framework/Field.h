@@ -18,6 +18,7 @@
 #include <stdlib.h>
 #include <sstream>
 #include "FBase.h"
+#include "BinaryStream.h"
 
 #include "Array/Array.h"
 #include "Array/Array2D.h"
@@ -55,6 +56,9 @@ namespace dyno {
 		std::string serialize() override { return "Unknown"; }
 		bool deserialize(const std::string& str) override { return false; }
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		bool isEmpty() override {
 			return this->constDataPtr() == nullptr;
 		}
@@ -79,16 +83,14 @@ namespace dyno {
 
 		std::shared_ptr<DataType>& constDataPtr()
 		{
-			FBase* topField = this->getTopField();
-			FieldType* derived = dynamic_cast<FieldType*>(topField);
+			FieldType* derived = static_cast<FieldType*>(this->getTopField());
 			return derived->m_data;
 		}
 
 	private:
 		std::shared_ptr<DataType>& getDataPtr()
 		{
-			FBase* topField = this->getTopField();
-			FieldType* derived = dynamic_cast<FieldType*>(topField);
+			FieldType* derived = static_cast<FieldType*>(this->getTopField());
 			return derived->m_data;
 		}
 
@@ -135,6 +137,42 @@ namespace dyno {
 	}
 
 
+	template<typename T>
+	bool FVar<T>::writeBinary(std::ostream& out)
+	{
+		std::shared_ptr<T>& data = this->constDataPtr();
+		if (data == nullptr)
+			return false;
+
+		// Variables that are not trivially copyable are stored in their text form
+		if (std::is_trivially_copyable<T>::value)
+			return writeBinaryValue(out, *data);
+		else
+			return writeBinaryString(out, this->serialize());
+	}
+
+	template<typename T>
+	bool FVar<T>::readBinary(std::istream& in)
+	{
+		if (std::is_trivially_copyable<T>::value)
+		{
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer;
+			if (!readBinaryBuffer(in, reinterpret_cast<char*>(&buffer), sizeof(T)))
+				return false;
+
+			this->setValue(*reinterpret_cast<T*>(&buffer));
+			return true;
+		}
+		else
+		{
+			std::string str;
+			if (!readBinaryString(in, str))
+				return false;
+
+			return this->deserialize(str);
+		}
+	}
+
 	template<typename T>
 	using HostVarField = FVar<T>;
 
@@ -168,14 +206,25 @@ namespace dyno {
 
 		void assign(const T& val);
 		void assign(const std::vector<T>& vals);
-#ifndef NO_BACKEND
 		void assign(const DArray<T>& vals);
-#endif
 		void assign(const CArray<T>& vals);
 
 		bool isEmpty() override {
 			return this->size() == 0;
 		}
+
+		bool writeBinary(std::ostream& out) override {
+			auto& data = this->constDataPtr();
+			return data == nullptr ? false : writeBinaryArray(out, *data);
+		}
+
+		bool readBinary(std::istream& in) override {
+			auto& data = this->getDataPtr();
+			if (data == nullptr)
+				data = std::make_shared<DataType>();
+
+			return readBinaryArray(in, *data);
+		}
 	};
 
 	template<typename T, DeviceType deviceType>
@@ -242,7 +291,6 @@ namespace dyno {
 		//this->tick();
 	}
 
-#ifndef NO_BACKEND
 	template<typename T, DeviceType deviceType>
 	void FArray<T, deviceType>::assign(const DArray<T>& vals)
 	{
@@ -256,7 +304,6 @@ namespace dyno {
 
 		//this->tick();
 	}
-#endif
 
 	template<typename T, DeviceType deviceType>
 	void FArray<T, deviceType>::reset()
@@ -324,6 +371,19 @@ namespace dyno {
 		bool isEmpty() override {
 			return this->constDataPtr() == nullptr;
 		}
+
+		bool writeBinary(std::ostream& out) override {
+			auto& data = this->constDataPtr();
+			return data == nullptr ? false : writeBinaryArray(out, *data);
+		}
+
+		bool readBinary(std::istream& in) override {
+			auto& data = this->getDataPtr();
+			if (data == nullptr)
+				data = std::make_shared<DataType>();
+
+			return readBinaryArray(in, *data);
+		}
 	};
 
 	template<typename T, DeviceType deviceType>
@@ -435,6 +495,19 @@ namespace dyno {
 		bool isEmpty() override {
 			return this->constDataPtr() == nullptr;
 		}
+
+		bool writeBinary(std::ostream& out) override {
+			auto& data = this->constDataPtr();
+			return data == nullptr ? false : writeBinaryArray(out, *data);
+		}
+
+		bool readBinary(std::istream& in) override {
+			auto& data = this->getDataPtr();
+			if (data == nullptr)
+				data = std::make_shared<DataType>();
+
+			return readBinaryArray(in, *data);
+		}
 	};
 
 	template<typename T, DeviceType deviceType>
@@ -510,7 +583,7 @@ namespace dyno {
 		//this->tick();
 	}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 	/**
 	 * Define field for Array
 	 */
@@ -543,6 +616,19 @@ namespace dyno {
 		bool isEmpty() override {
 			return this->constDataPtr() == nullptr;
 		}
+
+		bool writeBinary(std::ostream& out) override {
+			auto& data = this->constDataPtr();
+			return data == nullptr ? false : writeBinaryArray(out, *data);
+		}
+
+		bool readBinary(std::istream& in) override {
+			auto& data = this->getDataPtr();
+			if (data == nullptr)
+				data = std::make_shared<DataType>();
+
+			return readBinaryArray(in, *data);
+		}
 	};
 
 	template<typename T, DeviceType deviceType>
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <ghc/fs_std.hpp>
 
 namespace dyno 
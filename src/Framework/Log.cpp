@@ -3,37 +3,71 @@
 #include "Log.h"
 #include "FilePath.h"
 
+#include <cstring>
 
 namespace dyno
 {
 	std::string Log::sOutputFile;
 	std::ofstream Log::sOutputStream;
+	std::mutex Log::sOutputMutex;
     void(*Log::receiver)(const Message&) = nullptr;
-    Log::MessageType Log::sLogLevel = Log::DebugInfo;
+    std::atomic<int> Log::sLogLevel = (int)Log::DebugInfo;
 
     std::atomic<Log*> Log::sLogInstance = nullptr;
-    std::queue<Log::Message> Log::sMessageQueue;
 
-#define LOG_DEBUG(format, ...) Log::instance()->writeMessage(Log::DebugInfo, format, ##__VA_ARGS__)
-#define LOG_INFO(format, ...)  Log::instance()->writeMessage(Log::Info, format, ##__VA_ARGS__)
-#define LOG_ERROR(format, ...) Log::instance()->writeMessage(Log::Error, format, ##__VA_ARGS__)
-#define LOG_WARN(format, ...) Log::instance()->writeMessage(Log::Warning, format, ##__VA_ARGS__)
-#define LOG_USER(format, ...) Log::instance()->writeMessage(Log::User, format, ##__VA_ARGS__)
-#define LOG_DISPLAY(format, ...) Log::instance()->writeMessage(Log::Display, format, ##__VA_ARGS__)
+    static_assert((Log::RecordCapacity & (Log::RecordCapacity - 1)) == 0, "The capacity of the ring buffer must be a power of two");
 
-    void Log::writeMessage(MessageType level, const char* format, ...)
+    bool Log::writeMessage(MessageType level, const char* text, size_t length)
     {
-		// log message
-		Log::Message m;
-		m.type = level;
-		m.text = std::string(format);
-		time_t t = time(NULL);
-		m.when = localtime(&t);
-
-        //Finish create Message and push into queue
+        uint64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStartTime).count();
+
+        //Claim a record, see Vyukov's bounded MPMC queue
+        Record* record = nullptr;
+        uint64_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            record = &mRecords[pos & (RecordCapacity - 1)];
+            uint64_t seq = record->sequence.load(std::memory_order_acquire);
+            int64_t diff = (int64_t)seq - (int64_t)pos;
+
+            if (diff == 0)
+            {
+                if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                //The record still holds a message the output thread has not consumed
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                wakeUp();
+                return false;
+            }
+            else
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+
+        //Truncate long messages and mark them with an ellipsis
+        size_t n = length < RecordTextSize ? length : RecordTextSize;
+        memcpy(record->text, text, n);
+        if (length > RecordTextSize)
+            memcpy(record->text + RecordTextSize - 3, "...", 3);
+
+        record->type = level;
+        record->length = (uint32_t)n;
+        record->timestamp = timestamp;
+        record->sequence.store(pos + 1, std::memory_order_release);
+
+        wakeUp();
+
+        return true;
+    }
+
+    void Log::wakeUp()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mSleeping.load(std::memory_order_relaxed) && mSleeping.exchange(false))
         {
             std::lock_guard<std::mutex> lock(mtx);
-            sMessageQueue.push(m);  //push message into queue
             mCondition.notify_one();
         }
     }
@@ -41,17 +75,18 @@ namespace dyno
     void Log::sendMessage(MessageType type, const std::string& text)
     {
 		// Skip logging to file if minimum level is higher
-		if ((int)type < (int)sLogLevel)
+		if (!isEnabled(type))
 			return;
 
-        switch (type)
-        {
-        case DebugInfo: LOG_DEBUG(text.c_str()); break;
-        case Info:		LOG_INFO(text.c_str()); break;
-        case Warning:	LOG_WARN(text.c_str()); break;
-        case Error:		LOG_ERROR(text.c_str()); break;
-        default:		LOG_USER(text.c_str());
-        }
+        instance()->writeMessage(type, text.c_str(), text.size());
+    }
+
+    void Log::sendMessage(MessageType type, const char* text)
+    {
+		if (!isEnabled(type) || text == nullptr)
+			return;
+
+        instance()->writeMessage(type, text, strlen(text));
     }
 
     void Log::setUserReceiver(void (*userFunc)(const Message&))
@@ -61,20 +96,27 @@ namespace dyno
 
 	void Log::setLevel(MessageType level)
 	{
-        sLogLevel = level;
+        sLogLevel.store((int)level, std::memory_order_relaxed);
 	}
 
 	void Log::setOutput(const std::string& filename)
 	{
-		sOutputFile = filename;
+		bool opened = false;
+		{
+			std::lock_guard<std::mutex> lock(sOutputMutex);
 
-		// close old one
-		if (sOutputStream.is_open())
-			sOutputStream.close();
+			sOutputFile = filename;
+
+			// close old one
+			if (sOutputStream.is_open())
+				sOutputStream.close();
 
-		// create file
-		sOutputStream.open(filename.c_str());
-		if (!sOutputStream.is_open())
+			// create file
+			sOutputStream.open(filename.c_str());
+			opened = sOutputStream.is_open();
+		}
+
+		if (!opened)
 			sendMessage(Error, "Cannot create/open '" + filename + "' for logging");
 	}
 
@@ -83,6 +125,23 @@ namespace dyno
         return sOutputFile;
 	}
 
+    void Log::flush()
+    {
+        Log* log = instance();
+
+        uint64_t target = log->mEnqueuePos.load(std::memory_order_acquire);
+        while (log->mDequeuePos.load(std::memory_order_acquire) < target)
+        {
+            log->wakeUp();
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t Log::droppedMessages()
+    {
+        return instance()->mDropped.load(std::memory_order_relaxed);
+    }
+
 	Log* Log::instance()
     {
         static std::mutex mutex;
@@ -102,58 +161,150 @@ namespace dyno
 
     Log::Log()
         : mRunning(true)
+        , mSleeping(false)
+        , mEnqueuePos(0)
+        , mDequeuePos(0)
+        , mDropped(0)
     {
+        mStartTime = std::chrono::steady_clock::now();
+        mStartWallTime = std::chrono::system_clock::now();
+
+        //All records are allocated up front, sending a message never allocates
+        mRecords = new Record[RecordCapacity];
+        for (size_t i = 0; i < RecordCapacity; i++)
+            mRecords[i].sequence.store(i, std::memory_order_relaxed);
+
         mThread = std::thread(&Log::outputThread, this);
     }
 
     Log::~Log()
     {
+        mRunning = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            mCondition.notify_one();
+        }
 
-        mCondition.notify_one();
         if (mThread.joinable()) {
             mThread.join();
         }
 
-        mRunning = false;
+        delete[] mRecords;
+    }
+
+    size_t Log::consumeMessages()
+    {
+        size_t num = 0;
+
+        Message m;
+
+        uint64_t pos = mDequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Record& record = mRecords[pos & (RecordCapacity - 1)];
+            if (record.sequence.load(std::memory_order_acquire) != pos + 1)
+                break;
+
+            m.type = record.type;
+            m.text.assign(record.text, record.length);
+            m.timestamp = record.timestamp;
+
+            //Release the record before formatting, senders can reuse it right away
+            record.sequence.store(pos + RecordCapacity, std::memory_order_release);
+            pos++;
+
+            deliver(m);
+
+            mDequeuePos.store(pos, std::memory_order_release);
+            num++;
+        }
+
+        uint64_t dropped = mDropped.load(std::memory_order_relaxed);
+        if (dropped != mReportedDrops)
+        {
+            m.type = Warning;
+            m.text = std::to_string(dropped - mReportedDrops) + " log messages have been dropped";
+            m.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStartTime).count();
+
+            mReportedDrops = dropped;
+
+            deliver(m);
+        }
+
+        return num;
+    }
+
+    void Log::deliver(Message& m)
+    {
+        //The wall-clock time is derived from the monotonic timestamp, localtime itself is not thread-safe
+        time_t t = std::chrono::system_clock::to_time_t(mStartWallTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(m.timestamp)));
+#ifdef _WIN32
+        localtime_s(&m.when, &t);
+#else
+        localtime_r(&t, &m.when);
+#endif
+
+		if (receiver) {
+			receiver(m);
+		}
+
+		// if enabled logging to file
+		std::lock_guard<std::mutex> lock(sOutputMutex);
+		if (sOutputStream.is_open())
+		{
+			// print time
+			char buffer[9];
+			strftime(buffer, 9, "%X", &m.when);
+			sOutputStream << buffer;
+
+			// print type
+			switch (m.type)
+			{
+			case DebugInfo: sOutputStream << " | Debug   | "; break;
+			case Info:		sOutputStream << " | Info    | "; break;
+			case Warning:	sOutputStream << " | warning | "; break;
+			case Error:		sOutputStream << " | ERROR   | "; break;
+			default:		sOutputStream << " | user    | ";
+			}
+
+			// print description
+			sOutputStream << m.text << '\n';
+		}
     }
 
     void Log::outputThread()
     {
-        while (mRunning) {
-            std::unique_lock<std::mutex> lock(mtx);
-            mCondition.wait(lock, [&]() { return !sMessageQueue.empty() || !mRunning; });
-
-            while (!sMessageQueue.empty()) {
-                auto m = sMessageQueue.front();
-                sMessageQueue.pop();
-
-				if (receiver) {
-					receiver(m);
-				}
-
-				// if enabled logging to file
-				if (sOutputStream.is_open())
-				{
-					// print time
-					char buffer[9];
-					strftime(buffer, 9, "%X", m.when);
-					sOutputStream << buffer;
-
-					// print type
-					switch (m.type)
-					{
-					case DebugInfo: sOutputStream << " | Debug   | "; break;
-					case Info:		sOutputStream << " | Info    | "; break;
-					case Warning:	sOutputStream << " | warning | "; break;
-					case Error:		sOutputStream << " | ERROR   | "; break;
-					default:		sOutputStream << " | user    | ";
-					}
-
-					// print description
-					sOutputStream << m.text << std::endl;
-				}
+        for (;;)
+        {
+            if (consumeMessages() > 0)
+                continue;
+
+            {
+                std::lock_guard<std::mutex> lock(sOutputMutex);
+                if (sOutputStream.is_open())
+                    sOutputStream.flush();
+            }
+
+            if (!mRunning)
+            {
+                consumeMessages();
+                break;
             }
 
+            std::unique_lock<std::mutex> lock(mtx);
+            mSleeping.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            //A message published before mSleeping was set would not wake the thread up, so look once more
+            Record& record = mRecords[mDequeuePos.load(std::memory_order_relaxed) & (RecordCapacity - 1)];
+            bool pending = record.sequence.load(std::memory_order_acquire) == mDequeuePos.load(std::memory_order_relaxed) + 1
+                || mDropped.load(std::memory_order_relaxed) != mReportedDrops;
+
+            if (!pending && mRunning)
+                mCondition.wait_for(lock, std::chrono::milliseconds(100));
+
+            mSleeping.store(false);
         }
     }
-}
\ No newline at end of file
+}
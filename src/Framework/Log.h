@@ -30,13 +30,38 @@
 #include <fstream>
 #include <iostream>
 #include <ctime>
+#include <atomic>
+#include <chrono>
 #include <queue>
 #include <cstdio>
+#include <cstdint>
 #include <cassert>
 #include <cstdarg>
+#include <condition_variable>
+
+//Messages below this level are compiled out of DYNO_LOG, debug messages are only kept in debug builds by default
+#ifndef DYNO_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define DYNO_LOG_MIN_LEVEL 1
+#else
+#define DYNO_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+//Send a message only if its level is enabled, the message expression is not evaluated otherwise
+#define DYNO_LOG(type, message) \
+    do { if (::dyno::Log::isEnabled(type)) ::dyno::Log::sendMessage(type, message); } while (0)
 
 namespace dyno
 {
+    /**
+     * @brief An asynchronous logger.
+     *
+     *	Messages are copied into fixed-size records of a bounded multi-producer single-consumer ring buffer,
+     *	sending a message takes no lock and allocates no memory. Timestamps, levels and text are formatted
+     *	on the output thread. When the ring buffer is full, new messages are dropped and counted instead of
+     *	stalling the sender, text longer than a record is truncated.
+     */
     class Log
     {
     public:
@@ -52,7 +77,8 @@ namespace dyno
         struct Message {
             MessageType type;
             std::string text;
-            tm* when;
+            tm when;				//!< Local time the message was sent at.
+            uint64_t timestamp;		//!< Monotonic time in nanoseconds since the logger was started.
         };
 
         static Log* instance();
@@ -62,10 +88,19 @@ namespace dyno
          *	\brief	Add a new message to log.
          *	\param	type	Type of the new message.
          *	\param	text	Message.
-         *	\remarks Message is directly passes to user receiver if one is set.
+         *	\remarks Message is passed to the user receiver on the output thread.
          */
         static void sendMessage(MessageType type, const std::string& text);
 
+        static void sendMessage(MessageType type, const char* text);
+
+        /*!
+         *	\brief	Whether messages of the given type pass both the compile-time and the runtime level.
+         */
+        static bool isEnabled(MessageType type) {
+            return (int)type >= DYNO_LOG_MIN_LEVEL && (int)type >= sLogLevel.load(std::memory_order_relaxed);
+        }
+
          /*!
 		  *	\brief	Set user function to receive newly sent messages to logger.
 		  */
@@ -86,6 +121,19 @@ namespace dyno
          */
         static const std::string& getOutput();
 
+        /*!
+         *	\brief	Block until all messages sent so far have been passed to the receiver and the file.
+         */
+        static void flush();
+
+        /*!
+         *	\brief	Number of messages dropped since the start because the ring buffer was full.
+         */
+        static uint64_t droppedMessages();
+
+        static constexpr size_t RecordCapacity = 1024;
+        static constexpr size_t RecordTextSize = 488;
+
     private:
 
         Log();
@@ -93,22 +141,52 @@ namespace dyno
 
         void outputThread();
 
-		//Add a new message to log
-		void writeMessage(MessageType level, const char* format, ...);
+        //Add a new message to log, returns false if the ring buffer is full
+        bool writeMessage(MessageType level, const char* text, size_t length);
+
+        //Pass all published records to the receiver and the file, returns the number of records
+        size_t consumeMessages();
+
+        void deliver(Message& m);
+
+        void wakeUp();
 
     private:
-        bool mRunning;
+        struct Record
+        {
+            std::atomic<uint64_t> sequence;
+            MessageType type;
+            uint32_t length;
+            uint64_t timestamp;
+            char text[RecordTextSize];
+        };
+
+        std::atomic<bool> mRunning;
+
+        //Set while the output thread waits on the condition, only then do senders take the lock to notify it
+        std::atomic<bool> mSleeping;
 
 		std::mutex mtx;
 		std::thread mThread;
 		std::condition_variable mCondition;
 
+        Record* mRecords = nullptr;
+
+        alignas(64) std::atomic<uint64_t> mEnqueuePos;
+        alignas(64) std::atomic<uint64_t> mDequeuePos;
+        alignas(64) std::atomic<uint64_t> mDropped;
+
+        uint64_t mReportedDrops = 0;
+
+        std::chrono::steady_clock::time_point mStartTime;
+        std::chrono::system_clock::time_point mStartWallTime;
+
         static std::atomic<Log*> sLogInstance;
 
-        static std::queue<Message> sMessageQueue;
-        static MessageType sLogLevel;
+        static std::atomic<int> sLogLevel;
 		static std::string sOutputFile;
 		static std::ofstream sOutputStream;
+        static std::mutex sOutputMutex;
         static void (*receiver)(const Message&);
     };
 }
@@ -109,7 +109,7 @@ namespace dyno
 			if (!f_in->isOptional() && f_in->isEmpty())
 			{
 				Node* par = this->getParentNode();
-				if (par != nullptr && par->getSceneGraph() != nullptr && par->getSceneGraph()->isValidationInfoPrintable())
+				if (par != nullptr && par->getSceneGraph() != nullptr && par->getSceneGraph()->isValidationInfoPrintable() && Log::isEnabled(Log::Error))
 				{
 					std::string errMsg = std::string("The input field ") + f_in->getObjectName() +
 						std::string(" in Module ") + this->getClassInfo()->getClassName() + std::string(" is not set!");
@@ -132,7 +132,7 @@ namespace dyno
 			if (f_out->isEmpty())
 			{
 				Node* par = this->getParentNode();
-				if (par != nullptr && par->getSceneGraph() != nullptr && par->getSceneGraph()->isValidationInfoPrintable())
+				if (par != nullptr && par->getSceneGraph() != nullptr && par->getSceneGraph()->isValidationInfoPrintable() && Log::isEnabled(Log::Error))
 				{
 					std::string errMsg = std::string("The output field ") + f_out->getObjectName() +
 						std::string(" in Module ") + this->getClassInfo()->getClassName() + std::string(" is not prepared!");
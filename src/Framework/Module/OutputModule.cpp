@@ -16,6 +16,36 @@ namespace dyno
 
 	OutputModule::~OutputModule()
 	{
+		//Pending files are written before the writer thread exits
+		mWriter = nullptr;
+	}
+
+	void OutputModule::flush()
+	{
+		if (mWriter != nullptr)
+			mWriter->flush();
+	}
+
+	void OutputModule::finalize()
+	{
+		this->flush();
+		this->finalizeImpl();
+	}
+
+	void OutputModule::submit(AsyncWriter::Task task)
+	{
+		if (!this->varAsynchronous()->getValue())
+		{
+			this->flush();
+
+			task();
+			return;
+		}
+
+		if (mWriter == nullptr)
+			mWriter.reset(new AsyncWriter(2));
+
+		mWriter->push(std::move(task));
 	}
 
 	void OutputModule::updateImpl()
@@ -2,6 +2,7 @@
 #include "Module.h"
 
 #include "FilePath.h"
+#include "AsyncWriter.h"
 
 namespace dyno
 {
@@ -22,18 +23,47 @@ namespace dyno
 
 		DEF_VAR(bool, Reordering, true, "If set true, the output file name will be re-indexed in sequence starting from zero");
 
+		DEF_VAR(bool, Asynchronous, true, "If set true, files are written on a background thread");
+
 		DEF_VAR_IN(uint, FrameNumber, "Input FrameNumber");
 
 		std::string getModuleType() override { return "OutputModule"; }
 
+		/**
+		 * @brief Block until all submitted files are written
+		 */
+		void flush();
+
+		/**
+		 * @brief Write all pending files and close files spanning several frames, e.g., archives.
+		 *	Called by SceneGraph::reset(), applications exiting without resetting or destroying the scene should call it themselves.
+		 */
+		void finalize();
+
 	protected:
 		void updateImpl() final;
 
 		virtual void output() {};
 
+		/**
+		 * @brief Close files spanning several frames, called by finalize() once all pending files are written
+		 */
+		virtual void finalizeImpl() {};
+
+		/**
+		 * @brief Hand a write task over to the background writer, the task is executed immediately if Asynchronous is off.
+		 *	At most two tasks can be pending, submit() blocks beyond that.
+		 *	Tasks may run after the module is destroyed, so they must not access the module.
+		 *	Snapshot the data into a StagingPool buffer in output() and capture it by value instead.
+		 */
+		void submit(AsyncWriter::Task task);
+
 		/**
 		 * construct the file name with an index appended at the end
 		 */
 		std::string constructFileName();
+
+	private:
+		std::unique_ptr<AsyncWriter> mWriter;
 	};
 }
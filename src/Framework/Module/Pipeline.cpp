@@ -3,10 +3,9 @@
 #include "SceneGraph.h"
 #include "DirectedAcyclicGraph.h"
 
-#include "Timer.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
 
-#include <sstream>
-#include <iomanip>
 #include <queue>
 #include <set>
 
@@ -91,6 +90,16 @@ namespace dyno
 		mUpdateEnabled = false;
 	}
 
+	void Pipeline::setParallelExecution(bool enabled)
+	{
+		mParallelExecution = enabled;
+	}
+
+	bool Pipeline::isParallelExecutionEnabled()
+	{
+		return mParallelExecution;
+	}
+
 	void Pipeline::updateExecutionQueue()
 	{
 		reconstructPipeline();
@@ -115,29 +124,48 @@ namespace dyno
 	{
 		if (mUpdateEnabled)
 		{
-			CTimer timer;
-			for(auto m : mModuleList)
+			PROFILE_ZONE(this->getClassInfo()->m_className.c_str(), Pipeline);
+
+			if (mParallelExecution)
+			{
+				ThreadPool* pool = ThreadPool::instance();
+
+				for (auto& level : mModuleLevels)
+				{
+					if (pool->size() == 0 || level.size() == 1)
+					{
+						for (auto m : level)
+							updateModule(m);
+					}
+					else
+					{
+						pool->parallelFor(0, (uint)level.size(), [&](uint i) {
+							updateModule(level[i]);
+						});
+					}
+				}
+			}
+			else
 			{
-				if (this->printDebugInfo()) {
-					timer.start();
+				for (auto m : mModuleList)
+				{
+					updateModule(m.get());
 				}
+			}
+		}
+	}
 
-				//update the module
-				m->update();
+	void Pipeline::updateModule(Module* m)
+	{
+		bool timing = this->printDebugInfo();
 
-				if (this->printDebugInfo()) {
-					timer.stop();
+		ProfileZone zone(m->getClassInfo()->m_className.c_str(), Profiler::Module, timing);
 
-					std::stringstream name;
-					std::stringstream ss;
-					name << std::setw(40) << m->getClassInfo()->getClassName();
-					ss << std::setprecision(10) << timer.getElapsedTime();
+		//update the module
+		m->update();
 
-					std::string info = "\t Module: " + name.str() + ": \t " + ss.str() + "ms";
-					Log::sendMessage(Log::Info, info);
-				}
-			}
-		}
+		if (timing)
+			DYNO_LOG(Log::Info, "\t Module: " + m->getClassInfo()->getClassName() + ": \t " + std::to_string(zone.elapsedTime()) + "ms");
 	}
 
 	bool Pipeline::requireUpdate()
@@ -273,6 +301,64 @@ namespace dyno
 
 		moduleSet.clear();
 
+		//Group modules into levels, a module is placed after all modules it receives fields from.
+		//Modules may modify array and instance inputs in place, such inputs are ordered against all other modules sharing the top field.
+		//Only variables are passed by value and can be read concurrently.
+		mModuleLevels.clear();
+
+		std::map<ObjectId, uint> levels;
+		std::map<FBase*, uint> writeLevels;
+		std::map<FBase*, uint> readLevels;
+
+		auto mayModify = [](FBase* f) {
+			return f->getFieldType() == FieldTypeEnum::IO || f->getClassName() != "FVar";
+		};
+
+		auto& reverseEdges = graph.reverseEdges();
+		for (auto m : mModuleList)
+		{
+			uint level = 0;
+
+			auto& preds = reverseEdges[m->objectId()];
+			for (auto pId : preds)
+			{
+				auto it = levels.find(pId);
+				if (it != levels.end())
+					level = std::max(level, it->second + 1);
+			}
+
+			auto& inFields = m->getInputFields();
+			for (auto f : inFields)
+			{
+				FBase* top = f->getTopField();
+
+				auto wIt = writeLevels.find(top);
+				if (wIt != writeLevels.end())
+					level = std::max(level, wIt->second + 1);
+
+				auto rIt = readLevels.find(top);
+				if (mayModify(f) && rIt != readLevels.end())
+					level = std::max(level, rIt->second + 1);
+			}
+
+			for (auto f : inFields)
+			{
+				FBase* top = f->getTopField();
+
+				readLevels[top] = std::max(readLevels[top], level);
+
+				if (mayModify(f))
+					writeLevels[top] = std::max(writeLevels[top], level);
+			}
+
+			levels[m->objectId()] = level;
+
+			if (mModuleLevels.size() <= level)
+				mModuleLevels.resize(level + 1);
+
+			mModuleLevels[level].push_back(m.get());
+		}
+
 		mModuleUpdated = false;
 	}
 }
\ No newline at end of file
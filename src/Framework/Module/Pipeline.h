@@ -79,6 +79,14 @@ namespace dyno
 		void enable();
 		void disable();
 
+		/**
+		 * @brief Update modules whose inputs are all satisfied concurrently,
+		 *	otherwise modules are updated one by one following the topological order.
+		 *	Array and instance inputs may be modified in place, modules sharing them keep the topological order.
+		 */
+		void setParallelExecution(bool enabled);
+		bool isParallelExecutionEnabled();
+
 		void updateExecutionQueue();
 
 		void forceUpdate();
@@ -104,6 +112,8 @@ namespace dyno
 	private:
 		void reconstructPipeline();
 
+		void updateModule(Module* m);
+
 	private:
 		bool mModuleUpdated = false;
 		bool mUpdateEnabled = true;
@@ -113,6 +123,13 @@ namespace dyno
 
 		std::list<std::shared_ptr<Module>> mPersistentModule;
 
+		/**
+		 * Modules grouped by dependency levels, modules inside the same level can be updated concurrently
+		 */
+		std::vector<std::vector<Module*>> mModuleLevels;
+
+		bool mParallelExecution = false;
+
 		bool mTiming = false;
 	};
 }
@@ -426,13 +426,13 @@ bool Node::appendExportNode(NodePort* nodePort)
 {
 	auto it = find(mExportNodes.begin(), mExportNodes.end(), nodePort);
 	if (it != mExportNodes.end()) {
-		Log::sendMessage(Log::Info, FormatConnectionInfo(this, nodePort, true, false));
+		DYNO_LOG(Log::Info, FormatConnectionInfo(this, nodePort, true, false));
 		return false;
 	}
 
 	mExportNodes.push_back(nodePort);
 
-	Log::sendMessage(Log::Info, FormatConnectionInfo(this, nodePort, true, true));
+	DYNO_LOG(Log::Info, FormatConnectionInfo(this, nodePort, true, true));
 	return nodePort->addNode(this);
 }
 
@@ -445,13 +445,13 @@ bool Node::removeExportNode(NodePort* nodePort)
 
 	auto it = find(mExportNodes.begin(), mExportNodes.end(), nodePort);
 	if (it == mExportNodes.end()) {
-		Log::sendMessage(Log::Info, FormatConnectionInfo(this, nodePort, false, false));
+		DYNO_LOG(Log::Info, FormatConnectionInfo(this, nodePort, false, false));
 		return false;
 	}
 
 	mExportNodes.erase(it);
 
-	Log::sendMessage(Log::Info, FormatConnectionInfo(this, nodePort, false, true));
+	DYNO_LOG(Log::Info, FormatConnectionInfo(this, nodePort, false, true));
 	return nodePort->removeNode(this);
 }
 
@@ -464,7 +464,13 @@ bool Node::connect(NodePort* nPort)
 {
 	nPort->notify();
 
-	return this->appendExportNode(nPort);
+	bool connected = this->appendExportNode(nPort);
+
+	//The return value is not reliable for ports accepting multiple nodes, always keep the execution queue in order
+	if (mSceneGraph != nullptr)
+		mSceneGraph->notifyConnection(this, nPort->getParent());
+
+	return connected;
 }
 
 bool Node::disconnect(NodePort* nPort)
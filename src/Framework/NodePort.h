@@ -191,7 +191,9 @@ namespace dyno {
 
 		~MultipleNodePort() {
 			//Disconnect nodes from node ports here instead of inside the destructor of Node to avoid memory leak
-			for(auto node : m_nodes)
+			//m_nodes is only refreshed in getNodes(), take a copy since disconnecting modifies m_derived_nodes
+			auto nodes = this->getNodes();
+			for(auto node : nodes)
 			{
 				disconnect(node, this);
 				//node->disconnect(this);
@@ -289,11 +291,14 @@ namespace dyno {
 
 		bool removeNode(Node* node)  override
 		{
-			auto d_node = dynamic_cast<T*>(node);
-
-			if (d_node != nullptr)
+			//Compare node pointers rather than calling dynamic_cast, which fails once the node is under destruction
+			for (auto it = m_derived_nodes.begin(); it != m_derived_nodes.end(); ++it)
 			{
-				return removeDerivedNode(d_node);
+				if (static_cast<Node*>(*it) == node)
+				{
+					m_derived_nodes.erase(it);
+					return true;
+				}
 			}
 
 			return false;
@@ -15,6 +15,7 @@
  */
 #pragma once
 #include <string>
+#include <iosfwd>
 #include <atomic>
 #include <map>
 
@@ -127,6 +128,13 @@ public:
 	static ObjectId baseId();
 
 	ObjectId objectId() { return id; }
+
+	/**
+	 * @brief Stream the persistent state in a binary form, used to checkpoint instance fields.
+	 *	Return false if the object does not support binary streaming.
+	 */
+	virtual bool writeBinary(std::ostream& out) { return false; }
+	virtual bool readBinary(std::istream& in) { return false; }
 private:
 	ObjectId id;
 
@@ -0,0 +1,264 @@
+#include "SceneCheckpoint.h"
+#include "SceneLoaderXML.h"
+#include "BinaryStream.h"
+#include "Log.h"
+
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+namespace dyno
+{
+	static const char CheckpointMagic[8] = { 'D', 'Y', 'N', 'O', 'C', 'K', 'P', 'T' };
+	static const uint CheckpointVersion = 1;
+
+	static bool isCheckpointed(FBase* field)
+	{
+		auto type = field->getFieldType();
+		return (type == FieldTypeEnum::State || type == FieldTypeEnum::Out)
+			&& field->getSource() == nullptr
+			&& !field->isEmpty();
+	}
+
+	static FBase* findField(Node* node, const std::string& name, const std::string& className, const std::string& templateName)
+	{
+		for (auto field : node->getAllFields())
+		{
+			if (field->getObjectName() == name
+				&& field->getClassName() == className
+				&& field->getTemplateName() == templateName)
+				return field;
+		}
+
+		return nullptr;
+	}
+
+	std::shared_ptr<SceneGraph> SceneCheckpoint::load(const std::string filename)
+	{
+		std::ifstream in(filename.c_str(), std::ios::binary);
+		if (!in.is_open())
+		{
+			Log::sendMessage(Log::Error, "Cannot open the checkpoint " + filename);
+			return nullptr;
+		}
+
+		std::string description;
+		if (!this->readHeader(in, description))
+			return nullptr;
+
+		tinyxml2::XMLDocument doc;
+		if (doc.Parse(description.c_str(), description.size()) != tinyxml2::XML_SUCCESS)
+		{
+			Log::sendMessage(Log::Error, "The scene description in " + filename + " is broken");
+			return nullptr;
+		}
+
+		SceneLoaderXML loader;
+		std::shared_ptr<SceneGraph> scn = loader.readDocument(doc);
+		if (scn == nullptr)
+			return nullptr;
+
+		// Reset first so that states not contained in the checkpoint are initialized
+		scn->reset();
+
+		in.seekg(0);
+		if (!this->read(scn, in))
+			return nullptr;
+
+		return scn;
+	}
+
+	bool SceneCheckpoint::save(std::shared_ptr<SceneGraph> scn, const std::string filename)
+	{
+		std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+		{
+			Log::sendMessage(Log::Error, "Cannot create the checkpoint " + filename);
+			return false;
+		}
+
+		return this->write(scn, out);
+	}
+
+	bool SceneCheckpoint::restore(std::shared_ptr<SceneGraph> scn, const std::string filename)
+	{
+		std::ifstream in(filename.c_str(), std::ios::binary);
+		if (!in.is_open())
+		{
+			Log::sendMessage(Log::Error, "Cannot open the checkpoint " + filename);
+			return false;
+		}
+
+		return this->read(scn, in);
+	}
+
+	bool SceneCheckpoint::write(std::shared_ptr<SceneGraph> scn, std::ostream& out)
+	{
+		if (scn == nullptr)
+			return false;
+
+		tinyxml2::XMLDocument doc;
+		SceneLoaderXML loader;
+		if (!loader.writeDocument(scn, doc))
+			return false;
+
+		tinyxml2::XMLPrinter printer;
+		doc.Print(&printer);
+
+		out.write(CheckpointMagic, sizeof(CheckpointMagic));
+		writeBinaryValue(out, CheckpointVersion);
+		writeBinaryString(out, std::string(printer.CStr()));
+
+		writeBinaryValue(out, scn->getElapsedTime());
+		writeBinaryValue(out, scn->getFrameNumber());
+
+		std::vector<std::shared_ptr<Node>> nodes;
+		for (auto itor = scn->begin(); itor != scn->end(); itor++)
+			nodes.push_back(itor.get());
+
+		writeBinaryValue(out, (uint)nodes.size());
+
+		for (auto node : nodes)
+		{
+			std::vector<FBase*> fields;
+			for (auto field : node->getAllFields())
+			{
+				if (isCheckpointed(field))
+					fields.push_back(field);
+			}
+
+			writeBinaryString(out, node->getClassInfo()->getClassName());
+			writeBinaryValue(out, (uint)fields.size());
+
+			for (auto field : fields)
+			{
+				writeBinaryString(out, field->getObjectName());
+				writeBinaryString(out, field->getClassName());
+				writeBinaryString(out, field->getTemplateName());
+
+				// The payload size is only known after the field is streamed, leave a slot and fill it afterwards
+				uint64 size = 0;
+				std::streampos slot = out.tellp();
+				writeBinaryValue(out, size);
+
+				std::streampos begin = out.tellp();
+				if (!field->writeBinary(out))
+				{
+					if (!out.good())
+						return false;
+
+					// An empty payload marks a field that does not support binary streaming
+					Log::sendMessage(Log::Warning, "Field " + field->getObjectName() + " of " + node->getName() + " cannot be checkpointed");
+					out.seekp(begin);
+					continue;
+				}
+
+				std::streampos end = out.tellp();
+				size = (uint64)(end - begin);
+
+				out.seekp(slot);
+				writeBinaryValue(out, size);
+				out.seekp(end);
+			}
+		}
+
+		out.flush();
+
+		return out.good();
+	}
+
+	bool SceneCheckpoint::read(std::shared_ptr<SceneGraph> scn, std::istream& in)
+	{
+		if (scn == nullptr)
+			return false;
+
+		std::string description;
+		if (!this->readHeader(in, description))
+			return false;
+
+		float elapsedTime = 0.0f;
+		int frameNumber = 0;
+		uint nodeNum = 0;
+		if (!readBinaryValue(in, elapsedTime) || !readBinaryValue(in, frameNumber) || !readBinaryValue(in, nodeNum))
+			return false;
+
+		std::vector<std::shared_ptr<Node>> nodes;
+		for (auto itor = scn->begin(); itor != scn->end(); itor++)
+			nodes.push_back(itor.get());
+
+		if (nodes.size() != nodeNum)
+			Log::sendMessage(Log::Warning, "The checkpoint contains " + std::to_string(nodeNum) + " nodes while the scene contains " + std::to_string(nodes.size()));
+
+		for (uint i = 0; i < nodeNum; i++)
+		{
+			std::string className;
+			uint fieldNum = 0;
+			if (!readBinaryString(in, className) || !readBinaryValue(in, fieldNum))
+				return false;
+
+			Node* node = i < nodes.size() ? nodes[i].get() : nullptr;
+			if (node != nullptr && node->getClassInfo()->getClassName() != className)
+			{
+				Log::sendMessage(Log::Warning, "Node " + std::to_string(i) + " is expected to be " + className + ", its states are skipped");
+				node = nullptr;
+			}
+
+			for (uint j = 0; j < fieldNum; j++)
+			{
+				std::string name, fieldClass, templateName;
+				uint64 size = 0;
+				if (!readBinaryString(in, name) || !readBinaryString(in, fieldClass) || !readBinaryString(in, templateName) || !readBinaryValue(in, size))
+					return false;
+
+				std::streampos begin = in.tellg();
+
+				FBase* field = node == nullptr ? nullptr : findField(node, name, fieldClass, templateName);
+				if (field != nullptr && size > 0)
+				{
+					if (field->readBinary(in))
+						field->tick();
+					else
+						Log::sendMessage(Log::Warning, "Failed to restore field " + name + " of " + node->getName());
+				}
+
+				// Skip whatever was not consumed, so a mismatched field does not corrupt the following ones
+				in.clear();
+				in.seekg(begin + (std::streamoff)size);
+				if (!in.good())
+					return false;
+			}
+		}
+
+		scn->setElapsedTime(elapsedTime);
+		scn->setFrameNumber(frameNumber);
+
+		return true;
+	}
+
+	bool SceneCheckpoint::readHeader(std::istream& in, std::string& description)
+	{
+		char magic[sizeof(CheckpointMagic)];
+		in.read(magic, sizeof(magic));
+		if (!in.good() || memcmp(magic, CheckpointMagic, sizeof(magic)) != 0)
+		{
+			Log::sendMessage(Log::Error, "Not a checkpoint file");
+			return false;
+		}
+
+		uint version = 0;
+		if (!readBinaryValue(in, version) || version != CheckpointVersion)
+		{
+			Log::sendMessage(Log::Error, "Unsupported checkpoint version " + std::to_string(version));
+			return false;
+		}
+
+		return readBinaryString(in, description);
+	}
+
+	bool SceneCheckpoint::canLoadFileByExtension(const std::string extension)
+	{
+		std::string str = extension;
+		std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+		return (str == "ckpt");
+	}
+}
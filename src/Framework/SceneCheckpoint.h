@@ -0,0 +1,57 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "SceneLoaderFactory.h"
+
+#include <iostream>
+
+namespace dyno
+{
+	/**
+	 * @brief Binary checkpoint of a scene graph, loaded and saved by files with the extension "ckpt".
+	 *	A checkpoint contains the XML description of the scene, the elapsed time and frame number,
+	 *	and the data of all State and Out fields owned by each node, tagged by field name and type.
+	 *	Each field is streamed directly into the file, device arrays go through a bounded host staging buffer.
+	 *	Data kept by nodes and modules outside of fields is not saved, it is expected to be rebuilt from the states.
+	 */
+	class SceneCheckpoint : public SceneLoader
+	{
+	public:
+		/**
+		 * @brief Create the scene described by the checkpoint, reset it and restore all states
+		 */
+		std::shared_ptr<SceneGraph> load(const std::string filename) override;
+
+		bool save(std::shared_ptr<SceneGraph> scn, const std::string filename) override;
+
+		/**
+		 * @brief Restore states into an existing scene which has the same nodes as the checkpointed one.
+		 *	Should be called after the scene is reset, nodes are matched by their order and class names.
+		 */
+		bool restore(std::shared_ptr<SceneGraph> scn, const std::string filename);
+
+		/**
+		 * @brief The output stream must be seekable, the size of each field is written after its data
+		 */
+		bool write(std::shared_ptr<SceneGraph> scn, std::ostream& out);
+		bool read(std::shared_ptr<SceneGraph> scn, std::istream& in);
+
+	private:
+		bool readHeader(std::istream& in, std::string& description);
+
+		bool canLoadFileByExtension(const std::string extension) override;
+	};
+}
@@ -5,16 +5,18 @@
 #include "Action/ActPostProcessing.h"
 
 #include "Module/VisualModule.h"
+#include "Module/OutputModule.h"
 
 #include "Module/MouseInputModule.h"
 #include "Module/KeyboardInputModule.h"
 
 #include "SceneLoaderFactory.h"
 
-#include "Timer.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
 
-#include <sstream>
-#include <iomanip>
+#include <limits>
+#include <algorithm>
 
 namespace dyno
 {
@@ -51,6 +53,16 @@ namespace dyno
 		mAdvativeInterval = adaptive;
 	}
 
+	void SceneGraph::setParallelExecution(bool enabled)
+	{
+		mParallelExecution = enabled;
+	}
+
+	bool SceneGraph::isParallelExecutionEnabled()
+	{
+		return mParallelExecution;
+	}
+
 	void SceneGraph::setGravity(Vec3f g)
 	{
 		mGravity = g;
@@ -64,7 +76,10 @@ namespace dyno
 	SceneGraph::~SceneGraph()
 	{
 		mNodeMap.clear();
-		mNodeQueue.clear();
+
+		mNodeIndices.clear();
+		mIndexedNodes.clear();
+		mTopologicalOrder.clear();
 	}
 
 	void SceneGraph::advance(float dt)
@@ -93,25 +108,12 @@ namespace dyno
 					return;
 				}
 
-				CTimer timer;
-
-				if (mTiming) {
-					timer.start();
-				}
+				ProfileZone zone(node->getClassInfo()->m_className.c_str(), Profiler::Node, mTiming);
 
 				node->update();
 
-				if (mTiming) {
-					timer.stop();
-
-					std::stringstream name;
-					std::stringstream ss;
-					name << std::setw(40) << node->getClassInfo()->getClassName();
-					ss << std::setprecision(10) << timer.getElapsedTime();
-
-					std::string info = "Node: \t" + name.str() + ": \t " + ss.str() + "ms \n";
-					Log::sendMessage(Log::Info, info);
-				}
+				if (mTiming)
+					DYNO_LOG(Log::Info, "Node: \t" + node->getClassInfo()->getClassName() + ": \t " + std::to_string(zone.elapsedTime()) + "ms");
 			}
 
 			float mDt;
@@ -120,7 +122,10 @@ namespace dyno
 			bool mTiming = false;
 		};
 
-		this->traverseForward<AdvanceAct>(dt, mElapsedTime, mNodeTiming);
+		if (mParallelExecution)
+			this->traverseForwardInParallel<AdvanceAct>(dt, mElapsedTime, mNodeTiming);
+		else
+			this->traverseForward<AdvanceAct>(dt, mElapsedTime, mNodeTiming);
 
 		mElapsedTime += dt;
 	}
@@ -129,10 +134,10 @@ namespace dyno
 	{
 		mSync.lock();
 
-		std::cout << "****************    Frame " << mFrameNumber << " Started    ****************" << std::endl;
-		
-		CTimer timer;
-		timer.start();
+		if (mSimulationTiming)
+			DYNO_LOG(Log::Info, "****************    Frame " + std::to_string(mFrameNumber) + " Started    ****************");
+
+		ProfileZone zone("Frame", Profiler::Frame, true);
 
 		float t = 0.0f;
 		float dt = 0.0f;
@@ -187,9 +192,10 @@ namespace dyno
 
 		this->traverseForward<AssignFrameNumberAct>(mFrameNumber);
 
-		timer.stop();
+		mFrameCost = (float)zone.elapsedTime();
 
-		std::cout << "----------------    Frame " << mFrameNumber << " Ended! ( " << timer.getElapsedTime() << " ms in Total)  ----------------" << std::endl << std::endl;
+		if (mSimulationTiming)
+			DYNO_LOG(Log::Info, "----------------    Frame " + std::to_string(mFrameNumber) + " Ended! ( " + std::to_string(mFrameCost) + " ms in Total)  ----------------");
 
 		mFrameNumber++;
 
@@ -214,6 +220,31 @@ namespace dyno
 		}
 	}
 
+	void SceneGraph::publishGraphicsContext()
+	{
+		class PublishGraphicsContextAct : public Action
+		{
+		public:
+			void process(Node* node) override {
+				node->updateGraphicsContext();
+			}
+		};
+
+		//Wait for the scene instead of skipping the update, the published frame must not be missed
+		mSync.lock();
+		this->traverseForward<PublishGraphicsContextAct>();
+		mSync.unlock();
+	}
+
+	void SceneGraph::forceUpdateGraphicsContext(Node* node)
+	{
+		if (node == nullptr)
+			return;
+
+		mSync.lock();
+		node->graphicsPipeline()->forceUpdate();
+		mSync.unlock();
+	}
 
 	void SceneGraph::run()
 	{
@@ -244,6 +275,14 @@ namespace dyno
 					return;
 				}
 
+				//Files spanning several frames are closed before a new run starts
+				for (auto m : node->getModuleList())
+				{
+					auto output = std::dynamic_pointer_cast<OutputModule>(m);
+					if (output != nullptr)
+						output->finalize();
+				}
+
 				node->reset();
 			}
 		};
@@ -260,11 +299,8 @@ namespace dyno
 
 	void SceneGraph::reset(std::shared_ptr<Node> node)
 	{
-		mSync.lock();
-
+		//The scene lock is taken inside traverseForward()
 		this->traverseForward<ResetAct>(node);
-
-		mSync.unlock();
 	}
 
 	void SceneGraph::printNodeInfo(bool enabled)
@@ -430,148 +466,388 @@ namespace dyno
 		this->traverseForward(&eventAct);
 	}
 
-	//Used to traverse the whole scene graph
-	void DFS(Node* node, NodeList& nodeQueue, std::map<ObjectId, bool>& visited) {
+	static const uint NullIndex = std::numeric_limits<uint>::max();
 
-		visited[node->objectId()] = true;
-
-		auto imports = node->getImportNodes();
+	//Nodes a node imports from, either through node ports or input fields
+	template<typename Func>
+	static void forEachUpstreamNode(Node* node, Func func)
+	{
+		auto& imports = node->getImportNodes();
 		for (auto port : imports) {
 			auto& inNodes = port->getNodes();
 			for (auto inNode : inNodes) {
-				if (inNode != nullptr && !visited[inNode->objectId()]) {
-					DFS(inNode, nodeQueue, visited);
-				}
+				if (inNode != nullptr)
+					func(inNode);
 			}
 		}
 
-		auto inFields = node->getInputFields();
+		auto& inFields = node->getInputFields();
 		for (auto f : inFields) {
 			auto* src = f->getSource();
 			if (src != nullptr) {
 				auto* inNode = dynamic_cast<Node*>(src->parent());
-				if (inNode != nullptr && !visited[inNode->objectId()]) {
-					DFS(inNode, nodeQueue, visited);
-				}
+				if (inNode != nullptr)
+					func(inNode);
 			}
 		}
+	}
 
-		nodeQueue.push_back(node);
-
-		auto exports = node->getExportNodes();
+	//Nodes a node exports to, either through node ports or output fields
+	template<typename Func>
+	static void forEachDownstreamNode(Node* node, Func func)
+	{
+		auto& exports = node->getExportNodes();
 		for (auto port : exports) {
 			auto exNode = port->getParent();
-			if (exNode != nullptr && !visited[exNode->objectId()]) {
-				DFS(exNode, nodeQueue, visited);
-			}
+			if (exNode != nullptr)
+				func(exNode);
 		}
 
-		auto outFields = node->getOutputFields();
+		auto& outFields = node->getOutputFields();
 		for (auto f : outFields) {
 			auto& sinks = f->getSinks();
 			for (auto sink : sinks) {
 				if (sink != nullptr) {
 					auto exNode = dynamic_cast<Node*>(sink->parent());
-					if (exNode != nullptr && !visited[exNode->objectId()]) {
-						DFS(exNode, nodeQueue, visited);
-					}
+					if (exNode != nullptr)
+						func(exNode);
 				}
 			}
 		}
-	};
+	}
+
+	uint SceneGraph::indexOf(Node* node)
+	{
+		auto it = mNodeIndices.find(node);
+		return it == mNodeIndices.end() ? NullIndex : it->second;
+	}
+
+	uint SceneGraph::nextStamp()
+	{
+		mCurrentStamp++;
 
-	//Used to traverse the scene graph from a specific node
-	void BFS(Node* node, NodeList& list, std::map<ObjectId, bool>& visited) {
+		//Reset all stamps once the counter wraps around
+		if (mCurrentStamp == 0)
+		{
+			std::fill(mVisitStamps.begin(), mVisitStamps.end(), 0);
+			mCurrentStamp = 1;
+		}
+
+		return mCurrentStamp;
+	}
+
+	void SceneGraph::insertNode(Node* node)
+	{
+		uint index;
+		if (mFreeIndices.empty())
+		{
+			index = (uint)mIndexedNodes.size();
+			mIndexedNodes.push_back(node);
+			mPositions.push_back(NullIndex);
+			mVisitStamps.push_back(0);
+		}
+		else
+		{
+			index = mFreeIndices.back();
+			mFreeIndices.pop_back();
+			mIndexedNodes[index] = node;
+		}
+
+		mNodeIndices[node] = index;
+
+		//The new node will be placed during the full rebuild
+		if (mQueueUpdateRequired)
+			return;
 
-		visited[node->objectId()] = true;
+		mPositions[index] = (uint)mTopologicalOrder.size();
+		mTopologicalOrder.push_back(index);
+		mLevelsOutdated = true;
 
-		std::queue<Node*> queue;
-		queue.push(node);
+		//Connections created before the node is added, the node is appended to the end so that only its exports need reordering.
+		//Once a cycle is found, the order is rebuilt from scratch and the remaining edges are placed during the rebuild
+		forEachDownstreamNode(node, [&](Node* exNode) {
+			this->insertEdge(node, exNode);
+		});
+	}
+
+	void SceneGraph::removeNode(Node* node)
+	{
+		auto it = mNodeIndices.find(node);
+		if (it == mNodeIndices.end())
+			return;
 
-		while (!queue.empty())
+		uint index = it->second;
+		if (mPositions[index] != NullIndex && !mQueueUpdateRequired)
 		{
-			auto fn = queue.front();
-			queue.pop();
+			mTopologicalOrder[mPositions[index]] = NullIndex;
+			mHoleNum++;
+		}
 
-			list.push_back(fn);
+		mPositions[index] = NullIndex;
+		mIndexedNodes[index] = nullptr;
+		mFreeIndices.push_back(index);
+		mNodeIndices.erase(it);
 
-			auto exports = fn->getExportNodes();
-			for (auto port : exports) {
-				auto next = port->getParent();
-				if (next != nullptr && !visited[next->objectId()]) {
-					queue.push(next);
-				}
+		mLevelsOutdated = true;
+
+		if (2 * mHoleNum > mTopologicalOrder.size())
+			compactTopologicalOrder();
+	}
+
+	void SceneGraph::compactTopologicalOrder()
+	{
+		uint num = 0;
+		for (auto index : mTopologicalOrder)
+		{
+			if (index != NullIndex)
+			{
+				mPositions[index] = num;
+				mTopologicalOrder[num] = index;
+				num++;
 			}
+		}
 
-			auto outFields = fn->getOutputFields();
-			for (auto f : outFields) {
-				auto& sinks = f->getSinks();
-				for (auto sink : sinks) {
-					if (sink != nullptr) {
-						auto next = dynamic_cast<Node*>(sink->parent());
-						if (next != nullptr && !visited[next->objectId()]) {
-							queue.push(next);
-						}
-					}
+		mTopologicalOrder.resize(num);
+		mHoleNum = 0;
+	}
+
+	//Pearce-Kelly algorithm, only nodes positioned between "to" and "from" are searched and reordered
+	bool SceneGraph::insertEdge(Node* from, Node* to)
+	{
+		if (mQueueUpdateRequired || from == to)
+			return true;
+
+		uint x = indexOf(from);
+		uint y = indexOf(to);
+		if (x == NullIndex || y == NullIndex)
+			return true;
+
+		uint lb = mPositions[y];
+		uint ub = mPositions[x];
+
+		//The order is kept, but the new edge may push "to" to a deeper level
+		mLevelsOutdated = true;
+		if (ub < lb)
+			return true;
+
+		uint stamp = nextStamp();
+
+		//Nodes depending on "to" that are placed before "from"
+		std::vector<uint> forward;
+		std::vector<uint> stack(1, y);
+		mVisitStamps[y] = stamp;
+
+		bool cyclic = false;
+		while (!stack.empty() && !cyclic)
+		{
+			uint cur = stack.back();
+			stack.pop_back();
+			forward.push_back(cur);
+
+			forEachDownstreamNode(mIndexedNodes[cur], [&](Node* exNode) {
+				uint next = indexOf(exNode);
+				if (next == NullIndex || mVisitStamps[next] == stamp)
+					return;
+
+				if (next == x)
+					cyclic = true;
+				else if (mPositions[next] < ub) {
+					mVisitStamps[next] = stamp;
+					stack.push_back(next);
 				}
-			}
+			});
 		}
-	};
 
-	// 	void SceneGraph::retriveExecutionQueue(std::list<Node*>& nQueue)
-	// 	{
-	// 		nQueue.clear();
-	// 
-	// 		std::map<ObjectId, bool> visited;
-	// 		for (auto& nm : mNodeMap) {
-	// 			visited[nm.first] = false;
-	// 		}
-	// 
-	// 		for (auto& n : mNodeMap) {
-	// 			if (!visited[n.first]) {
-	// 
-	// 				Node* node = n.second.get();
-	// 
-	// 				DFS(node, nQueue, visited);
-	// 			}
-	// 		}
-	// 
-	// 		visited.clear();
-	// 	}
+		//No node has been moved yet, but the current order can no longer respect every edge.
+		//Drop it so that the next update falls back to the depth-first rebuild, which tolerates cycles.
+		if (cyclic)
+		{
+			Log::sendMessage(Log::Warning, std::string("A cyclic dependency is detected between ") + from->getName() + " and " + to->getName());
 
-	void SceneGraph::updateExecutionQueue()
+			mQueueUpdateRequired = true;
+			return false;
+		}
+
+		//Nodes "from" depends on that are placed after "to"
+		std::vector<uint> backward;
+		stack.push_back(x);
+		mVisitStamps[x] = stamp;
+
+		while (!stack.empty())
+		{
+			uint cur = stack.back();
+			stack.pop_back();
+			backward.push_back(cur);
+
+			forEachUpstreamNode(mIndexedNodes[cur], [&](Node* inNode) {
+				uint next = indexOf(inNode);
+				if (next == NullIndex || mVisitStamps[next] == stamp)
+					return;
+
+				if (mPositions[next] > lb) {
+					mVisitStamps[next] = stamp;
+					stack.push_back(next);
+				}
+			});
+		}
+
+		auto byPosition = [&](uint a, uint b) { return mPositions[a] < mPositions[b]; };
+		std::sort(forward.begin(), forward.end(), byPosition);
+		std::sort(backward.begin(), backward.end(), byPosition);
+
+		//Reuse the positions occupied by both sets, place the backward set in front of the forward one
+		std::vector<uint> slots;
+		slots.reserve(forward.size() + backward.size());
+		for (auto index : backward)
+			slots.push_back(mPositions[index]);
+		for (auto index : forward)
+			slots.push_back(mPositions[index]);
+
+		std::sort(slots.begin(), slots.end());
+
+		uint k = 0;
+		for (auto index : backward)
+		{
+			mTopologicalOrder[slots[k]] = index;
+			mPositions[index] = slots[k++];
+		}
+
+		for (auto index : forward)
+		{
+			mTopologicalOrder[slots[k]] = index;
+			mPositions[index] = slots[k++];
+		}
+
+		mLevelsOutdated = true;
+
+		return true;
+	}
+
+	void SceneGraph::notifyConnection(Node* from, Node* to)
 	{
-		if (!mQueueUpdateRequired)
+		if (from == nullptr || to == nullptr)
 			return;
 
-		mNodeQueue.clear();
+		this->insertEdge(from, to);
+	}
 
-		std::map<ObjectId, bool> visited;
-		for (auto& nm : mNodeMap) {
-			visited[nm.first] = false;
-		}
+	//Used to traverse the whole scene graph
+	void SceneGraph::depthFirstSort(uint index, uint stamp)
+	{
+		mVisitStamps[index] = stamp;
 
-		for (auto& n : mNodeMap) {
-			if (!visited[n.first]) {
+		Node* node = mIndexedNodes[index];
 
-				Node* node = n.second.get();
+		forEachUpstreamNode(node, [&](Node* inNode) {
+			uint next = indexOf(inNode);
+			if (next != NullIndex && mVisitStamps[next] != stamp)
+				depthFirstSort(next, stamp);
+		});
 
-				DFS(node, mNodeQueue, visited);
+		mPositions[index] = (uint)mTopologicalOrder.size();
+		mTopologicalOrder.push_back(index);
+
+		forEachDownstreamNode(node, [&](Node* exNode) {
+			uint next = indexOf(exNode);
+			if (next != NullIndex && mVisitStamps[next] != stamp)
+				depthFirstSort(next, stamp);
+		});
+	}
+
+	void SceneGraph::rebuildTopologicalOrder()
+	{
+		mTopologicalOrder.clear();
+		mHoleNum = 0;
+
+		uint stamp = nextStamp();
+		for (auto& n : mNodeMap) {
+			uint index = indexOf(n.second.get());
+			if (index != NullIndex && mVisitStamps[index] != stamp) {
+				depthFirstSort(index, stamp);
 			}
 		}
 
-		visited.clear();
+		//Disconnections are not reported to the scene graph, so a cyclic graph is sorted again on every update until the cycle is broken
+		bool acyclic = true;
+		for (auto index : mTopologicalOrder)
+		{
+			forEachDownstreamNode(mIndexedNodes[index], [&](Node* exNode) {
+				uint next = indexOf(exNode);
+				if (next != NullIndex && mPositions[next] < mPositions[index])
+					acyclic = false;
+			});
+		}
+
+		mQueueUpdateRequired = !acyclic;
+		mLevelsOutdated = true;
+	}
+
+	//Traversals walk mTopologicalOrder directly, only a full rebuild visits every node
+	void SceneGraph::updateExecutionQueue()
+	{
+		if (mQueueUpdateRequired)
+			rebuildTopologicalOrder();
+	}
+
+	SceneGraph::Iterator SceneGraph::begin()
+	{
+		updateExecutionQueue();
+
+		NodeList queue;
+		for (auto index : mTopologicalOrder)
+		{
+			if (index != NullIndex)
+				queue.push_back(mIndexedNodes[index]);
+		}
 
-		mQueueUpdateRequired = false;
+		return NodeIterator(queue, mNodeMap);
+	}
+
+	void SceneGraph::updateNodeLevels()
+	{
+		if (!mLevelsOutdated)
+			return;
+
+		//Assign each node a level one higher than the deepest node it imports from
+		mNodeLevels.clear();
+
+		std::vector<uint> levels(mIndexedNodes.size(), 0);
+		for (auto index : mTopologicalOrder)
+		{
+			if (index == NullIndex)
+				continue;
+
+			Node* node = mIndexedNodes[index];
+
+			uint level = 0;
+			forEachUpstreamNode(node, [&](Node* inNode) {
+				uint in = indexOf(inNode);
+				if (in != NullIndex && mPositions[in] < mPositions[index] && levels[in] + 1 > level)
+					level = levels[in] + 1;
+			});
+
+			levels[index] = level;
+
+			if (mNodeLevels.size() <= level)
+				mNodeLevels.resize(level + 1);
+
+			mNodeLevels[level].push_back(node);
+		}
+
+		mLevelsOutdated = false;
 	}
 
 	void SceneGraph::traverseBackward(Action* act)
 	{
 		updateExecutionQueue();
 
-		for (auto rit = mNodeQueue.rbegin(); rit != mNodeQueue.rend(); ++rit)
+		for (size_t i = mTopologicalOrder.size(); i > 0; i--)
 		{
-			Node* node = *rit;
+			uint index = mTopologicalOrder[i - 1];
+			if (index == NullIndex)
+				continue;
+
+			Node* node = mIndexedNodes[index];
 
 			act->start(node);
 			act->process(node);
@@ -583,9 +859,14 @@ namespace dyno
 	{
 		updateExecutionQueue();
 
-		for (auto it = mNodeQueue.begin(); it != mNodeQueue.end(); ++it)
+		//Indexed instead of iterated, the order may be compacted if an action deletes a node
+		for (size_t i = 0; i < mTopologicalOrder.size(); i++)
 		{
-			Node* node = *it;
+			uint index = mTopologicalOrder[i];
+			if (index == NullIndex)
+				continue;
+
+			Node* node = mIndexedNodes[index];
 
 			act->start(node);
 			act->process(node);
@@ -593,76 +874,83 @@ namespace dyno
 		}
 	}
 
-	void SceneGraph::traverseForward(std::shared_ptr<Node> node, Action* act)
+	void SceneGraph::traverseForwardInParallel(Action* act)
 	{
-		std::map<ObjectId, bool> visited;
-		for (auto& nm : mNodeMap) {
-			visited[nm.first] = false;
-		}
+		updateExecutionQueue();
+		updateNodeLevels();
 
-		NodeList list;
-		BFS(node.get(), list, visited);
+		ThreadPool* pool = ThreadPool::instance();
 
-		for (auto it = list.begin(); it != list.end(); ++it)
+		for (auto& level : mNodeLevels)
 		{
-			Node* node = *it;
+			//Fall back to a serial traversal in the same order as traverseForward()
+			if (pool->size() == 0 || level.size() == 1)
+			{
+				for (auto node : level)
+				{
+					act->start(node);
+					act->process(node);
+					act->end(node);
+				}
+			}
+			else
+			{
+				pool->parallelFor(0, (uint)level.size(), [&](uint i) {
+					Node* node = level[i];
 
-			act->start(node);
-			act->process(node);
-			act->end(node);
+					act->start(node);
+					act->process(node);
+					act->end(node);
+				});
+			}
 		}
-
-		list.clear();
-		visited.clear();
 	}
 
-	//Used to traverse the scene graph from a specific node
-	void BFSWithAutoSync(Node* node, NodeList& list, std::map<ObjectId, bool>& visited) {
+	//Used to traverse the scene graph from a specific node, visited flags are kept per call instead of in the shared stamps
+	void SceneGraph::collectDownstreamNodes(Node* root, bool autoSyncOnly, std::vector<Node*>& nodes)
+	{
+		updateExecutionQueue();
 
-		visited[node->objectId()] = true;
+		std::vector<bool> visited(mIndexedNodes.size(), false);
 
-		std::queue<Node*> queue;
-		queue.push(node);
+		uint rootIndex = indexOf(root);
+		if (rootIndex != NullIndex)
+			visited[rootIndex] = true;
 
-		while (!queue.empty())
+		std::vector<uint> reached;
+		std::vector<Node*> stack(1, root);
+		while (!stack.empty())
 		{
-			auto fn = queue.front();
-			queue.pop();
+			Node* cur = stack.back();
+			stack.pop_back();
 
-			list.push_back(fn);
+			forEachDownstreamNode(cur, [&](Node* exNode) {
+				if (autoSyncOnly && !exNode->isAutoSync())
+					return;
 
-			auto exports = fn->getExportNodes();
-			for (auto port : exports) {
-				auto next = port->getParent();
-				if (next != nullptr && next->isAutoSync() && !visited[next->objectId()]) {
-					queue.push(next);
-				}
-			}
+				uint next = indexOf(exNode);
+				if (next == NullIndex || visited[next])
+					return;
 
-			auto outFields = fn->getOutputFields();
-			for (auto f : outFields) {
-				auto& sinks = f->getSinks();
-				for (auto sink : sinks) {
-					if (sink != nullptr) {
-						auto next = dynamic_cast<Node*>(sink->parent());
-						if (next != nullptr && next->isAutoSync() && !visited[next->objectId()]) {
-							queue.push(next);
-						}
-					}
-				}
-			}
+				visited[next] = true;
+				reached.push_back(next);
+				stack.push_back(exNode);
+			});
 		}
-	};
 
-	void SceneGraph::traverseForwardWithAutoSync(std::shared_ptr<Node> node, Action* act)
+		std::sort(reached.begin(), reached.end(), [&](uint a, uint b) { return mPositions[a] < mPositions[b]; });
+
+		nodes.push_back(root);
+		for (auto index : reached)
+			nodes.push_back(mIndexedNodes[index]);
+	}
+
+	void SceneGraph::traverseForward(std::shared_ptr<Node> node, Action* act)
 	{
-		std::map<ObjectId, bool> visited;
-		for (auto& nm : mNodeMap) {
-			visited[nm.first] = false;
-		}
+		std::lock_guard<std::mutex> lock(mSync);
 
-		NodeList list;
-		BFSWithAutoSync(node.get(), list, visited);
+		std::vector<Node*> list;
+		collectDownstreamNodes(node.get(), false, list);
 
 		for (auto it = list.begin(); it != list.end(); ++it)
 		{
@@ -672,9 +960,23 @@ namespace dyno
 			act->process(node);
 			act->end(node);
 		}
+	}
 
-		list.clear();
-		visited.clear();
+	void SceneGraph::traverseForwardWithAutoSync(std::shared_ptr<Node> node, Action* act)
+	{
+		std::lock_guard<std::mutex> lock(mSync);
+
+		std::vector<Node*> list;
+		collectDownstreamNodes(node.get(), true, list);
+
+		for (auto it = list.begin(); it != list.end(); ++it)
+		{
+			Node* node = *it;
+
+			act->start(node);
+			act->process(node);
+			act->end(node);
+		}
 	}
 
 	void SceneGraph::deleteNode(std::shared_ptr<Node> node)
@@ -683,16 +985,17 @@ namespace dyno
 			mNodeMap.find(node->objectId()) == mNodeMap.end())
 			return;
 
+		this->removeNode(node.get());
+
 		mNodeMap.erase(node->objectId());
-		mQueueUpdateRequired = true;
 	}
 
 	void SceneGraph::propagateNode(std::shared_ptr<Node> node)
 	{
 		std::map<ObjectId, bool> visited;
-		for (auto it = mNodeQueue.begin(); it != mNodeQueue.end(); ++it)
+		for (auto it = mNodeMap.begin(); it != mNodeMap.end(); ++it)
 		{
-			visited[(*it)->objectId()] = false;
+			visited[it->first] = false;
 		}
 
 		//DownwardDFS(node.get(), visited);
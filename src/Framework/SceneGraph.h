@@ -21,6 +21,7 @@
 #include "Module/InputModule.h"
 
 #include <mutex>
+#include <unordered_map>
 
 namespace dyno
 {
@@ -44,6 +45,21 @@ namespace dyno
 		virtual void advance(float dt);
 		virtual void takeOneFrame();
 		virtual void updateGraphicsContext();
+
+		/**
+		 * @brief Update the graphics pipelines of all nodes right after a frame, meant to be called by the simulation thread.
+		 *	Visual modules copy the fields they consume into their own staging buffers, which are uploaded when the modules are drawn.
+		 *	The render thread can therefore draw the published frame while the next one is simulated,
+		 *	instead of waiting for the simulation to update the graphics context.
+		 */
+		void publishGraphicsContext();
+
+		/**
+		 * @brief Force the graphics pipeline of a node to update, e.g., after its modules are edited.
+		 *	Waits for the frame being simulated, the pipeline may be updated by the simulation thread at the same time otherwise.
+		 */
+		void forceUpdateGraphicsContext(Node* node);
+
 		virtual void run();
 
 		NBoundingBox boundingBox();
@@ -93,10 +109,11 @@ namespace dyno
 				return nullptr;
 
 			mNodeMap[tNode->objectId()] = tNode;
-			mQueueUpdateRequired = true;
 
 			tNode->setSceneGraph(this);
 
+			this->insertNode(tNode.get());
+
 			return tNode;
 		}
 
@@ -121,12 +138,23 @@ namespace dyno
 		inline float getTimeCostPerFrame() { return mFrameCost; }
 		inline float getFrameInterval() { return 1.0f / mFrameRate; }
 
+		inline float getElapsedTime() { return mElapsedTime; }
+		inline void setElapsedTime(float t) { mElapsedTime = t; }
+
 		inline int getFrameNumber() { return mFrameNumber; }
 		inline void setFrameNumber(int n) { mFrameNumber = n; }
 
 		bool isIntervalAdaptive();
 		void setAdaptiveInterval(bool adaptive);
 
+		/**
+		 * @brief Enable or disable updating independent nodes concurrently in advance()
+		 *
+		 * @param enabled if false, nodes are updated one by one following the execution queue
+		 */
+		void setParallelExecution(bool enabled);
+		bool isParallelExecutionEnabled();
+
 		void setGravity(Vec3f g);
 		Vec3f getGravity();
 
@@ -136,20 +164,22 @@ namespace dyno
 		void setLowerBound(Vec3f lowerBound);
 		void setUpperBound(Vec3f upperBound);
 
-		inline Iterator begin() {
-
-			updateExecutionQueue();
-
-			return NodeIterator(mNodeQueue, mNodeMap);
-		}
+		Iterator begin();
 
 		inline Iterator end() { return NodeIterator(); }
 
 		/**
 		 * @brief An interface to tell SceneGraph to update the execuation queue
+		 *	The whole queue will be rebuilt, prefer notifyConnection() if only a new connection is created
 		 */
 		void markQueueUpdateRequired();
 
+		/**
+		 * @brief Tell SceneGraph that node "to" starts to depend on node "from",
+		 *	only nodes lying between the two in the execution queue are reordered.
+		 */
+		void notifyConnection(Node* from, Node* to);
+
 	public:
 		void onMouseEvent(PMouseEvent event);
 
@@ -184,7 +214,21 @@ namespace dyno
 		}
 
 		/**
-		 * @brief Breadth-first tree traversal starting from a specific node
+		 * @brief Level-by-level tree traversal, nodes inside the same level share no ports or fields
+		 *	and are dispatched onto the thread pool. Levels are visited in order.
+		 *
+		 * @param act 	Operation on the node, start(), process() and end() must be safe to be called concurrently on different nodes
+		 */
+		void traverseForwardInParallel(Action* act);
+
+		template<class Act, class ... Args>
+		void traverseForwardInParallel(Args&& ... args) {
+			Act action(std::forward<Args>(args)...);
+			traverseForwardInParallel(&action);
+		}
+
+		/**
+		 * @brief Breadth-first tree traversal starting from a specific node, the scene lock is held during the traversal
 		 *
 		 * @param node  Root node
 		 * @param act 	Operation on the node
@@ -199,6 +243,7 @@ namespace dyno
 
 		/**
 		 * @brief Breadth-first tree traversal starting from a specific node, only those whose mAutoSync turned-on will be visited.
+		 *	The scene lock is held during the traversal, so it is safe to be called from a thread other than the simulation one.
 		 *
 		 * @param node  Root node
 		 * @param act 	Operation on the node
@@ -216,6 +261,29 @@ namespace dyno
 
 		void updateExecutionQueue();
 
+	private:
+		void insertNode(Node* node);
+		void removeNode(Node* node);
+
+		/**
+		 * @brief Move node "to" behind node "from" in the topological order, return false if the edge closes a cycle
+		 */
+		bool insertEdge(Node* from, Node* to);
+
+		void rebuildTopologicalOrder();
+		void depthFirstSort(uint index, uint stamp);
+		void compactTopologicalOrder();
+
+		void updateNodeLevels();
+
+		/**
+		 * @brief Collect all nodes reachable from the root, sorted in the execution order
+		 */
+		void collectDownstreamNodes(Node* root, bool autoSyncOnly, std::vector<Node*>& nodes);
+
+		uint indexOf(Node* node);
+		uint nextStamp();
+
 	public:
 		SceneGraph()
 			: mElapsedTime(0)
@@ -239,6 +307,8 @@ namespace dyno
 	private:
 		bool mAdvativeInterval = true;
 
+		bool mParallelExecution = false;
+
 		float mElapsedTime;
 		float mMaxTime;
 		float mFrameRate;
@@ -254,11 +324,37 @@ namespace dyno
 	private:
 		//std::shared_ptr<Node> mRoot = nullptr;
 
+		//The topological order should be rebuilt from scratch
 		bool mQueueUpdateRequired = false;
 
+		//mNodeLevels should be regenerated from the topological order
+		bool mLevelsOutdated = false;
+
 		NodeMap mNodeMap;
 
-		NodeList mNodeQueue;
+		/**
+		 * Each node in the scene is assigned a dense index, indices of deleted nodes are recycled
+		 */
+		std::unordered_map<Node*, uint> mNodeIndices;
+		std::vector<Node*> mIndexedNodes;
+		std::vector<uint> mFreeIndices;
+
+		/**
+		 * Node indices in the execution order, deleted nodes leave holes until the order is compacted.
+		 * mPositions maps a node index back to its position in mTopologicalOrder.
+		 */
+		std::vector<uint> mTopologicalOrder;
+		std::vector<uint> mPositions;
+		uint mHoleNum = 0;
+
+		//Visited flags of graph searches, a node is visited if its stamp equals the current one
+		std::vector<uint> mVisitStamps;
+		uint mCurrentStamp = 0;
+
+		/**
+		 * Nodes grouped by their dependency levels, a node only depends on nodes in preceding levels
+		 */
+		std::vector<std::vector<Node*>> mNodeLevels;
 
 		bool mNodeTiming = false;
 		bool mSimulationTiming = false;
@@ -1,5 +1,6 @@
 #include "SceneLoaderFactory.h"
 #include "SceneLoaderXML.h"
+#include "SceneCheckpoint.h"
 
 namespace dyno
 {
@@ -45,6 +46,8 @@ namespace dyno
 	{
 		SceneLoaderXML* xmlLoder = new SceneLoaderXML();
 		this->addEntry(xmlLoder);
+
+		this->addEntry(new SceneCheckpoint());
 	}
 
 }
\ No newline at end of file
@@ -15,6 +15,24 @@ namespace dyno
 			return nullptr;
 		}
 
+		return this->readDocument(doc);
+	}
+
+	bool SceneLoaderXML::save(std::shared_ptr<SceneGraph> scn, const std::string filename)
+	{
+		tinyxml2::XMLDocument doc;
+		if (!this->writeDocument(scn, doc))
+			return false;
+
+		return doc.SaveFile(filename.c_str()) == tinyxml2::XML_SUCCESS;
+	}
+
+	std::shared_ptr<SceneGraph> SceneLoaderXML::readDocument(tinyxml2::XMLDocument& doc)
+	{
+		tinyxml2::XMLElement* root = doc.RootElement();
+		if (root == nullptr)
+			return nullptr;
+
 		for (size_t i = 0; i < mConnectionInfo.size(); i++){
 			mConnectionInfo[i].clear();
 		}
@@ -22,8 +40,6 @@ namespace dyno
 
 		std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
 
-		tinyxml2::XMLElement* root = doc.RootElement();
-
 		std::vector<std::shared_ptr<Node>> nodes;
 		tinyxml2::XMLElement* nodeXML = root->FirstChildElement("Node");
 		while (nodeXML)
@@ -65,10 +81,8 @@ namespace dyno
 		return scn;
 	}
 
-	bool SceneLoaderXML::save(std::shared_ptr<SceneGraph> scn, const std::string filename)
+	bool SceneLoaderXML::writeDocument(std::shared_ptr<SceneGraph> scn, tinyxml2::XMLDocument& doc)
 	{
-		tinyxml2::XMLDocument doc;
-
 // 		const char* declaration = "<?xml version=\"0.6.0\" encoding=\"UTF-8\">";
 // 		doc.Parse(declaration);
 
@@ -355,8 +369,6 @@ namespace dyno
 			fieldsOut.clear();
 		}
 
-		doc.SaveFile(filename.c_str());
-
 		indices.clear();
 
 		return true;
@@ -20,6 +20,16 @@ namespace dyno {
 
 		bool save(std::shared_ptr<SceneGraph> scn, const std::string filename) override;
 
+		/**
+		 * @brief Describe nodes, parameters, pipelines and connections of a scene graph in an XML document
+		 */
+		bool writeDocument(std::shared_ptr<SceneGraph> scn, tinyxml2::XMLDocument& doc);
+
+		/**
+		 * @brief Create a scene graph from an XML document written by writeDocument()
+		 */
+		std::shared_ptr<SceneGraph> readDocument(tinyxml2::XMLDocument& doc);
+
 	private:
 		std::shared_ptr<Node> processNode(tinyxml2::XMLElement* nodeXML);
 		std::shared_ptr<Module> processModule(tinyxml2::XMLElement* moduleXML);
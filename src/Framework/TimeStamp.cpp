@@ -1,7 +1,4 @@
 #include "TimeStamp.h"
-#include <atomic>
-
-#include <atomic>
 
 namespace dyno {
 
@@ -13,7 +10,7 @@ namespace dyno {
 	void TimeStamp::mark()
 	{
 		static std::atomic<uint64_t> GlobalTickTime(0U);
-		mTickTime = (uint64)++GlobalTickTime;
+		mTickTime.store((uint64)++GlobalTickTime, std::memory_order_release);
 	}
 
 }
\ No newline at end of file
@@ -17,6 +17,8 @@
 
 #include "Platform.h"
 
+#include <atomic>
+
 namespace dyno {
 	/**
 	*  \brief Time stamp
@@ -30,11 +32,14 @@ namespace dyno {
 
 		void mark();
 
-		bool operator > (TimeStamp& ts) { return (mTickTime > ts.mTickTime); }
-		bool operator < (TimeStamp& ts) { return (mTickTime < ts.mTickTime); }
+		inline uint64 value() const { return mTickTime.load(std::memory_order_acquire); }
+
+		bool operator > (TimeStamp& ts) { return (value() > ts.value()); }
+		bool operator < (TimeStamp& ts) { return (value() < ts.value()); }
 
 	private:
-		uint64 mTickTime = 0;
+		//Stamps of a field are read and marked from several threads at the same time
+		std::atomic<uint64> mTickTime{ 0 };
 	};
 
 }
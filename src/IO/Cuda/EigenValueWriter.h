@@ -17,7 +17,7 @@ namespace dyno
 		typedef typename TDataType::Real Real;
 		typedef typename TDataType::Coord Coord;
 		typedef typename TopologyModule::Triangle Triangle;
-		typedef typename Transform<Real, 3> Transform;
+		typedef dyno::Transform<Real, 3> Transform;
 		EigenValueWriter();
 		virtual ~EigenValueWriter();
 
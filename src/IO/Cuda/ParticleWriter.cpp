@@ -1,5 +1,7 @@
 #include "ParticleWriter.h"
 
+#include "Log.h"
+
 #include <sstream>
 #include <iostream>
 #include <fstream>
@@ -25,65 +27,74 @@ namespace dyno
 	void ParticleWriter<TDataType>::output()
 	{
 		std::string filename = this->constructFileName() + std::string(".txt");
-		
+
+		// Take a snapshot on the simulation thread, the file is written in the background
+		std::shared_ptr<CArray<Coord>> hPosition = mStaging.acquire();
+		hPosition->assign(this->inPointSet()->constDataPtr()->getPoints());
+
 		auto fileType = this->varFileType()->getValue();
 		if (fileType == OpenType::ASCII) 
 		{
-			OutputASCII(filename);
+			this->submit([filename, hPosition]() { writeASCIIFile(filename, *hPosition); });
 		}
 		else if (fileType == OpenType::binary)
 		{
-			OutputBinary(filename);
+			this->submit([filename, hPosition]() { writeBinaryFile(filename, *hPosition); });
 		}
 	}
 
 	template<typename TDataType>
-	void ParticleWriter<TDataType>::OutputASCII(std::string filename)
+	void ParticleWriter<TDataType>::writeASCIIFile(const std::string& filename, const CArray<Coord>& points)
 	{
-		std::fstream output;
-		output.open(filename.c_str(), std::ios::out);
-		auto& points = this->inPointSet()->getDataPtr()->getPoints();
-		int ptNum = points.size();
+		std::ofstream output(filename.c_str(), std::ios::out);
 
-		output << ptNum << ' ';
+		if (!output.is_open())
+		{
+			Log::sendMessage(Log::Error, "ParticleWriter: failed to open " + filename);
+			return;
+		}
 
-		CArray<Coord> hPosition;
-		hPosition.resize(ptNum);
+		int ptNum = points.size();
 
-		hPosition.assign(points);
+		output << ptNum << ' ';
 
 		for (int i = 0; i < ptNum; i++) 
 		{
-			output << hPosition[i][0] << ' ' << hPosition[i][1] << ' ' << hPosition[i][2] << ' ';
+			output << points[i][0] << ' ' << points[i][1] << ' ' << points[i][2] << ' ';
 		}
 		output.close();
 	}
 
 	template<typename TDataType>
-	void ParticleWriter<TDataType>::OutputBinary(std::string filename)
+	void ParticleWriter<TDataType>::writeBinaryFile(const std::string& filename, const CArray<Coord>& points)
 	{
-		std::fstream output;
-		output.open(filename.c_str(), std::ios::out | std::ios::binary);
+		std::ofstream output(filename.c_str(), std::ios::out | std::ios::binary);
+
+		if (!output.is_open())
+		{
+			Log::sendMessage(Log::Error, "ParticleWriter: failed to open " + filename);
+			return;
+		}
 
-		auto& points = this->inPointSet()->getDataPtr()->getPoints();
 		int ptNum = points.size();
 
 		output.write((char*)&ptNum, sizeof(int));
 
-		CArray<Coord> hPosition;
-		hPosition.resize(ptNum);
-		hPosition.assign(points);
-
-		for (int i = 0; i < ptNum; i++) 
+		if (sizeof(Coord) == 3 * sizeof(Real))
 		{
-			output.write((char*)&(hPosition[i][0]), sizeof(Real));
-			output.write((char*)&(hPosition[i][1]), sizeof(Real));
-			output.write((char*)&(hPosition[i][2]), sizeof(Real));
+			// Coordinates are tightly packed, write them all at once
+			output.write((const char*)points.begin(), ptNum * sizeof(Coord));
+		}
+		else
+		{
+			for (int i = 0; i < ptNum; i++)
+			{
+				output.write((const char*)&(points[i][0]), sizeof(Real));
+				output.write((const char*)&(points[i][1]), sizeof(Real));
+				output.write((const char*)&(points[i][2]), sizeof(Real));
+			}
 		}
-
 	}
 
-
-
 	DEFINE_CLASS(ParticleWriter);
 }
\ No newline at end of file
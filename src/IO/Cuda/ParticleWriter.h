@@ -23,9 +23,6 @@ namespace dyno
 		ParticleWriter();
 		virtual ~ParticleWriter();
 
-		void OutputASCII(std::string filename);
-		void OutputBinary(std::string filename);
-
 		void output()override;
 	protected:
 
@@ -35,5 +32,9 @@ namespace dyno
 		DEF_ENUM(OpenType, FileType, ASCII, "FileType");
 
 	private:
+		static void writeASCIIFile(const std::string& filename, const CArray<Coord>& points);
+		static void writeBinaryFile(const std::string& filename, const CArray<Coord>& points);
+
+		StagingPool<Coord> mStaging;
 	};
 }
@@ -1,5 +1,6 @@
 #include "TriangleMeshWriter.h"
 #include "Module/OutputModule.h"
+#include "Log.h"
 
 #include <sstream>
 #include <iostream>
@@ -28,12 +29,12 @@ namespace dyno
 
 		if (mode == OutputType::TriangleMesh) 
 		{
-			auto triSet = TypeInfo::cast<TriangleSet<TDataType>>(this->inTopology()->getDataPtr());
+			auto triSet = TypeInfo::cast<TriangleSet<TDataType>>(this->inTopology()->constDataPtr());
 			outputSurfaceMesh(triSet);
 		}
 		else if (mode == OutputType::PointCloud)
 		{
-			auto ptSet = TypeInfo::cast<PointSet<TDataType>>(this->inTopology()->getDataPtr());
+			auto ptSet = TypeInfo::cast<PointSet<TDataType>>(this->inTopology()->constDataPtr());
 			outputPointCloud(ptSet);
 		}
 
@@ -42,85 +43,55 @@ namespace dyno
 	template<typename TDataType>
 	void TriangleMeshWriter<TDataType>::outputSurfaceMesh(std::shared_ptr<TriangleSet<TDataType>> triangleset)
 	{
-		std::string filename = this->constructFileName() + this->file_postfix;;
-		std::ofstream output(filename.c_str(), std::ios::out);
-
-		std::cout << filename << std::endl;
+		std::string filename = this->constructFileName() + this->file_postfix;
 
-		if (!output.is_open()) {
-			printf("------Triangle Mesh Writer: open file failed \n");
-			return;
-		}
+		// Take a snapshot on the simulation thread, the file is written in the background
+		std::shared_ptr<CArray<Coord>> host_vertices = mVertexStaging.acquire();
+		std::shared_ptr<CArray<Triangle>> host_triangles = mTriangleStaging.acquire();
 
-		std::cout << "------Triangle Mesh Writer Action!------ " << std::endl;
+		host_vertices->assign(triangleset->getPoints());
+		host_triangles->assign(triangleset->getTriangles());
 
+		this->submit([filename, host_vertices, host_triangles]() {
+			writeMesh(filename, *host_vertices, *host_triangles);
+		});
+	}
 
-		CArray<Coord> host_vertices;
-		CArray<TopologyModule::Triangle> host_triangles;
-
-
-		if (triangleset->getPoints().size())
-		{
-			host_vertices.assign(triangleset->getPoints());
-		}
-		if (triangleset->getTriangles().size())
-		{
-			host_triangles.assign(triangleset->getTriangles());
-		}
-
-
-		for (uint i = 0; i < host_vertices.size(); ++i) {
-			output << "v " << host_vertices[i][0] << " " << host_vertices[i][1] << " " << host_vertices[i][2] << std::endl;
-		}
-		for (uint i = 0; i < host_triangles.size(); ++i) {
-			output << "f " << host_triangles[i][0] + 1 << " " << host_triangles[i][1] + 1 << " " << host_triangles[i][2] + 1 << std::endl;
-		}
-		output.close();
-
+	template<typename TDataType>
+	void TriangleMeshWriter<TDataType>::outputPointCloud(std::shared_ptr<PointSet<TDataType>> pointset)
+	{
+		std::string filename = this->constructFileName() + this->file_postfix;
 
-		host_vertices.clear();
-		host_triangles.clear();
+		std::shared_ptr<CArray<Coord>> host_vertices = mVertexStaging.acquire();
+		std::shared_ptr<CArray<Triangle>> host_triangles = mTriangleStaging.acquire();
 
+		host_vertices->assign(pointset->getPoints());
+		host_triangles->clear();
 
-		return;
+		this->submit([filename, host_vertices, host_triangles]() {
+			writeMesh(filename, *host_vertices, *host_triangles);
+		});
 	}
 
 	template<typename TDataType>
-	void TriangleMeshWriter<TDataType>::outputPointCloud(std::shared_ptr<PointSet<TDataType>> pointset)
+	void TriangleMeshWriter<TDataType>::writeMesh(const std::string& filename, const CArray<Coord>& vertices, const CArray<Triangle>& triangles)
 	{
-		std::string filename = this->constructFileName() + this->file_postfix;// 
 		std::ofstream output(filename.c_str(), std::ios::out);
 
-		std::cout << filename << std::endl;
-
 		if (!output.is_open()) {
-			printf("------Triangle Mesh Writer: open file failed \n");
+			Log::sendMessage(Log::Error, "TriangleMeshWriter: failed to open " + filename);
 			return;
 		}
 
-		std::cout << "------Pointcloud Writer Action!------ " << std::endl;
-
-		CArray<Coord> host_vertices;
-
-		if (pointset->getPoints().size())
-		{
-			host_vertices.assign(pointset->getPoints());
+		// Use '\n' rather than std::endl, which flushes the stream on every line
+		for (uint i = 0; i < vertices.size(); ++i) {
+			output << "v " << vertices[i][0] << " " << vertices[i][1] << " " << vertices[i][2] << '\n';
 		}
-
-		for (uint i = 0; i < host_vertices.size(); ++i) {
-			output << "v " << host_vertices[i][0] << " " << host_vertices[i][1] << " " << host_vertices[i][2] << std::endl;
+		for (uint i = 0; i < triangles.size(); ++i) {
+			output << "f " << triangles[i][0] + 1 << " " << triangles[i][1] + 1 << " " << triangles[i][2] + 1 << '\n';
 		}
-
 		output.close();
-
-		host_vertices.clear();
-
-
-		return;
 	}
 
-
-
-
 	DEFINE_CLASS(TriangleMeshWriter);
 }
\ No newline at end of file
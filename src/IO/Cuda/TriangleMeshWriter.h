@@ -53,5 +53,11 @@ namespace dyno
 		int count = -1;
 		bool skipFrame = false;
 
+	private:
+		static void writeMesh(const std::string& filename, const CArray<Coord>& vertices, const CArray<Triangle>& triangles);
+
+		StagingPool<Coord> mVertexStaging;
+		StagingPool<Triangle> mTriangleStaging;
+
 	};
 }
\ No newline at end of file
@@ -71,7 +71,7 @@ namespace dyno
 		length[1] *= scale[1];
 		length[2] *= scale[2];
 
-		Quat<Real> q = computeQuaternion();
+		Quat<Real> q = this->computeQuaternion();
 
 		q.normalize();
 
@@ -215,7 +215,7 @@ namespace dyno
 			}
 
 			//Apply transformation
-			Quat<Real> q = computeQuaternion();
+			Quat<Real> q = this->computeQuaternion();
 
 			auto RV = [&](const Coord& v)->Coord {
 				return center + q.rotate(v - center);
@@ -171,7 +171,6 @@ namespace dyno {
 			std::cout << std::endl << Str;
 		}
 
-		template<>
 		void convertVarToStr(std::string VarName, float value, std::string& Str)
 		{
 			Str.append(VarName + " ");
@@ -180,7 +179,6 @@ namespace dyno {
 			std::cout << std::endl << Str;
 		}
 
-		template<>
 		void convertVarToStr(std::string VarName, double value, std::string& Str)
 		{
 			Str.append(VarName + " ");
@@ -168,7 +168,7 @@ namespace dyno
 			//transform
 
 
-			Quat<Real> q = computeQuaternion();
+			Quat<Real> q = this->computeQuaternion();
 
 			q.normalize();
 
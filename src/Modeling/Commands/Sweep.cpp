@@ -232,7 +232,7 @@ namespace dyno
 
 		//Transform
 
-		Quat<Real> q2 = computeQuaternion();
+		Quat<Real> q2 = this->computeQuaternion();
 
 		q2.normalize();
 
@@ -278,13 +278,13 @@ namespace dyno
 	template<typename TDataType>
 	void SweepModel<TDataType>::displayChanged()
 	{
-		auto SurfaceModule = this->graphicsPipeline()->findFirstModule<GLSurfaceVisualModule>();
+		auto SurfaceModule = this->graphicsPipeline()->template findFirstModule<GLSurfaceVisualModule>();
 		SurfaceModule->setVisible(this->varDisplaySurface()->getValue());
 
-		auto wireModule = this->graphicsPipeline()->findFirstModule<GLWireframeVisualModule>();
+		auto wireModule = this->graphicsPipeline()->template findFirstModule<GLWireframeVisualModule>();
 		wireModule->setVisible(this->varDisplayWireframe()->getValue());
 	
-		auto pointModule = this->graphicsPipeline()->findFirstModule<GLPointVisualModule>();
+		auto pointModule = this->graphicsPipeline()->template findFirstModule<GLPointVisualModule>();
 		pointModule->setVisible(this->varDisplayPoints()->getValue());
 	}
 
@@ -0,0 +1,279 @@
+#include "CompiledSkeleton.h"
+
+#include <algorithm>
+
+namespace dyno
+{
+	inline Quat1f CS_Slerp(const Quat1f& q1, const Quat1f& q2, Real t)
+	{
+		double cosTheta = q1.w * q2.w + q1.x * q2.x + q1.y * q2.y + q1.z * q2.z;
+		if (std::abs(cosTheta) >= 1.0)
+			return q1;
+
+		//Take the shorter path
+		Quat1f q = q2;
+		if (cosTheta < 0)
+		{
+			q = Quat1f(-q2.x, -q2.y, -q2.z, -q2.w);
+			cosTheta = -cosTheta;
+		}
+
+		double theta = std::acos(cosTheta);
+		double sinTheta = std::sin(theta);
+		double w1 = std::sin((1 - t) * theta) / sinTheta;
+		double w2 = std::sin(t * theta) / sinTheta;
+
+		Quat1f result(
+			Real(q1.x * w1 + q.x * w2),
+			Real(q1.y * w1 + q.y * w2),
+			Real(q1.z * w1 + q.z * w2),
+			Real(q1.w * w1 + q.w * w2));
+
+		if (result.norm() < 0.001)
+			return Quat1f();
+
+		return result.normalize();
+	}
+
+	inline Vec3f CS_Lerp(const Vec3f& v0, const Vec3f& v1, Real t)
+	{
+		return v0 + (v1 - v0) * t;
+	}
+
+	inline Quat1f CS_Lerp(const Quat1f& q0, const Quat1f& q1, Real t)
+	{
+		return CS_Slerp(q0, q1, t);
+	}
+
+	//Index of the last key not after time, the first key if time lies before all keys
+	inline uint CS_FindKey(const std::vector<Real>& times, uint begin, uint end, Real time)
+	{
+		auto it = std::upper_bound(times.begin() + begin, times.begin() + end, time);
+		return it == times.begin() + begin ? begin : uint(it - times.begin()) - 1;
+	}
+
+	template<typename T>
+	T CS_SampleTime(const std::vector<uint>& offsets, const std::vector<Real>& times, const std::vector<T>& values, uint i, Real time, const T& rest)
+	{
+		uint begin = offsets[i];
+		uint end = offsets[i + 1];
+		if (begin == end)
+			return rest;
+
+		uint k = CS_FindKey(times, begin, end, time);
+		if (k + 1 >= end || time <= times[k])
+			return values[k];
+
+		Real weight = (time - times[k]) / (times[k + 1] - times[k]);
+		return CS_Lerp(values[k], values[k + 1], weight);
+	}
+
+	template<typename T>
+	T CS_SampleFrame(const std::vector<uint>& offsets, const std::vector<T>& values, uint i, int frame, const T& rest)
+	{
+		uint begin = offsets[i];
+		uint end = offsets[i + 1];
+		if (begin == end)
+			return rest;
+
+		int last = int(end - begin) - 1;
+		return values[begin + std::max(0, std::min(frame, last))];
+	}
+
+	void CompiledSkeleton::clear()
+	{
+		mNodes.clear();
+		mParents.clear();
+
+		mRestMatrix.clear();
+		mRestTranslation.clear();
+		mRestScale.clear();
+		mRestRotation.clear();
+		mAnimatedNodes.clear();
+
+		mTranslation.clear();
+		mScale.clear();
+		mRotation.clear();
+
+		mLocal.clear();
+		mWorld.clear();
+	}
+
+	void CompiledSkeleton::setHierarchy(const std::vector<int>& nodes, const std::map<int, std::vector<int>>& paths)
+	{
+		clear();
+
+		//Depth and parent of every node on the paths
+		std::map<int, std::pair<int, int>> depthAndParent;
+		for (auto id : nodes)
+		{
+			auto iter = paths.find(id);
+			if (iter == paths.end())
+			{
+				depthAndParent[id] = std::make_pair(0, -1);
+				continue;
+			}
+
+			const std::vector<int>& path = iter->second;
+			for (size_t k = 0; k < path.size(); k++)
+			{
+				int parent = k + 1 < path.size() ? path[k + 1] : -1;
+				depthAndParent[path[k]] = std::make_pair(int(path.size() - 1 - k), parent);
+			}
+		}
+
+		std::vector<std::pair<int, int>> order;
+		for (auto& it : depthAndParent)
+			order.push_back(std::make_pair(it.second.first, it.first));
+		std::sort(order.begin(), order.end());
+
+		std::map<int, int> position;
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			mNodes.push_back(order[i].second);
+			position[order[i].second] = int(i);
+		}
+
+		mParents.resize(mNodes.size());
+		for (size_t i = 0; i < mNodes.size(); i++)
+		{
+			int parent = depthAndParent[mNodes[i]].second;
+			mParents[i] = parent < 0 ? -1 : position[parent];
+		}
+
+		mRestMatrix.assign(mNodes.size(), Mat4f::identityMatrix());
+		mRestTranslation.assign(mNodes.size(), Vec3f(0));
+		mRestScale.assign(mNodes.size(), Vec3f(1));
+		mRestRotation.assign(mNodes.size(), Quat1f());
+
+		mTranslation.offsets.assign(mNodes.size() + 1, 0);
+		mScale.offsets.assign(mNodes.size() + 1, 0);
+		mRotation.offsets.assign(mNodes.size() + 1, 0);
+
+		mLocal.assign(mNodes.size(), Mat4f::identityMatrix());
+		mWorld.assign(mNodes.size(), Mat4f::identityMatrix());
+	}
+
+	void CompiledSkeleton::setRestPose(
+		const std::map<int, Mat4f>& matrix,
+		const std::map<int, Vec3f>& translation,
+		const std::map<int, Vec3f>& scale,
+		const std::map<int, Quat1f>& rotation,
+		const std::vector<int>& animatedNodes)
+	{
+		mAnimatedNodes.clear();
+		for (size_t i = 0; i < mNodes.size(); i++)
+		{
+			int id = mNodes[i];
+
+			auto iterM = matrix.find(id);
+			mRestMatrix[i] = iterM != matrix.end() ? iterM->second : Mat4f::identityMatrix();
+
+			auto iterT = translation.find(id);
+			if (iterT != translation.end())
+				mRestTranslation[i] = iterT->second;
+
+			auto iterS = scale.find(id);
+			if (iterS != scale.end())
+				mRestScale[i] = iterS->second;
+
+			auto iterR = rotation.find(id);
+			if (iterR != rotation.end())
+				mRestRotation[i] = iterR->second;
+
+			mLocal[i] = mRestMatrix[i];
+
+			if (std::find(animatedNodes.begin(), animatedNodes.end(), id) != animatedNodes.end())
+				mAnimatedNodes.push_back(uint(i));
+		}
+	}
+
+	template<typename T>
+	void CompiledSkeleton::flattenTrack(Track<T>& track, const std::map<int, std::vector<T>>& values, const std::map<int, std::vector<Real>>& times)
+	{
+		track.clear();
+		track.offsets.push_back(0);
+
+		for (size_t i = 0; i < mNodes.size(); i++)
+		{
+			auto iterV = values.find(mNodes[i]);
+			auto iterT = times.find(mNodes[i]);
+			if (iterV != values.end())
+			{
+				const std::vector<T>& v = iterV->second;
+				track.values.insert(track.values.end(), v.begin(), v.end());
+
+				//Keys without times can still be sampled by index
+				for (size_t k = 0; k < v.size(); k++)
+				{
+					bool hasTime = iterT != times.end() && k < iterT->second.size();
+					track.times.push_back(hasTime ? iterT->second[k] : Real(k));
+				}
+			}
+
+			track.offsets.push_back(uint(track.values.size()));
+		}
+	}
+
+	void CompiledSkeleton::setTracks(
+		const std::map<int, std::vector<Vec3f>>& translation,
+		const std::map<int, std::vector<Real>>& translationTime,
+		const std::map<int, std::vector<Vec3f>>& scale,
+		const std::map<int, std::vector<Real>>& scaleTime,
+		const std::map<int, std::vector<Quat1f>>& rotation,
+		const std::map<int, std::vector<Real>>& rotationTime)
+	{
+		flattenTrack(mTranslation, translation, translationTime);
+		flattenTrack(mScale, scale, scaleTime);
+		flattenTrack(mRotation, rotation, rotationTime);
+	}
+
+	void CompiledSkeleton::composeLocalMatrix(uint i, const Vec3f& t, const Vec3f& s, const Quat1f& r)
+	{
+		Mat4f mT = Mat4f(1, 0, 0, t[0], 0, 1, 0, t[1], 0, 0, 1, t[2], 0, 0, 0, 1);
+		Mat4f mS = Mat4f(s[0], 0, 0, 0, 0, s[1], 0, 0, 0, 0, s[2], 0, 0, 0, 0, 1);
+
+		mLocal[i] = mT * mS * r.toMatrix4x4();
+	}
+
+	void CompiledSkeleton::sampleFrame(int frame)
+	{
+		for (auto i : mAnimatedNodes)
+		{
+			composeLocalMatrix(i,
+				CS_SampleFrame(mTranslation.offsets, mTranslation.values, i, frame, mRestTranslation[i]),
+				CS_SampleFrame(mScale.offsets, mScale.values, i, frame, mRestScale[i]),
+				CS_SampleFrame(mRotation.offsets, mRotation.values, i, frame, mRestRotation[i]));
+		}
+	}
+
+	void CompiledSkeleton::sampleTime(Real time)
+	{
+		for (auto i : mAnimatedNodes)
+		{
+			composeLocalMatrix(i,
+				CS_SampleTime(mTranslation.offsets, mTranslation.times, mTranslation.values, i, time, mRestTranslation[i]),
+				CS_SampleTime(mScale.offsets, mScale.times, mScale.values, i, time, mRestScale[i]),
+				CS_SampleTime(mRotation.offsets, mRotation.times, mRotation.values, i, time, mRestRotation[i]));
+		}
+	}
+
+	void CompiledSkeleton::updateWorldMatrices()
+	{
+		for (size_t i = 0; i < mNodes.size(); i++)
+		{
+			int parent = mParents[i];
+			mWorld[i] = parent < 0 ? mLocal[i] : mWorld[parent] * mLocal[i];
+		}
+	}
+
+	void CompiledSkeleton::getWorldMatrices(std::vector<Mat4f>& matrices) const
+	{
+		for (size_t i = 0; i < mNodes.size(); i++)
+		{
+			int id = mNodes[i];
+			if (id >= 0 && id < (int)matrices.size())
+				matrices[id] = mWorld[i];
+		}
+	}
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <map>
+#include <vector>
+
+#include "Vector.h"
+#include "Matrix.h"
+#include "Quat.h"
+
+namespace dyno
+{
+	/**
+	 * @brief A flattened skeleton for posing, built once from the node hierarchy and the keyframes of a glTF file.
+	 *
+	 *	Nodes are stored parent before child, so all world matrices are computed in one linear pass.
+	 *	The keyframes of each channel are stored as one array of times and one array of values for all nodes,
+	 *	the keys of node i lie in [offsets[i], offsets[i + 1]).
+	 */
+	class CompiledSkeleton
+	{
+	public:
+		CompiledSkeleton() {};
+		~CompiledSkeleton() { clear(); };
+
+		void clear();
+
+		bool isEmpty() const { return mNodes.empty(); }
+
+		uint nodeNumber() const { return (uint)mNodes.size(); }
+
+		/**
+		 * @brief Set up the hierarchy from the path of each node, paths are ordered from the node itself up to its root
+		 */
+		void setHierarchy(const std::vector<int>& nodes, const std::map<int, std::vector<int>>& paths);
+
+		/**
+		 * @brief Set the rest pose, animated nodes use T * S * R of their tracks or their rest components, other nodes keep their rest matrix
+		 */
+		void setRestPose(
+			const std::map<int, Mat4f>& matrix,
+			const std::map<int, Vec3f>& translation,
+			const std::map<int, Vec3f>& scale,
+			const std::map<int, Quat1f>& rotation,
+			const std::vector<int>& animatedNodes);
+
+		void setTracks(
+			const std::map<int, std::vector<Vec3f>>& translation,
+			const std::map<int, std::vector<Real>>& translationTime,
+			const std::map<int, std::vector<Vec3f>>& scale,
+			const std::map<int, std::vector<Real>>& scaleTime,
+			const std::map<int, std::vector<Quat1f>>& rotation,
+			const std::map<int, std::vector<Real>>& rotationTime);
+
+		/**
+		 * @brief Pose the animated nodes with the key of the given index, clamped to the length of each track
+		 */
+		void sampleFrame(int frame);
+
+		/**
+		 * @brief Pose the animated nodes at the given time, keys are found by binary search and interpolated
+		 */
+		void sampleTime(Real time);
+
+		/**
+		 * @brief Compute the world matrices from the local matrices of the last sampled pose
+		 */
+		void updateWorldMatrices();
+
+		/**
+		 * @brief Write the world matrices into an array indexed by node id, entries of other ids are left untouched
+		 */
+		void getWorldMatrices(std::vector<Mat4f>& matrices) const;
+
+	private:
+		template<typename T>
+		struct Track
+		{
+			std::vector<uint> offsets;
+			std::vector<Real> times;
+			std::vector<T> values;
+
+			void clear() { offsets.clear(); times.clear(); values.clear(); }
+		};
+
+		template<typename T>
+		void flattenTrack(Track<T>& track, const std::map<int, std::vector<T>>& values, const std::map<int, std::vector<Real>>& times);
+
+		void composeLocalMatrix(uint i, const Vec3f& t, const Vec3f& s, const Quat1f& r);
+
+		//Node ids in parent-before-child order and the position of each parent in the same order, -1 for roots
+		std::vector<int> mNodes;
+		std::vector<int> mParents;
+
+		std::vector<Mat4f> mRestMatrix;
+		std::vector<Vec3f> mRestTranslation;
+		std::vector<Vec3f> mRestScale;
+		std::vector<Quat1f> mRestRotation;
+
+		//Positions of the animated nodes, the local matrices of the others never change
+		std::vector<uint> mAnimatedNodes;
+
+		Track<Vec3f> mTranslation;
+		Track<Vec3f> mScale;
+		Track<Quat1f> mRotation;
+
+		std::vector<Mat4f> mLocal;
+		std::vector<Mat4f> mWorld;
+	};
+}
@@ -879,4 +879,178 @@ namespace dyno
 		Vec2u range
 		);
 
+
+	//Entries of SkinInfo::batch_vertexBind that are not binding indices
+	enum SkinBind
+	{
+		SB_Unbound = -1,	//The vertex lies in a skin range but has no binding in this set
+		SB_Uncovered = -2	//The vertex lies outside of all skin ranges
+	};
+
+	__global__ void SkinMatrices(
+		DArray<Mat4f> skinMatrix,
+		DArray<Mat4f> transformedSkinMatrix,
+		DArray<Mat4f> joint_inverseBindMatrix,
+		DArray<Mat4f> WorldMatrix,
+		Mat4f transform
+	)
+	{
+		int jId = threadIdx.x + (blockIdx.x * blockDim.x);
+		if (jId >= skinMatrix.size()) return;
+
+		Mat4f m = WorldMatrix[jId] * joint_inverseBindMatrix[jId];
+
+		skinMatrix[jId] = m;
+		transformedSkinMatrix[jId] = transform * m;
+	}
+
+	__global__ void SkinVertices(
+		DArray<Vec3f> worldPosition,
+		DArray<Vec3f> worldNormal,
+		DArray<Vec3f> initialPosition,
+		DArray<Vec3f> initialNormal,
+		DArray<Vec2i> vertexBind,
+		DArray<Vec4f> bind_joints_0,
+		DArray<Vec4f> bind_joints_1,
+		DArray<Vec4f> weights_0,
+		DArray<Vec4f> weights_1,
+		DArray<Mat4f> skinMatrix,
+		DArray<Mat4f> transformedSkinMatrix
+	)
+	{
+		int pId = threadIdx.x + (blockIdx.x * blockDim.x);
+		if (pId >= vertexBind.size()) return;
+
+		Vec2i bind = vertexBind[pId];
+		if (bind[0] == SB_Uncovered)
+			return;
+
+		//PointsAnimation keeps the position of a vertex without bindings, but still normalizes its normal
+		if (bind[0] < 0 && bind[1] < 0)
+		{
+			if (pId < worldNormal.size())
+				worldNormal[pId] = worldNormal[pId].normalize();
+			return;
+		}
+
+		//As in PointsAnimation, the model transform only applies to the influences of JOINTS_0
+		Mat4f m(0);
+		if (bind[0] >= 0)
+		{
+			for (unsigned int i = 0; i < 4; i++)
+				m += transformedSkinMatrix[int(bind_joints_0[bind[0]][i])] * weights_0[bind[0]][i];
+		}
+		if (bind[1] >= 0)
+		{
+			for (unsigned int i = 0; i < 4; i++)
+				m += skinMatrix[int(bind_joints_1[bind[1]][i])] * weights_1[bind[1]][i];
+		}
+
+		Vec3f p = initialPosition[pId];
+		Vec4f wp = m * Vec4f(p[0], p[1], p[2], 1);
+		worldPosition[pId] = Vec3f(wp[0], wp[1], wp[2]);
+
+		if (pId < worldNormal.size() && pId < initialNormal.size())
+		{
+			Vec3f n = initialNormal[pId];
+			Vec4f wn = m * Vec4f(n[0], n[1], n[2], 0);
+			worldNormal[pId] = Vec3f(wn[0], wn[1], wn[2]).normalize();
+		}
+	}
+
+	void buildSkinBatch(SkinInfo& skin, uint vertexNum)
+	{
+		std::vector<Vec4f> joints0, joints1, weights0, weights1;
+		std::vector<Vec2i> vertexBind(vertexNum, Vec2i(SB_Uncovered, SB_Uncovered));
+
+		CArray<Vec4f> hJoints;
+		CArray<Vec4f> hWeights;
+		for (int i = 0; i < skin.size(); i++)
+		{
+			int offset0 = joints0.size();
+			int offset1 = joints1.size();
+
+			hJoints.assign(skin.V_jointID_0[i]);
+			hWeights.assign(skin.V_jointWeight_0[i]);
+			int num0 = std::min(hJoints.size(), hWeights.size());
+			joints0.insert(joints0.end(), hJoints.begin(), hJoints.begin() + num0);
+			weights0.insert(weights0.end(), hWeights.begin(), hWeights.begin() + num0);
+
+			hJoints.assign(skin.V_jointID_1[i]);
+			hWeights.assign(skin.V_jointWeight_1[i]);
+			int num1 = std::min(hJoints.size(), hWeights.size());
+			joints1.insert(joints1.end(), hJoints.begin(), hJoints.begin() + num1);
+			weights1.insert(weights1.end(), hWeights.begin(), hWeights.begin() + num1);
+
+			auto iter = skin.skin_VerticeRange.find(i);
+			if (iter == skin.skin_VerticeRange.end())
+				continue;
+
+			//Ranges are inclusive, the bindings of a skin are indexed from the start of each range
+			for (auto range : iter->second)
+			{
+				for (uint v = range[0]; v <= range[1] && v < vertexNum; v++)
+				{
+					int local = v - range[0];
+					vertexBind[v] = Vec2i(local < num0 ? offset0 + local : SB_Unbound, local < num1 ? offset1 + local : SB_Unbound);
+				}
+			}
+		}
+
+		skin.batch_jointID_0.assign(joints0);
+		skin.batch_jointID_1.assign(joints1);
+		skin.batch_jointWeight_0.assign(weights0);
+		skin.batch_jointWeight_1.assign(weights1);
+		skin.batch_vertexBind.assign(vertexBind);
+
+		skin.batchDirty = false;
+
+		hJoints.clear();
+		hWeights.clear();
+	}
+
+	void skinMeshAnimation(
+		SkinInfo& skin,
+		DArray<Vec3f>& initialPosition,
+		DArray<Vec3f>& initialNormal,
+		DArray<Vec3f>& worldPosition,
+		DArray<Vec3f>& worldNormal,
+		DArray<Mat4f>& joint_inverseBindMatrix,
+		DArray<Mat4f>& WorldMatrix,
+		Mat4f transform
+	)
+	{
+		uint vertexNum = std::min(initialPosition.size(), worldPosition.size());
+		if (skin.batchDirty || skin.batch_vertexBind.size() != vertexNum)
+			buildSkinBatch(skin, vertexNum);
+
+		uint jointNum = std::min(joint_inverseBindMatrix.size(), WorldMatrix.size());
+		skin.batch_skinMatrix.resize(jointNum);
+		skin.batch_transformedSkinMatrix.resize(jointNum);
+
+		cuExecute(jointNum,
+			SkinMatrices,
+			skin.batch_skinMatrix,
+			skin.batch_transformedSkinMatrix,
+			joint_inverseBindMatrix,
+			WorldMatrix,
+			transform
+		);
+
+		cuExecute(vertexNum,
+			SkinVertices,
+			worldPosition,
+			worldNormal,
+			initialPosition,
+			initialNormal,
+			skin.batch_vertexBind,
+			skin.batch_jointID_0,
+			skin.batch_jointID_1,
+			skin.batch_jointWeight_0,
+			skin.batch_jointWeight_1,
+			skin.batch_skinMatrix,
+			skin.batch_transformedSkinMatrix
+		);
+	}
+
 }
@@ -8,6 +8,7 @@
 #include "Topology/TextureMesh.h"
 #include "tinygltf/tiny_gltf.h"
 #include "FilePath.h"
+#include "SkinInfo.h"
 
 #define NULL_TIME (-9599.99)
 
@@ -129,6 +130,20 @@ namespace dyno
 		Vec2u range
 	);
 
-
+	/**
+	 * @brief Skin the positions and normals of all skins in one pass, equivalent to calling skinAnimation() for every range of every skin
+	 *
+	 *	The concatenated bindings in skin are rebuilt when skin.batchDirty is set or the number of vertices changes.
+	 */
+	void skinMeshAnimation(
+		SkinInfo& skin,
+		DArray<Vec3f>& initialPosition,
+		DArray<Vec3f>& initialNormal,
+		DArray<Vec3f>& worldPosition,
+		DArray<Vec3f>& worldNormal,
+		DArray<Mat4f>& joint_inverseBindMatrix,
+		DArray<Mat4f>& WorldMatrix,
+		Mat4f transform
+	);
 
 }
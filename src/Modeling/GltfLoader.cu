@@ -690,10 +690,28 @@ namespace dyno
 
 		auto mesh = this->stateTextureMesh()->getDataPtr();
 
-		this->updateAnimationMatrix(all_Joints, frameNumber);
-		this->updateJointWorldMatrix(all_Joints, joint_AnimaMatrix);
+		if (mSkeleton.isEmpty())
+		{
+			std::vector<int> animatedJoints;
+			for (auto it : joint_input)
+				animatedJoints.push_back(it.first);
+
+			mSkeleton.setHierarchy(all_Joints, jointId_joint_Dir);
+			mSkeleton.setRestPose(joint_matrix, joint_translation, joint_scale, joint_rotation, animatedJoints);
+			mSkeleton.setTracks(joint_T_f_anim, joint_T_Time, joint_S_f_anim, joint_S_Time, joint_R_f_anim, joint_R_Time);
+		}
 
+		if (this->varInterpolateAnimation()->getValue())
+			mSkeleton.sampleTime(this->stateElapsedTime()->getValue());
+		else
+			mSkeleton.sampleFrame(frameNumber);
 
+		mSkeleton.updateWorldMatrices();
+
+		mJointWorld.assign(maxJointId + 1, Mat4f());
+		mSkeleton.getWorldMatrices(mJointWorld);
+
+		this->stateJointWorldMatrix()->assign(mJointWorld);
 
 		//update Joints
 		cuExecute(all_Joints.size(),
@@ -710,153 +728,18 @@ namespace dyno
 		auto& skinInfo = this->stateSkin()->getData();
 
 
-		for (size_t i = 0; i < skinInfo.size(); i++)//
-		{
-			auto& bindJoint0 = skinInfo.V_jointID_0[i];
-			auto& bindJoint1 = skinInfo.V_jointID_1[i];
-
-			auto& bindWeight0 = skinInfo.V_jointWeight_0[i];
-			auto& bindWeight1 = skinInfo.V_jointWeight_1[i];
-
-			for (size_t j = 0; j < skin_VerticeRange[i].size(); j++)
-			{
-				//
-				Vec2u& range = skinInfo.skin_VerticeRange[i][j];
-
-				skinAnimation(initialPosition,
-					mesh->vertices(),
-					this->stateJointInverseBindMatrix()->getData(),
-					this->stateJointWorldMatrix()->getData(),
-
-					bindJoint0,
-					bindJoint1,
-					bindWeight0,
-					bindWeight1,
-					this->stateTransform()->getValue(),
-					false,
-					range
-				);
-
-				//update Normals
-
-				skinAnimation(
-					initialNormal,
-					mesh->normals(),
-					this->stateJointInverseBindMatrix()->getData(),
-					this->stateJointWorldMatrix()->getData(),
-
-					bindJoint0,
-					bindJoint1,
-					bindWeight0,
-					bindWeight1,
-					this->stateTransform()->getValue(),
-					true,
-					range
-				);
-
-			}
-		}
-		
-
+		skinMeshAnimation(skinInfo,
+			initialPosition,
+			initialNormal,
+			mesh->vertices(),
+			mesh->normals(),
+			this->stateJointInverseBindMatrix()->getData(),
+			this->stateJointWorldMatrix()->getData(),
+			this->stateTransform()->getValue()
+		);
 	};
 
 
-	template<typename TDataType>
-	void GltfLoader<TDataType>::updateAnimationMatrix(const std::vector<joint>& all_Joints, int currentframe)
-	{
-		joint_AnimaMatrix = joint_matrix;
-
-		for (auto jId : all_Joints)
-		{
-			const std::vector<int>& jD = getJointDirByJointIndex(jId,jointId_joint_Dir);
-
-			Mat4f tempMatrix = Mat4f::identityMatrix();
-
-			//
-			for (int k = jD.size() - 1; k >= 0; k--)
-			{
-
-				joint select = jD[k];
-
-				Vec3f tempVT = Vec3f(0, 0, 0);
-				Vec3f tempVS = Vec3f(1, 1, 1);
-				Quat<float> tempQR = Quat<float>(Mat3f::identityMatrix());
-
-				//replace 
-
-				if (joint_input.find(select) != joint_input.end())		//ֻ
-				{
-					auto iterR = joint_R_f_anim.find(select);
-					//auto iterR_inPut = joint_input.find(select);		//
-
-					int tempFrame = 0;
-
-					if (iterR != joint_R_f_anim.end())
-					{
-
-						if (currentframe > iterR->second.size() - 1)
-							tempFrame = iterR->second.size() - 1;
-						else if (currentframe < 0)
-							tempFrame = 0;
-						else
-							tempFrame = currentframe;
-
-						tempQR = iterR->second[tempFrame];
-					}
-					else
-					{
-						tempQR = joint_rotation[select];
-					}
-
-					std::map<joint, std::vector<Vec3f>>::const_iterator iterT;
-					iterT = joint_T_f_anim.find(select);
-					if (iterT != joint_T_f_anim.end())
-					{
-						//
-						if (currentframe > iterT->second.size() - 1)
-							tempFrame = iterT->second.size() - 1;
-						else if (currentframe < 0)
-							tempFrame = 0;
-						else
-							tempFrame = currentframe;
-
-						tempVT = iterT->second[tempFrame];
-					}
-					else
-					{
-						tempVT = joint_translation[select];
-					}
-
-					std::map<joint, std::vector<Vec3f>>::const_iterator iterS;
-					iterS = joint_S_f_anim.find(select);
-					if (iterS != joint_S_f_anim.end())
-					{
-						//
-						if (currentframe > iterS->second.size() - 1)
-							tempFrame = iterS->second.size() - 1;
-						else if (currentframe < 0)
-							tempFrame = 0;
-						else
-							tempFrame = currentframe;
-
-						tempVS = iterS->second[tempFrame];
-					}
-					else
-					{
-						tempVS = joint_scale[select];
-					}
-
-					Mat4f mT = Mat4f(1, 0, 0, tempVT[0], 0, 1, 0, tempVT[1], 0, 0, 1, tempVT[2], 0, 0, 0, 1);
-					Mat4f mS = Mat4f(tempVS[0], 0, 0, 0, 0, tempVS[1], 0, 0, 0, 0, tempVS[2], 0, 0, 0, 0, 1);
-					Mat4f mR = tempQR.toMatrix4x4();
-
-					joint_AnimaMatrix[select] = mT * mS * mR;	//
-				}
-				//
-			}
-		}
-	}
-
 	template<typename TDataType>
 	Vec3f GltfLoader<TDataType>::getVertexLocationWithJointTransform(joint jointId, Vec3f inPoint, std::map<joint, Mat4f> jMatrix)
 	{
@@ -881,40 +764,6 @@ namespace dyno
 		return result;
 	};
 
-	template<typename TDataType>
-	void GltfLoader<TDataType>::updateJointWorldMatrix(const std::vector<joint>& allJoints, std::map<joint, Mat4f> jMatrix)
-	{
-		std::vector<Mat4f> c_joint_Mat4f;
-
-		this->stateJointWorldMatrix()->resize(allJoints.size());
-		c_joint_Mat4f.resize(maxJointId + 1);
-
-
-		for (size_t i = 0; i < allJoints.size(); i++)
-		{
-			joint jointId = allJoints[i];
-			const std::vector<int>& jD = getJointDirByJointIndex(jointId, jointId_joint_Dir);
-
-
-
-			Mat4f tempMatrix = Mat4f::identityMatrix();
-
-			//
-			for (int k = jD.size() - 1; k >= 0; k--)
-			{
-				joint select = jD[k];
-				tempMatrix *= jMatrix[select];		//
-			}
-			c_joint_Mat4f[jointId] = tempMatrix;
-
-		}
-
-
-
-		this->stateJointWorldMatrix()->assign(c_joint_Mat4f);
-
-	};
-
 	template<typename TDataType>
 	void GltfLoader<TDataType>::buildInverseBindMatrices(const std::vector<joint>& all_Joints)
 	{
@@ -1002,7 +851,7 @@ namespace dyno
 		Vec3f scale = this->varScale()->getValue();
 		Mat4f mT = Mat4f(1, 0, 0, location[0], 0, 1, 0, location[1], 0, 0, 1, location[2], 0, 0, 0, 1);
 		Mat4f mS = Mat4f(scale[0], 0, 0, 0, 0, scale[1], 0, 0, 0, 0, scale[2], 0, 0, 0, 0, 1);
-		Mat4f mR = computeQuaternion().toMatrix4x4();
+		Mat4f mR = this->computeQuaternion().toMatrix4x4();
 		Mat4f transform = mT * mS * mR;
 
 		this->stateTransform()->setValue(transform);
@@ -1323,7 +1172,7 @@ namespace dyno
 		joint_output.clear();
 		joint_input.clear();
 		joint_inverseBindMatrix.clear();
-		joint_AnimaMatrix.clear();
+		mSkeleton.clear();
 		Scene_Name.clear();
 		all_Joints.clear();
 
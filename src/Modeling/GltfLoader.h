@@ -27,6 +27,7 @@
 #include "FilePath.h"
 #include "SkinInfo.h"
 #include "JointInfo.h"
+#include "CompiledSkeleton.h"
 
 
 namespace dyno
@@ -89,6 +90,7 @@ namespace dyno
 
 		DEF_VAR(FilePath, FileName, "", "");
 		DEF_VAR(bool, ImportAnimation, false, "");
+		DEF_VAR(bool, InterpolateAnimation, false, "Sample the animation at the elapsed time with interpolated keys instead of one key per frame");
 		DEF_VAR(Real, JointRadius, 0.01, "");
 
 		DEF_VAR(bool, UseInstanceTransform, true, "");
@@ -155,7 +157,9 @@ namespace dyno
 		std::map<joint, std::vector<Real>> joint_R_Time;
 
 		std::map<joint, Mat4f> joint_inverseBindMatrix;
-		std::map<joint, Mat4f> joint_AnimaMatrix;
+		//Flattened hierarchy and keyframes, built on the first update of the animation
+		CompiledSkeleton mSkeleton;
+		std::vector<Mat4f> mJointWorld;
 
 		std::vector<std::string> Scene_Name;
 		std::map<joint, std::string> joint_Name;
@@ -203,12 +207,8 @@ namespace dyno
 
 
 
-		void updateAnimationMatrix(const std::vector<joint>& all_Joints, int currentframe);
-
 		Vec3f getVertexLocationWithJointTransform(joint jointId, Vec3f inPoint, std::map<joint, Mat4f> jMatrix);
 
-		void updateJointWorldMatrix(const std::vector<joint>& allJoints, std::map<joint, Mat4f> jMatrix);
-
 		void buildInverseBindMatrices(const std::vector<joint>& all_Joints);
 		
 		Vec3f getmeshPointDeformByJoint(joint jointId, Coord worldPosition, std::map<joint, Mat4f> jMatrix);
@@ -107,54 +107,15 @@ namespace dyno
 			auto textureMesh = this->stateTextureMesh()->getDataPtr();
 
 
-			for (size_t i = 0; i < skinInfo.size(); i++)//
-			{
-				auto& bindJoint0 = skinInfo.V_jointID_0[i];
-				auto& bindJoint1 = skinInfo.V_jointID_1[i];
-
-				auto& bindWeight0 = skinInfo.V_jointWeight_0[i];
-				auto& bindWeight1 = skinInfo.V_jointWeight_1[i];
-
-				for (size_t j = 0; j < skinInfo.skin_VerticeRange[i].size(); j++)
-				{
-					//
-					Vec2u& range = skinInfo.skin_VerticeRange[i][j];
-
-					skinAnimation(skinInfo.initialPosition,
-						textureMesh->vertices(),
-						jointInfo.mJointInverseBindMatrix,
-						jointInfo.mJointWorldMatrix,
-
-						bindJoint0,
-						bindJoint1,
-						bindWeight0,
-						bindWeight1,
-						Mat4f::identityMatrix(),
-						false,
-						range
-					);
-
-					//update Normals
-
-					skinAnimation(
-						skinInfo.initialNormal,
-						textureMesh->normals(),
-						jointInfo.mJointInverseBindMatrix,
-						jointInfo.mJointWorldMatrix,
-
-						bindJoint0,
-						bindJoint1,
-						bindWeight0,
-						bindWeight1,
-						Mat4f::identityMatrix(),
-						true,
-						range
-					);
-
-				}
-			}
-
-
+			skinMeshAnimation(skinInfo,
+				skinInfo.initialPosition,
+				skinInfo.initialNormal,
+				textureMesh->vertices(),
+				textureMesh->normals(),
+				jointInfo.mJointInverseBindMatrix,
+				jointInfo.mJointWorldMatrix,
+				Mat4f::identityMatrix()
+			);
 		}
 	}
 
@@ -37,6 +37,8 @@ namespace dyno {
 				it.second.clear();
 			}
 			skin_VerticeRange.clear();
+
+			clearBatch();
 		};
 
 		void pushBack_Data(const std::vector<Vec4f>& Weight_0,
@@ -56,6 +58,8 @@ namespace dyno {
 			this->V_jointWeight_1[skinNum - 1].assign(Weight_1);
 			this->V_jointID_0[skinNum - 1].assign(ID_0);
 			this->V_jointID_1[skinNum - 1].assign(ID_1);					
+
+			batchDirty = true;
 		}
 
 		void clearSkinInfo() 
@@ -80,6 +84,21 @@ namespace dyno {
 				it.second.clear();
 			}
 			skin_VerticeRange.clear();
+
+			clearBatch();
+		}
+
+		void clearBatch()
+		{
+			batch_jointID_0.clear();
+			batch_jointID_1.clear();
+			batch_jointWeight_0.clear();
+			batch_jointWeight_1.clear();
+			batch_vertexBind.clear();
+			batch_skinMatrix.clear();
+			batch_transformedSkinMatrix.clear();
+
+			batchDirty = true;
 		}
 
 		int size() { return skinNum; };
@@ -106,6 +125,22 @@ namespace dyno {
 
 		DArray<Vec3f> initialNormal;
 
+		//Bindings of all skins concatenated for skinning the whole mesh in one pass, see skinMeshAnimation()
+		DArray<Vec4f> batch_jointID_0;
+		DArray<Vec4f> batch_jointID_1;
+		DArray<Vec4f> batch_jointWeight_0;
+		DArray<Vec4f> batch_jointWeight_1;
+
+		//Index of each vertex into the concatenated bindings of JOINTS_0 and JOINTS_1, -1 if not bound, -2 if the vertex is outside of all skin ranges
+		DArray<Vec2i> batch_vertexBind;
+
+		//World matrix times inverse bind matrix of each joint, with and without the model transform
+		DArray<Mat4f> batch_skinMatrix;
+		DArray<Mat4f> batch_transformedSkinMatrix;
+
+		//Set when the skins change, skin_VerticeRange has to be complete before the next skinning or clearBatch() must be called
+		bool batchDirty = true;
+
 
 	private:
 
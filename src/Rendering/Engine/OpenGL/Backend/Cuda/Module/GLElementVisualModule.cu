@@ -72,6 +72,9 @@ namespace dyno
 	GLElementVisualModule::GLElementVisualModule()
 	{
 		this->setName("element_renderer");
+
+		this->addStagingObject(&mVertexBuffer);
+		this->addStagingObject(&mIndexBuffer);
 	}
 
 	bool GLElementVisualModule::initializeGL()
@@ -241,12 +244,12 @@ namespace dyno
 
 	void GLElementVisualModule::updateGL()
 	{
-		mDrawCount = triangles.size() * 3;
+		mDrawCount = mIndexBuffer.count() * 3;
 
 		if (mDrawCount > 0)
 		{
-			mVertexBuffer.load(vertices);
-			mIndexBuffer.load(triangles);
+			mVertexBuffer.updateGL();
+			mIndexBuffer.updateGL();
 		}
 	}
 
@@ -334,18 +337,18 @@ namespace dyno
 				centre_sphere
 				);
 			cuSynchronize();*/
-			uint pDims = cudaGridSize(num_triangle, BLOCK_SIZE);
-			Mix_Setup_Mapping << <pDims, BLOCK_SIZE >> > (
+			cuExecute(num_triangle,
+				Mix_Setup_Mapping,
 				mapping,
 				mapping_shape,
 				attr,
 				num_box,
 				num_sphere,
 				num_tet,
-				100
-				);
-			cuSynchronize();
-			Mix_SetupTriangles << <pDims, BLOCK_SIZE >> > (
+				100);
+
+			cuExecute(num_triangle,
+				Mix_SetupTriangles,
 				vertices,
 				triangles,
 				centre_box,
@@ -361,15 +364,16 @@ namespace dyno
 				mapping,
 				mapping_shape,
 				attr,
-				Coord3D(0)
-				);
-			cuSynchronize();
+				Coord3D(0));
 
 			/*m_triangleRender->setVertexArray(vertices);
 			m_triangleRender->setColorArray(colors);
 			m_triangleRender->setNormalArray(normals);
 			have_triangles = true;*/
 		}
+
+		mVertexBuffer.load(vertices);
+		mIndexBuffer.load(triangles);
 	}
 
 	void GLElementVisualModule::paintGL(const RenderParams& rparams)
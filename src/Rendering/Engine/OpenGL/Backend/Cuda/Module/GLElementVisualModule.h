@@ -46,7 +46,7 @@ namespace dyno
 		VertexArray	mVAO;
 
 		XBuffer<Vec3f>	mVertexBuffer;
-		XBuffer<Vec3i> 	mIndexBuffer;
+		XBuffer<TopologyModule::Triangle> 	mIndexBuffer;
 
 		unsigned int	mDrawCount = 0;
 
@@ -11,6 +11,9 @@ namespace dyno {
 		this->setName("instance_renderer");
 		this->inInstanceColor()->tagOptional(true);
 		this->inInstanceTransform()->tagOptional(false);
+
+		this->addStagingObject(&mInstanceTransforms);
+		this->addStagingObject(&mInstanceColors);
 	}
 
 	GLInstanceVisualModule::~GLInstanceVisualModule()
@@ -14,6 +14,9 @@ namespace dyno
 	GLPhotorealisticInstanceRender::GLPhotorealisticInstanceRender()
 		: GLPhotorealisticRender()
 	{
+		this->addStagingObject(&mOffset);
+		this->addStagingObject(&mLists);
+		this->addStagingObject(&mXTransformBuffer);
 	}
 
 	GLPhotorealisticInstanceRender::~GLPhotorealisticInstanceRender()
@@ -55,8 +58,8 @@ namespace dyno
 		{
 			auto texMesh = this->inTextureMesh()->constDataPtr();
 
-			mOffset.assign(inst->index());
-			mLists.assign(inst->lists());
+			mOffset.back().assign(inst->index());
+			mLists.back().assign(inst->lists());
 
 			mXTransformBuffer.load(inst->elements());
 		}
@@ -77,6 +80,9 @@ namespace dyno
 		auto& normals = mTextureMesh.normals();
 		auto& texCoords = mTextureMesh.texCoords();
 
+		auto& offsets = mOffset.front();
+		auto& lists = mLists.front();
+
 		mShaderProgram->use();
 
 		// setup uniforms
@@ -177,9 +183,9 @@ namespace dyno
 				}
 
 			}
-			if (mOffset.size() >= shapes.size())
+			if (offsets.size() >= shapes.size())
 			{
-				uint offset_i = sizeof(Transform3f) * mOffset[i];
+				uint offset_i = sizeof(Transform3f) * offsets[i];
 				mVAO.bindVertexBuffer(&mXTransformBuffer, 3, 3, GL_FLOAT, sizeof(Transform3f), offset_i + 0, 1);
 				// bind the scale vector
 				mVAO.bindVertexBuffer(&mXTransformBuffer, 4, 3, GL_FLOAT, sizeof(Transform3f), offset_i + sizeof(Vec3f), 1);
@@ -188,7 +194,7 @@ namespace dyno
 				mVAO.bindVertexBuffer(&mXTransformBuffer, 6, 3, GL_FLOAT, sizeof(Transform3f), offset_i + 3 * sizeof(Vec3f), 1);
 				mVAO.bindVertexBuffer(&mXTransformBuffer, 7, 3, GL_FLOAT, sizeof(Transform3f), offset_i + 4 * sizeof(Vec3f), 1);
 				mVAO.bind();
-				glDrawArraysInstanced(GL_TRIANGLES, 0, numTriangles * 3, mLists[i].size());
+				glDrawArraysInstanced(GL_TRIANGLES, 0, numTriangles * 3, lists[i].size());
 
 			}
 			else 
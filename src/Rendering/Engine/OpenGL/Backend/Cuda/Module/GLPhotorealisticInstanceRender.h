@@ -40,8 +40,9 @@ namespace dyno
 		void releaseGL() override;
 
 	private:
-		CArray<uint> mOffset;
-		CArray<List<Transform3f>> mLists;
+		// read by paintGL, staged like the buffers
+		TripleBuffer<CArray<uint>> mOffset;
+		TripleBuffer<CArray<List<Transform3f>>> mLists;
 
 		XBuffer<Transform3f> mXTransformBuffer;
 
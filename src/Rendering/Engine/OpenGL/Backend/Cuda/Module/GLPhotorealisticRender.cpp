@@ -69,10 +69,15 @@ namespace dyno
 					}
 				}));
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		mTangentSpaceConstructor = std::make_shared<ConstructTangentSpace>();
 		this->inTextureMesh()->connect(mTangentSpaceConstructor->inTextureMesh());
 #endif
+
+		this->addStagingObject(&mTangent);
+		this->addStagingObject(&mBitangent);
+		this->addStagingObject(&mShapeTransform);
+		this->addStagingObject(&mTextureMesh);
 	}
 
 	GLPhotorealisticRender::~GLPhotorealisticRender()
@@ -97,7 +102,7 @@ namespace dyno
 		mRenderParamsUBlock.create(GL_UNIFORM_BUFFER, GL_DYNAMIC_DRAW);
 		mPBRMaterialUBlock.create(GL_UNIFORM_BUFFER, GL_DYNAMIC_DRAW);
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		mTangent.create(GL_SHADER_STORAGE_BUFFER, GL_DYNAMIC_DRAW);
 		mBitangent.create(GL_SHADER_STORAGE_BUFFER, GL_DYNAMIC_DRAW);
 #endif
@@ -140,11 +145,12 @@ namespace dyno
 	void GLPhotorealisticRender::updateImpl()
 	{
 		if (this->inTextureMesh()->isModified()) {
-			mTextureMesh.load(this->inTextureMesh()->constDataPtr());
-			this->varMaterialIndex()->setRange(0, mTextureMesh.materials().size() - 1);
+			auto mesh = this->inTextureMesh()->constDataPtr();
+			mTextureMesh.load(mesh);
+			this->varMaterialIndex()->setRange(0, mesh->materials().size() - 1);
 		}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		mTangentSpaceConstructor->update();
 
 		if (!mTangentSpaceConstructor->outTangent()->isEmpty())
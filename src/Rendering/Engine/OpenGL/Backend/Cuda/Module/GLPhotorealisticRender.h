@@ -24,7 +24,7 @@
 
 #include "Topology/TextureMesh.h"
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 #include "ConstructTangentSpace.h"
 #endif
 
@@ -68,7 +68,7 @@ namespace dyno
 
 		GLTextureMesh mTextureMesh;
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		std::shared_ptr<ConstructTangentSpace> mTangentSpaceConstructor;
 #endif
 	};
@@ -28,15 +28,21 @@ namespace dyno
 		printf("Warning: %s::updateImpl is not implemented!\n", getName().c_str());
 	}
 
-	void GLVisualModule::preprocess()
+	void GLVisualModule::postprocess()
 	{
 		updateMutex.lock();
+
+		for (auto obj : stagingObjects)
+			obj->publish();
+
+		this->changed++;
+
+		updateMutex.unlock();
 	}
 
-	void GLVisualModule::postprocess()
+	void GLVisualModule::addStagingObject(StagingObject* obj)
 	{
-		updateMutex.unlock();
-		this->changed = clock::now();
+		stagingObjects.push_back(obj);
 	}
 
 	bool GLVisualModule::validateInputs()
@@ -75,9 +81,8 @@ namespace dyno
 
 	bool GLVisualModule::isTransparent() const
 	{
-		// we need to copy the alpha since it doesn't provide const interface...
-		auto alpha = this->var_Alpha;
-		return alpha.getValue() < 1.f;
+		// fields are not copyable, getValue() has no const overload
+		return const_cast<GLVisualModule*>(this)->varAlpha()->getValue() < 1.f;
 	}
 
 	void GLVisualModule::draw(const RenderParams& rparams)
@@ -95,12 +100,16 @@ namespace dyno
 		if (!isGLInitialized)
 			throw std::runtime_error("Cannot initialize " + getName());
 
-		// check update
-		if (changed > updated) {
+		// check update, only the staging objects are flipped under the lock, the acquired data is uploaded without blocking the update
+		uint64_t version = changed.load();
+		if (version != updated) {
 			updateMutex.lock();
-			updateGL();
-			updated = clock::now();
+			for (auto obj : stagingObjects)
+				obj->acquire();
 			updateMutex.unlock();
+
+			updated = version;
+			updateGL();
 		}
 
 		// draw
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <Module/VisualModule.h>
@@ -23,6 +24,8 @@
 #include <Color.h>
 #include <RenderParams.h>
 
+#include "GraphicsObject/TripleBuffer.h"
+
 namespace dyno
 {
 	// render pass
@@ -62,12 +65,15 @@ namespace dyno
 		// override methods from Module
 		virtual void updateImpl() override;
 
-		// we use preprocess and postprocess method for update lock and timestamp
-		virtual void preprocess() override final;
+		// we use postprocess method to publish the staging objects written by updateImpl
 		virtual void postprocess() override final;
 
 		bool validateInputs() override final;
 
+		// register an object staging the data between updateImpl and updateGL, e.g., XBuffer and XTexture2D,
+		// all staging objects of a module are published and acquired together so that updateGL sees one consistent update
+		void addStagingObject(StagingObject* obj);
+
 	protected:
 		// methods for create/update/release OpenGL rendering content
 		virtual bool initializeGL() = 0;
@@ -79,13 +85,14 @@ namespace dyno
 	private:
 		bool isGLInitialized = false;
 
-		// mutex for sync data
+		std::vector<StagingObject*> stagingObjects;
+
+		// mutex for sync data, only held while the staging objects are published or acquired
 		std::mutex	updateMutex;
 
-		using clock = std::chrono::high_resolution_clock;
-		// the timestamp when graphics context is changed by calling updateGraphicsContext
-		clock::time_point changed;
-		// the timestamp when GL resource is updated by updateGL
-		clock::time_point updated;
+		// version of the published staging objects, increased by updateGraphicsContext which may run on the simulation thread
+		std::atomic<uint64_t> changed = 0;
+		// version of the staging objects acquired by the render thread
+		uint64_t updated = 0;
 	};
 };
\ No newline at end of file
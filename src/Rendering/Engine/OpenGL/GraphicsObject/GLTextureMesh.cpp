@@ -28,7 +28,13 @@ namespace dyno
 
 	void GLMaterial::updateGL()
 	{
+		// loaded and uploaded by the same thread
+		texColor.publish();
+		texColor.acquire();
 		texColor.updateGL();
+
+		texBump.publish();
+		texBump.acquire();
 		texBump.updateGL();
 	}
 
@@ -67,9 +73,13 @@ namespace dyno
 		if (!mInitialized)
 			create();
 
-		glVertexIndex.updateGL();
-		glNormalIndex.updateGL();
-		glTexCoordIndex.updateGL();
+		// loaded and uploaded by the same thread
+		for (auto buffer : { &glVertexIndex, &glNormalIndex, &glTexCoordIndex })
+		{
+			buffer->publish();
+			buffer->acquire();
+			buffer->updateGL();
+		}
 	}
 
 
@@ -120,83 +130,77 @@ namespace dyno
 		mNormal.load(mesh->normals());
 		mTexCoord.load(mesh->texCoords());
 
-		uint shapeNum = mesh->shapes().size();
-
-		if (mShapes.size() != shapeNum)
-		{
-			mShapes.resize(shapeNum);
-			for (uint i = 0; i < shapeNum; i++)
-			{
-				mShapes[i] = std::make_shared<GLShape>();
-			}
-		}
+		// GL objects may not be created or released here, only the shapes and materials are copied
+		Layout& layout = mLayout.back();
 
 		uint matNum = mesh->materials().size();
-		if (mMaterials.size() != matNum)
-		{
-			mMaterials.resize(matNum);
-			for (uint i = 0; i < matNum; i++)
-			{
-				mMaterials[i] = std::make_shared<GLMaterial>();
-			}
-		}
+		layout.materials.resize(matNum);
 
 		std::map<std::shared_ptr<Material>, uint> mapper;
 
 		for (uint i = 0; i < matNum; i++)
 		{
-			mMaterials[i]->baseColor = mesh->materials()[i]->baseColor;
-			mMaterials[i]->metallic = mesh->materials()[i]->metallic;
-			mMaterials[i]->roughness = mesh->materials()[i]->roughness;
-			mMaterials[i]->metallic = mesh->materials()[i]->metallic;
-			mMaterials[i]->bumpScale = mesh->materials()[i]->bumpScale;
-			mMaterials[i]->texColor.load(mesh->materials()[i]->texColor);
-			mMaterials[i]->texBump.load(mesh->materials()[i]->texBump);
+			auto src = mesh->materials()[i];
+
+			if (layout.materials[i] == nullptr)
+				layout.materials[i] = std::make_shared<Material>();
+
+			auto dst = layout.materials[i];
+			dst->baseColor = src->baseColor;
+			dst->metallic = src->metallic;
+			dst->roughness = src->roughness;
+			dst->alpha = src->alpha;
+			dst->bumpScale = src->bumpScale;
+			dst->texColor.assign(src->texColor);
+			dst->texBump.assign(src->texBump);
 
-			mapper[mesh->materials()[i]] = i;
-		}	
+			mapper[src] = i;
+		}
+
+		uint shapeNum = mesh->shapes().size();
+		layout.shapes.resize(shapeNum);
 
 		for (uint i = 0; i < shapeNum; i++)
 		{
-			mShapes[i]->glVertexIndex.load(mesh->shapes()[i]->vertexIndex);
-			mShapes[i]->glNormalIndex.load(mesh->shapes()[i]->normalIndex);
-			mShapes[i]->glTexCoordIndex.load(mesh->shapes()[i]->texCoordIndex);
-	
-			Vec3f S =  mesh->shapes()[i]->boundingTransform.scale();
-			Mat3f R = mesh->shapes()[i]->boundingTransform.rotation();
-			Vec3f T = mesh->shapes()[i]->boundingTransform.translation();
+			auto src = mesh->shapes()[i];
 
-			Mat3f RS = R * Mat3f(
-				S[0], 0, 0,
-				0, S[1], 0,
-				0, 0, S[2]);
-
-			glm::mat4 tm = glm::mat4{
-				RS(0, 0), RS(1, 0), RS(2, 0), 0,
-				RS(0, 1), RS(1, 1), RS(2, 1), 0,
-				RS(0, 2), RS(1, 2), RS(2, 2), 0,
-				T[0],	  T[1],	    T[2],	  1 };
+			if (layout.shapes[i] == nullptr)
+				layout.shapes[i] = std::make_shared<Shape>();
 
-			mShapes[i]->transform = tm;
+			auto dst = layout.shapes[i];
+			dst->vertexIndex.assign(src->vertexIndex);
+			dst->normalIndex.assign(src->normalIndex);
+			dst->texCoordIndex.assign(src->texCoordIndex);
+			dst->boundingTransform = src->boundingTransform;
 
 			//Setup the material for each shape
-			auto test = mapper[mesh->shapes()[i]->material];
-			auto testsm = mesh->shapes()[i]->material;
-
-			if (mesh->shapes()[i]->material != NULL) 
-			{
-				mShapes[i]->material = mMaterials[mapper[mesh->shapes()[i]->material]];
-			}
-			else 
-			{
-				mShapes[i]->material = NULL;
-			}
-				
+			if (src->material != NULL)
+				dst->material = layout.materials[mapper[src->material]];
+			else
+				dst->material = NULL;
 		}
 
 		mapper.clear();
 	}
 
+	void GLTextureMesh::publish()
+	{
+		mVertices.publish();
+		mNormal.publish();
+		mTexCoord.publish();
+
+		mLayout.publish();
+	}
+
+	void GLTextureMesh::acquire()
+	{
+		mVertices.acquire();
+		mNormal.acquire();
+		mTexCoord.acquire();
+
+		mLayout.acquire();
+	}
+
 	void GLTextureMesh::updateGL()
 	{
 		if (!mInitialized)
@@ -206,14 +210,80 @@ namespace dyno
 		mNormal.updateGL();
 		mTexCoord.updateGL();
 
-		for (uint i = 0; i < mShapes.size(); i++)
+		if (mLayout.changed())
+			updateLayout(mLayout.front());
+	}
+
+	void GLTextureMesh::updateLayout(const Layout& layout)
+	{
+		uint matNum = layout.materials.size();
+		uint shapeNum = layout.shapes.size();
+
+		// GL objects of the removed shapes and materials are released within GL context
+		for (uint i = matNum; i < mMaterials.size(); i++)
+			mMaterials[i]->release();
+
+		for (uint i = shapeNum; i < mShapes.size(); i++)
+			mShapes[i]->release();
+
+		mMaterials.resize(matNum);
+		mShapes.resize(shapeNum);
+
+		std::map<std::shared_ptr<Material>, uint> mapper;
+
+		for (uint i = 0; i < matNum; i++)
 		{
-			mShapes[i]->updateGL();
+			if (mMaterials[i] == nullptr)
+				mMaterials[i] = std::make_shared<GLMaterial>();
+
+			auto src = layout.materials[i];
+			auto dst = mMaterials[i];
+
+			dst->baseColor = src->baseColor;
+			dst->metallic = src->metallic;
+			dst->roughness = src->roughness;
+			dst->bumpScale = src->bumpScale;
+			dst->texColor.load(src->texColor);
+			dst->texBump.load(src->texBump);
+			dst->updateGL();
+
+			mapper[src] = i;
 		}
 
-		for (uint i = 0; i < mMaterials.size(); i++)
+		for (uint i = 0; i < shapeNum; i++)
 		{
-			mMaterials[i]->updateGL();
+			if (mShapes[i] == nullptr)
+				mShapes[i] = std::make_shared<GLShape>();
+
+			auto src = layout.shapes[i];
+			auto dst = mShapes[i];
+
+			dst->glVertexIndex.load(src->vertexIndex);
+			dst->glNormalIndex.load(src->normalIndex);
+			dst->glTexCoordIndex.load(src->texCoordIndex);
+			dst->updateGL();
+
+			Vec3f S = src->boundingTransform.scale();
+			Mat3f R = src->boundingTransform.rotation();
+			Vec3f T = src->boundingTransform.translation();
+
+			Mat3f RS = R * Mat3f(
+				S[0], 0, 0,
+				0, S[1], 0,
+				0, 0, S[2]);
+
+			glm::mat4 tm = glm::mat4{
+				RS(0, 0), RS(1, 0), RS(2, 0), 0,
+				RS(0, 1), RS(1, 1), RS(2, 1), 0,
+				RS(0, 2), RS(1, 2), RS(2, 2), 0,
+				T[0],	  T[1],	    T[2],	  1 };
+
+			dst->transform = tm;
+
+			if (src->material != NULL)
+				dst->material = mMaterials[mapper[src->material]];
+			else
+				dst->material = NULL;
 		}
 	}
 
@@ -37,6 +37,7 @@ namespace dyno
 		void create() override;
 		void release() override;
 
+		// upload the textures loaded within GL context
 		void updateGL();
 
 	public:
@@ -64,6 +65,7 @@ namespace dyno
 		void create() override;
 		void release() override;
 
+		// upload the indices loaded within GL context
 		void updateGL();
 
 		XBuffer<dyno::TopologyModule::Triangle>		glVertexIndex;
@@ -78,7 +80,11 @@ namespace dyno
 		bool mInitialized = false;
 	};
 
-	class GLTextureMesh : public GraphicsObject
+	/*
+	 * The mesh is staged by load(), shapes and materials are created, uploaded and released by updateGL within GL context.
+	 * shapes() and materials() are therefore only accessed by the render thread.
+	 */
+	class GLTextureMesh : public GraphicsObject, public StagingObject
 	{
 	public:
 		GLTextureMesh();
@@ -89,6 +95,9 @@ namespace dyno
 
 		void load(const std::shared_ptr<TextureMesh> mesh);
 
+		void publish() override;
+		void acquire() override;
+
 		void updateGL();
 
 		inline XBuffer<Vec3f>& vertices() { return mVertices; }
@@ -99,10 +108,21 @@ namespace dyno
 		inline std::vector<std::shared_ptr<GLMaterial>>& materials() { return mMaterials; }
 
 	private:
+		// copy of the shapes and materials of the loaded mesh
+		struct Layout
+		{
+			std::vector<std::shared_ptr<Shape>> shapes;
+			std::vector<std::shared_ptr<Material>> materials;
+		};
+
+		void updateLayout(const Layout& layout);
+
 		XBuffer<Vec3f> mVertices;
 		XBuffer<Vec3f> mNormal;
 		XBuffer<Vec2f> mTexCoord;
 
+		TripleBuffer<Layout> mLayout;
+
 		std::vector<std::shared_ptr<GLShape>> mShapes;
 		std::vector<std::shared_ptr<GLMaterial>> mMaterials;
 
@@ -193,10 +193,32 @@ void main() { vDst[uDstPitch * gl_GlobalInvocationID.x + gl_GlobalInvocationID.y
 #endif // VK_BACKEND
 
 
+	template<typename T>
+	void XBuffer<T>::publish()
+	{
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		mStaging.publish();
+#endif
+	}
+
+	template<typename T>
+	void XBuffer<T>::acquire()
+	{
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		mStaging.acquire();
+#endif
+	}
+
 	template<typename T>
 	void XBuffer<T>::updateGL()
 	{
 #ifdef CUDA_BACKEND
+		// the acquired data is already uploaded
+		if (!mStaging.changed())
+			return;
+
+		auto& buffer = mStaging.front();
+
 		int size = buffer.size() * sizeof(T);
 		if (size == 0)
 			return;
@@ -228,6 +250,26 @@ void main() { vDst[uDstPitch * gl_GlobalInvocationID.x + gl_GlobalInvocationID.y
 
 #endif // CUDA_BACKEND
 
+#ifdef NO_BACKEND
+		// the acquired data is already uploaded
+		if (!mStaging.changed())
+			return;
+
+		auto& buffer = mStaging.front();
+
+		int size = buffer.size() * sizeof(T);
+		if (size == 0)
+			return;
+
+		// device arrays live in host memory, upload them without interop
+		if (size < (this->size / 2))
+			allocate(size);
+		if (size > this->size)
+			allocate(size * 1.5);
+
+		Buffer::load(buffer.begin(), size);
+#endif // NO_BACKEND
+
 #ifdef VK_BACKEND
 		// we need to re-create buffer and memory object when buffer is resized...
 		if (resized)
@@ -273,8 +315,8 @@ void main() { vDst[uDstPitch * gl_GlobalInvocationID.x + gl_GlobalInvocationID.y
 		return srcBufferSize / sizeof(T);
 #endif
 
-#ifdef CUDA_BACKEND
-		return buffer.size();
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		return mStaging.front().size();
 #endif
 	}
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Buffer.h"
+#include "TripleBuffer.h"
 #include <Array/Array.h>
 
 #include <Vector.h>
@@ -35,14 +36,15 @@ namespace dyno
 {
 
 	// buffer for exchange data from simulation to rendering
-	// please note that we use additional buffer for r/w consistency between simulation and rendering loop
+	// please note that we use additional buffers for r/w consistency between simulation and rendering loop,
+	// data is loaded into a staging copy and uploaded after being published and acquired
 	template<typename T>
-	class XBuffer : public Buffer
+	class XBuffer : public Buffer, public StagingObject
 	{
 	public:
-		// update OpenGL buffer within GL context
+		// update OpenGL buffer within GL context with the acquired data
 		void updateGL();
-		// return number of elements
+		// return number of elements of the acquired data
 		int  count() const;
 
 		// load data to into an intermediate buffer
@@ -53,11 +55,14 @@ namespace dyno
 			this->loadVkBuffer(data.buffer(), data.bufferSize());
 #endif // VK_BACKEND
 
-#ifdef CUDA_BACKEND
-			buffer.assign(data);
-#endif // CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+			mStaging.back().assign(data);
+#endif // CUDA_BACKEND || NO_BACKEND
 		}
 
+		void publish() override;
+		void acquire() override;
+
 	private:
 
 #ifdef VK_BACKEND
@@ -83,8 +88,11 @@ namespace dyno
 #endif	//VK_BACKEND
 
 
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		TripleBuffer<dyno::DArray<T>> mStaging;
+#endif
+
 #ifdef CUDA_BACKEND
-		dyno::DArray<T>	buffer;
 		cudaGraphicsResource* resource = 0;
 #endif
 	};
@@ -55,9 +55,9 @@ namespace dyno
 	template<typename T>
 	void XTexture2D<T>::load(dyno::DArray2D<T> data)
 	{
-#ifdef CUDA_BACKEND
-		buffer.assign(data);
-#endif // CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		mStaging.back().assign(data);
+#endif // CUDA_BACKEND || NO_BACKEND
 
 #ifdef VK_BACKEND
 
@@ -195,6 +195,22 @@ namespace dyno
 	// TODO: for linux and other OS
 #endif  
 
+#endif
+	}
+
+	template<typename T>
+	void XTexture2D<T>::publish()
+	{
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		mStaging.publish();
+#endif
+	}
+
+	template<typename T>
+	void XTexture2D<T>::acquire()
+	{
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		mStaging.acquire();
 #endif
 	}
 
@@ -202,6 +218,11 @@ namespace dyno
 	void XTexture2D<T>::updateGL()
 	{
 #ifdef CUDA_BACKEND
+		// the acquired data is already uploaded
+		if (!mStaging.changed())
+			return;
+
+		auto& buffer = mStaging.front();
 
 		if (buffer.size() <= 0) {
 			width = buffer.nx();
@@ -238,6 +259,21 @@ namespace dyno
 
 #endif // CUDA_BACKEND
 
+#ifdef NO_BACKEND
+		// the acquired data is already uploaded
+		if (!mStaging.changed())
+			return;
+
+		auto& buffer = mStaging.front();
+
+		width = buffer.nx();
+		height = buffer.ny();
+
+		// rows of host arrays are tightly packed, the texture is reloaded from host memory
+		if (buffer.size() > 0)
+			Texture2D::load(width, height, buffer.begin());
+#endif // NO_BACKEND
+
 
 #ifdef VK_BACKEND
 
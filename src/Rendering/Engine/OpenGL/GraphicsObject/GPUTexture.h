@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Texture.h"
+#include "TripleBuffer.h"
 #include <Vector.h>
 #include <Array/Array2D.h>
 
@@ -30,9 +31,9 @@ struct cudaGraphicsResource;
 
 namespace dyno {
 
-	// texture for loading data from cuda/vulkan api
+	// texture for loading data from cuda/vulkan api, staged like XBuffer
 	template<typename T>
-	class XTexture2D : public Texture2D
+	class XTexture2D : public Texture2D, public StagingObject
 	{
 	public:
 		XTexture2D() {}
@@ -41,18 +42,24 @@ namespace dyno {
 		virtual void create() override;
 		bool isValid() const;
 
-		// update OpenGL texture within GL context
+		// update OpenGL texture within GL context with the acquired data
 		void updateGL();
 
 		// load data to into an intermediate buffer
 		void load(dyno::DArray2D<T> data);
 
+		void publish() override;
+		void acquire() override;
+
 	private:
 		int width  = -1;
 		int height = -1;
 
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		TripleBuffer<dyno::DArray2D<T>>	mStaging;
+#endif
+
 #ifdef CUDA_BACKEND
-		dyno::DArray2D<T>		buffer;
 		cudaGraphicsResource*	resource = 0;
 #endif
 
@@ -0,0 +1,106 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <utility>
+
+namespace dyno
+{
+	/*
+	 * Data written by the thread updating a visual module and read by the render thread.
+	 * All staging objects of a module are flipped together under the module lock, see GLVisualModule.
+	 */
+	class StagingObject
+	{
+	public:
+		virtual ~StagingObject() = default;
+
+		// hand the data written since the last call over to the render thread
+		virtual void publish() = 0;
+		// take the latest published data, only called by the render thread
+		virtual void acquire() = 0;
+	};
+
+	/*
+	 * Three copies of T: the one being written, the latest published one and the one being read,
+	 * so that writing the next frame never waits for the current one to be read.
+	 * Copies that are not written keep their content, a partial update only publishes what was written.
+	 */
+	template<typename T>
+	class TripleBuffer : public StagingObject
+	{
+	public:
+		// copy to write, it is only published if this is called since the last publish()
+		T& back()
+		{
+			mWritten = true;
+			return mSlots[mBack];
+		}
+
+		// copy to read, valid until the next acquire()
+		T& front() { return mSlots[mFront]; }
+		const T& front() const { return mSlots[mFront]; }
+
+		void publish() override
+		{
+			if (!mWritten)
+				return;
+
+			std::swap(mBack, mReady);
+			mWritten = false;
+			mFresh = true;
+		}
+
+		void acquire() override
+		{
+			if (!mFresh)
+				return;
+
+			std::swap(mFront, mReady);
+			mFresh = false;
+			mAcquired = true;
+		}
+
+		// return whether the front copy changed since the last call
+		bool changed()
+		{
+			return std::exchange(mAcquired, false);
+		}
+
+		// for releasing resources held by the copies
+		template<typename Func>
+		void forEach(Func func)
+		{
+			for (auto& slot : mSlots)
+				func(slot);
+		}
+
+	private:
+		T mSlots[3];
+
+		unsigned int mBack = 0;
+		unsigned int mReady = 1;
+		unsigned int mFront = 2;
+
+		// owned by the writing thread
+		bool mWritten = false;
+		// the ready copy is newer than the front one
+		bool mFresh = false;
+		// owned by the render thread
+		bool mAcquired = false;
+	};
+}
@@ -31,6 +31,9 @@ namespace dyno
 		this->varPointSize()->setRange(0.001f, 1.0f);
 		this->varBaseColor()->setValue(Color::Grey81());
 		this->varForceUpdate()->setValue(true);
+
+		this->addStagingObject(&mPosition);
+		this->addStagingObject(&mColor);
 	}
 
 	GLPointVisualModule::~GLPointVisualModule()
@@ -42,7 +42,7 @@ namespace dyno
 		void setColorMapMode(ColorMapMode mode);
 
 	public:
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		DEF_INSTANCE_IN(PointSet<DataType3f>, PointSet, "");
 #endif
 
@@ -24,10 +24,23 @@ namespace dyno
 		this->inTexCoord()->tagOptional(true);
 		this->inTexCoordIndex()->tagOptional(true);
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		this->inColorTexture()->tagOptional(true);
 		this->inBumpMap()->tagOptional(true);
 #endif
+
+		this->addStagingObject(&mVertexPosition);
+		this->addStagingObject(&mVertexColor);
+		this->addStagingObject(&mVertexIndex);
+		this->addStagingObject(&mNormal);
+		this->addStagingObject(&mNormalIndex);
+		this->addStagingObject(&mTexCoord);
+		this->addStagingObject(&mTexCoordIndex);
+
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
+		this->addStagingObject(&mColorTexture);
+		this->addStagingObject(&mBumpMap);
+#endif
 	}
 
 	GLSurfaceVisualModule::~GLSurfaceVisualModule()
@@ -132,7 +145,7 @@ namespace dyno
 			mTexCoord.updateGL();
 		}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		// update texture content
 		mColorTexture.updateGL();
 #endif
@@ -161,7 +174,7 @@ namespace dyno
 		// generate per-vertex normal
 		if (this->varUseVertexNormal()->getValue())
 		{
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 			//TODO: optimize the performance
 			if (this->inNormal()->isEmpty()) {
 				triSet->update();
@@ -189,7 +202,7 @@ namespace dyno
 			}
 		}
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		// texture
 		if (!inColorTexture()->isEmpty()) {
 			mColorTexture.load(inColorTexture()->constData());
@@ -264,7 +277,7 @@ namespace dyno
 			glActiveTexture(GL_TEXTURE11);		// bump map
 			glBindTexture(GL_TEXTURE_2D, 0);
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 			if (mColorTexture.isValid()) mColorTexture.bind(GL_TEXTURE10);
 			if (mBumpMap.isValid())		 mBumpMap.bind(GL_TEXTURE11);
 #endif
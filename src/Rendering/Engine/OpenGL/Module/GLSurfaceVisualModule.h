@@ -45,7 +45,7 @@ namespace dyno
 		DEF_ENUM(EColorMode, ColorMode, EColorMode::CM_Object, "Color Mode");
 		DEF_VAR(bool, UseVertexNormal, false, "");
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		DEF_INSTANCE_IN(TriangleSet<DataType3f>, TriangleSet, "");
 #endif
 
@@ -60,7 +60,7 @@ namespace dyno
 		DEF_ARRAY_IN(TopologyModule::Triangle, NormalIndex, DeviceType::GPU, "");
 		DEF_ARRAY_IN(TopologyModule::Triangle, TexCoordIndex, DeviceType::GPU, "");
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		DEF_ARRAY2D_IN(Vec4f, ColorTexture, DeviceType::GPU, "");
 		DEF_ARRAY2D_IN(Vec4f, BumpMap, DeviceType::GPU, "");
 #endif
@@ -94,7 +94,7 @@ namespace dyno
 		XBuffer<Vec2f> mTexCoord;
 		XBuffer<TopologyModule::Triangle> mTexCoordIndex;
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		// color texture
 		XTexture2D<Vec4f> mColorTexture;
 		XTexture2D<Vec4f> mBumpMap;
@@ -18,6 +18,9 @@ namespace dyno
 		this->setName("wireframe_renderer");
 		this->varBaseColor()->setValue(Color::Grey21());
 		this->varRadius()->setRange(0.001, 0.01);
+
+		this->addStagingObject(&mVertexBuffer);
+		this->addStagingObject(&mIndexBuffer);
 	}
 
 	GLWireframeVisualModule::~GLWireframeVisualModule()
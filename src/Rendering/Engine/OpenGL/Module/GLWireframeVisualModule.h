@@ -41,7 +41,7 @@ namespace dyno
 
 		std::string caption() override;
 
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		DEF_INSTANCE_IN(EdgeSet<DataType3f>, EdgeSet, "");
 #endif
 
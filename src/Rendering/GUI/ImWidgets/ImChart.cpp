@@ -79,7 +79,7 @@ namespace dyno
 			auto& pArray = this->inArray()->getData();
 			if (pFixed)
 			{
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 				lowLimit = m_reduce_real.minimum(pArray.begin(), pArray.size());
 				upLimit = m_reduce_real.maximum(pArray.begin(), pArray.size());
 #endif // CUDA_BACKEND
@@ -66,7 +66,7 @@ namespace dyno
 	private:
 
 		ImVec2              		mCoord = ImVec2(0, 0);
-#ifdef CUDA_BACKEND
+#if defined(CUDA_BACKEND) || defined(NO_BACKEND)
 		Reduction<Real> 			m_reduce_real;
 #endif // CUDA_BACKEND
 
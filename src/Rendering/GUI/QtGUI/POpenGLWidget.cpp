@@ -450,34 +450,24 @@ namespace dyno
 
 	}
 
+	//Graphics pipelines only stage data for the visual modules, no GL context is required
 	void POpenGLWidget::updateGrpahicsContext()
 	{
-		makeCurrent();
-
-		PSimulationThread::instance()->startUpdatingGraphicsContext();
-
 		SceneGraphFactory::instance()->active()->updateGraphicsContext();
 
-		PSimulationThread::instance()->stopUpdatingGraphicsContext();
-
 		update();
-
-		doneCurrent();
 	}
 
 	void POpenGLWidget::updateGraphicsContext(Node* node)
 	{
-		makeCurrent();
-
-		PSimulationThread::instance()->startUpdatingGraphicsContext();
-
-		node->graphicsPipeline()->forceUpdate();
-
-		PSimulationThread::instance()->stopUpdatingGraphicsContext();
+		SceneGraphFactory::instance()->active()->forceUpdateGraphicsContext(node);
 
 		update();
+	}
 
-		doneCurrent();
+	void POpenGLWidget::updatePublishedFrame()
+	{
+		update();
 	}
 
 	void POpenGLWidget::updateOneFrame(int frame)
@@ -85,6 +85,9 @@ namespace dyno
 		void updateGrpahicsContext();
 		void updateGraphicsContext(Node* node);
 
+		//Redraw with the graphics context published by the simulation thread
+		void updatePublishedFrame();
+
 		void updateOneFrame(int frame);
 
 	signals:
@@ -24,7 +24,6 @@ namespace dyno
 		mPaused(true),
 		mRunning(true),
 		mFinished(false),
-		mUpdatingGraphicsContext(false),
 		mTimeOut(10000)
 	{
 	}
@@ -135,7 +134,7 @@ namespace dyno
 
 			bool has_frame = scn->getFrameNumber() < mTotalFrame;
 
-			while(mRunning && (mUpdatingGraphicsContext || (!mReset && mPaused))) {
+			while(mRunning && !mReset && mPaused) {
 				mCond.wait_for(lock, 500ms);
 			}
 
@@ -156,6 +155,8 @@ namespace dyno
 
 				mReset = false;
 
+				scn->publishGraphicsContext();
+
 				emit oneFrameFinished(scn->getFrameNumber());
 			}
 
@@ -164,7 +165,8 @@ namespace dyno
 				{
 					scn->takeOneFrame();
 
-					this->startUpdatingGraphicsContext();
+					//The next frame is simulated while the published one is drawn
+					scn->publishGraphicsContext();
 
 					emit oneFrameFinished(scn->getFrameNumber());
 				}
@@ -247,17 +249,6 @@ namespace dyno
 		notify();
 	}
 
-	void PSimulationThread::startUpdatingGraphicsContext()
-	{
-		mUpdatingGraphicsContext = true;
-	}
-
-	void PSimulationThread::stopUpdatingGraphicsContext()
-	{
-		mUpdatingGraphicsContext = false;
-		notify();
-	}
-
 	void PSimulationThread::setTotalFrames(int num)
 	{
 		mTotalFrame = num;
@@ -46,9 +46,6 @@ namespace dyno
 		 */
 		void proceed(int num);
 
-		void startUpdatingGraphicsContext();
-		void stopUpdatingGraphicsContext();
-
 		void setTotalFrames(int num);
 		inline int getTotalFrames() { return mTotalFrame; }
 
@@ -88,8 +85,6 @@ namespace dyno
 		std::atomic<bool> mRunning;
 		bool mFinished;
 
-		std::atomic<bool> mUpdatingGraphicsContext;
-
 		std::shared_ptr<Node> mActiveNode;
 
 		std::chrono::milliseconds mTimeOut;
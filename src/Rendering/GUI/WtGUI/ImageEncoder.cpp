@@ -1,6 +1,114 @@
 #include "ImageEncoder.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef DYNO_WITH_LIBJPEG
+#include <jpeglib.h>
+#else
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb/stb_image_write.h>
+#endif
+
+#ifdef DYNO_WITH_NVJPEG
+#include <cuda_runtime.h>
 #include <nvjpeg.h>
+#endif
+
+std::unique_ptr<ImageEncoder> ImageEncoder::Create(ImageEncoderType type)
+{
+	if (type == ImageEncoderType::Auto)
+	{
+		const char* name = std::getenv("DYNO_IMAGE_ENCODER");
+		if (name != nullptr && std::string(name) == "cpu")
+			type = ImageEncoderType::CPU;
+		else if (name != nullptr && std::string(name) == "nvjpeg")
+			type = ImageEncoderType::NVJPEG;
+	}
+
+#ifdef DYNO_WITH_NVJPEG
+	if (type != ImageEncoderType::CPU)
+	{
+		int deviceCount = 0;
+		if (cudaGetDeviceCount(&deviceCount) == cudaSuccess && deviceCount > 0)
+			return std::make_unique<ImageEncoderNV>();
+	}
+#endif
+
+	if (type == ImageEncoderType::NVJPEG)
+		fprintf(stderr, "nvJPEG is not available, images are encoded on CPU\n");
+
+	return std::make_unique<ImageEncoderCPU>();
+}
+
+void ImageEncoderCPU::SetQuality(int quality)
+{
+	this->quality = quality < 1 ? 1 : (quality > 100 ? 100 : quality);
+}
+
+unsigned long ImageEncoderCPU::Encode(const unsigned char* data,
+	int width, int height, int pitch,
+	std::vector<unsigned char>& buffer)
+{
+	int rowBytes = width * 3;
+	if (pitch == 0) pitch = rowBytes;
+
+	buffer.clear();
+
+#ifdef DYNO_WITH_LIBJPEG
+	// libjpeg-turbo uses SIMD for color conversion, downsampling and DCT
+	jpeg_compress_struct cinfo;
+	jpeg_error_mgr jerr;
+	cinfo.err = jpeg_std_error(&jerr);
+	jpeg_create_compress(&cinfo);
+
+	unsigned char* out = nullptr;
+	unsigned long size = 0;
+	jpeg_mem_dest(&cinfo, &out, &size);
+
+	cinfo.image_width = width;
+	cinfo.image_height = height;
+	cinfo.input_components = 3;
+	cinfo.in_color_space = JCS_RGB;
+	jpeg_set_defaults(&cinfo);
+	jpeg_set_quality(&cinfo, quality, TRUE);
+	cinfo.dct_method = JDCT_IFAST;
+
+	jpeg_start_compress(&cinfo, TRUE);
+	while (cinfo.next_scanline < cinfo.image_height)
+	{
+		JSAMPROW row = (JSAMPROW)(data + (size_t)cinfo.next_scanline * pitch);
+		jpeg_write_scanlines(&cinfo, &row, 1);
+	}
+	jpeg_finish_compress(&cinfo);
+
+	buffer.assign(out, out + size);
+
+	jpeg_destroy_compress(&cinfo);
+	free(out);
+#else
+	// stb_image_write expects tightly packed rows
+	if (pitch != rowBytes)
+	{
+		packed.resize((size_t)rowBytes * height);
+		for (int j = 0; j < height; j++)
+			memcpy(packed.data() + (size_t)j * rowBytes, data + (size_t)j * pitch, rowBytes);
+		data = packed.data();
+	}
+
+	stbi_write_jpg_to_func([](void* context, void* bytes, int size) {
+		auto* buf = static_cast<std::vector<unsigned char>*>(context);
+		buf->insert(buf->end(), (unsigned char*)bytes, (unsigned char*)bytes + size);
+		}, &buffer, width, height, 3, data, quality);
+#endif
+
+	return (unsigned long)buffer.size();
+}
 
+#ifdef DYNO_WITH_NVJPEG
 
 template <typename T>
 void check(T result, char const* const func, const char* const file,
@@ -80,3 +188,4 @@ unsigned long ImageEncoderNV::Encode(const unsigned char* data,
 
 	return length;
 }
+#endif // DYNO_WITH_NVJPEG
@@ -1,16 +1,53 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 
-class ImageEncoder 
+enum class ImageEncoderType
+{
+	Auto,		// nvJPEG if available, CPU otherwise, can be overridden by the environment variable DYNO_IMAGE_ENCODER=cpu|nvjpeg
+	CPU,
+	NVJPEG
+};
+
+class ImageEncoder
 {
 public:
+	virtual ~ImageEncoder() {}
+
 	virtual void SetQuality(int quality) = 0;
+
+	// encode an RGB image into JPEG, pitch is the number of bytes per row (0 for tightly packed rows)
+	// returns the length of the JPEG stream, the buffer can be larger than that
 	virtual unsigned long Encode(const unsigned char* data,
 		int width, int height, int pitch,
 		std::vector<unsigned char>& buffer) = 0;
+
+	// CPU encoders can be used from several threads at once, each thread with its own encoder
+	virtual bool IsCPU() const { return false; }
+
+	static std::unique_ptr<ImageEncoder> Create(ImageEncoderType type = ImageEncoderType::Auto);
+};
+
+// encode image on CPU with libjpeg(-turbo) if found at build time, stb_image_write otherwise
+class ImageEncoderCPU : public ImageEncoder
+{
+public:
+	virtual void SetQuality(int quality) override;
+	virtual unsigned long Encode(const unsigned char* data,
+		int width, int height, int pitch,
+		std::vector<unsigned char>& buffer) override;
+
+	bool IsCPU() const override { return true; }
+
+private:
+	int quality = 70;
+
+	// tightly packed copy of images with padded rows
+	std::vector<unsigned char> packed;
 };
 
+#ifdef DYNO_WITH_NVJPEG
 // encode image with nvJPG
 struct nvjpegHandle;
 struct nvjpegEncoderState;
@@ -39,3 +76,4 @@ private:
 		size_t	size;
 	} cudaBuffer;
 };
+#endif // DYNO_WITH_NVJPEG
@@ -0,0 +1,155 @@
+#include "TileStream.h"
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstring>
+
+// columns with fewer tiles compress worse and are not worth a thread
+static const int MinTilesPerPart = 4;
+// JPEG images are limited to 65535 rows
+static const int MaxTilesPerPart = 1000;
+
+TileStream::TileStream(ImageEncoderType type, int tileSize)
+	: tileSize(tileSize)
+{
+	encoders.push_back(ImageEncoder::Create(type));
+
+	// nvJPEG encodes one image at a time, CPU encoders run in parallel on the shared thread pool
+	if (encoders[0]->IsCPU())
+	{
+		int encoderNum = std::min(8, (int)dyno::ThreadPool::instance()->size() + 1);
+		for (int i = 1; i < encoderNum; i++)
+			encoders.push_back(ImageEncoder::Create(ImageEncoderType::CPU));
+	}
+
+	atlases.resize(encoders.size());
+}
+
+void TileStream::SetQuality(int quality)
+{
+	for (auto& encoder : encoders)
+		encoder->SetQuality(quality);
+}
+
+void TileStream::Reset()
+{
+	width = 0;
+	height = 0;
+}
+
+void TileStream::Update(const unsigned char* data, int w, int h, std::vector<Part>& parts)
+{
+	parts.clear();
+
+	bool full = w != width || h != height;
+	int tileX = (w + tileSize - 1) / tileSize;
+	int tileY = (h + tileSize - 1) / tileSize;
+
+	// find tiles that differ from the last frame sent
+	changed.clear();
+	for (int j = 0; j < tileY; j++)
+	{
+		for (int i = 0; i < tileX; i++)
+		{
+			int x0 = i * tileSize;
+			int y0 = j * tileSize;
+			size_t rowBytes = (size_t)std::min(tileSize, w - x0) * 3;
+			int rowNum = std::min(tileSize, h - y0);
+
+			bool diff = full;
+			for (int r = 0; r < rowNum && !diff; r++)
+			{
+				size_t offset = ((size_t)(y0 + r) * w + x0) * 3;
+				diff = memcmp(data + offset, previous.data() + offset, rowBytes) != 0;
+			}
+
+			if (diff)
+				changed.push_back(j * tileX + i);
+		}
+	}
+
+	if (full)
+	{
+		previous.assign(data, data + (size_t)w * h * 3);
+	}
+	else
+	{
+		for (int t : changed)
+		{
+			int x0 = (t % tileX) * tileSize;
+			int y0 = (t / tileX) * tileSize;
+			size_t rowBytes = (size_t)std::min(tileSize, w - x0) * 3;
+			int rowNum = std::min(tileSize, h - y0);
+
+			for (int r = 0; r < rowNum; r++)
+			{
+				size_t offset = ((size_t)(y0 + r) * w + x0) * 3;
+				memcpy(previous.data() + offset, data + offset, rowBytes);
+			}
+		}
+	}
+
+	width = w;
+	height = h;
+
+	int tileNum = (int)changed.size();
+	if (tileNum == 0)
+		return;
+
+	int partNum = std::min((int)encoders.size(), (tileNum + MinTilesPerPart - 1) / MinTilesPerPart);
+	partNum = std::max(partNum, (tileNum + MaxTilesPerPart - 1) / MaxTilesPerPart);
+	parts.resize(partNum);
+
+	// part p holds tiles [p * tileNum / partNum, (p + 1) * tileNum / partNum) and is encoded by encoder p % encoders.size()
+	auto encodeParts = [&](int e) {
+		for (int p = e; p < partNum; p += (int)encoders.size())
+		{
+			int begin = (int)((long long)p * tileNum / partNum);
+			int end = (int)((long long)(p + 1) * tileNum / partNum);
+			EncodePart(encoders[e].get(), data, w, h, changed.data() + begin, end - begin, parts[p], atlases[e]);
+		}
+	};
+
+	int taskNum = std::min((int)encoders.size(), partNum);
+
+	// the calling thread helps with the tasks, so a single task is encoded in place
+	dyno::ThreadPool::instance()->parallelFor(0, taskNum, [&](unsigned int e) { encodeParts((int)e); });
+}
+
+void TileStream::EncodePart(ImageEncoder* encoder, const unsigned char* data, int w, int h,
+	const int* tiles, int tileNum, Part& part, std::vector<unsigned char>& atlas)
+{
+	int tileX = (w + tileSize - 1) / tileSize;
+	size_t atlasRowBytes = (size_t)tileSize * 3;
+
+	atlas.resize(atlasRowBytes * tileSize * tileNum);
+	part.rects.resize(4 * tileNum);
+
+	for (int k = 0; k < tileNum; k++)
+	{
+		int x0 = (tiles[k] % tileX) * tileSize;
+		int y0 = (tiles[k] / tileX) * tileSize;
+		int tw = std::min(tileSize, w - x0);
+		int th = std::min(tileSize, h - y0);
+
+		// border tiles are padded by repeating their last row and column, which keeps the JPEG blocks smooth
+		for (int r = 0; r < tileSize; r++)
+		{
+			const unsigned char* src = data + ((size_t)(y0 + std::min(r, th - 1)) * w + x0) * 3;
+			unsigned char* dst = atlas.data() + ((size_t)k * tileSize + r) * atlasRowBytes;
+
+			memcpy(dst, src, (size_t)tw * 3);
+			for (int c = tw; c < tileSize; c++)
+				memcpy(dst + c * 3, src + (tw - 1) * 3, 3);
+		}
+
+		part.rects[4 * k] = x0;
+		part.rects[4 * k + 1] = y0;
+		part.rects[4 * k + 2] = tw;
+		part.rects[4 * k + 3] = th;
+	}
+
+	unsigned long length = encoder->Encode(atlas.data(), tileSize, tileSize * tileNum, 0, part.jpeg);
+	part.jpeg.resize(length);
+}
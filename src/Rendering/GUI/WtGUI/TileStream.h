@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ImageEncoder.h"
+
+#include <vector>
+#include <memory>
+
+// Split frames into tiles and encode only the tiles that changed since the previous frame.
+// Changed tiles are stacked into columns of tileSize pixels wide, each column is one JPEG image,
+// columns are encoded in parallel on the shared ThreadPool when the encoder runs on CPU.
+class TileStream
+{
+public:
+	struct Part
+	{
+		std::vector<unsigned char> jpeg;
+		// x, y, width and height of each tile in the frame, tile i is found at (0, i * tileSize) of the image
+		std::vector<int> rects;
+	};
+
+	TileStream(ImageEncoderType type = ImageEncoderType::Auto, int tileSize = 64);
+
+	void SetQuality(int quality);
+
+	// encode the tiles of an RGB frame that differ from the previous one, all tiles are encoded after a resize or Reset()
+	void Update(const unsigned char* data, int width, int height, std::vector<Part>& parts);
+
+	// the next frame is encoded in full, e.g., when the client lost some tiles
+	void Reset();
+
+	int TileSize() const { return tileSize; }
+
+private:
+	void EncodePart(ImageEncoder* encoder, const unsigned char* data, int width, int height,
+		const int* tiles, int tileNum, Part& part, std::vector<unsigned char>& atlas);
+
+	int tileSize;
+	int width = 0;
+	int height = 0;
+
+	// last frame sent
+	std::vector<unsigned char> previous;
+
+	// one encoder and one atlas per task
+	std::vector<std::unique_ptr<ImageEncoder>> encoders;
+	std::vector<std::vector<unsigned char>> atlases;
+
+	std::vector<int> changed;
+};
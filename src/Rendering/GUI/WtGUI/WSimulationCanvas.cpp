@@ -1,9 +1,8 @@
 #include "WSimulationCanvas.h"
-#include "ImageEncoder.h"
+#include "TileStream.h"
 
 #include <Wt/WApplication.h>
 #include <Wt/WMemoryResource.h>
-#include <Wt/WImage.h>
 
 #include <GLFW/glfw3.h>
 
@@ -14,8 +13,14 @@
 
 #include "imgui_impl_wt.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 using namespace dyno;
 
+// resources are kept for the last few frames, while the client loads them
+static const size_t MaxTileResources = 64;
+
 std::map<Wt::Key, PKeyboardType> WKeyMap =
 {
 	{Wt::Key::Unknown, PKEY_UNKNOWN},
@@ -103,6 +108,7 @@ PModifierBits mappingWtModifierBits(Wt::KeyboardModifier mods)
 }
 
 WSimulationCanvas::WSimulationCanvas()
+	: mTilesLost(this, "tilesLost")
 {
 	this->setLayoutSizeAware(true);
 	this->setStyleClass("remote-framebuffer");
@@ -127,41 +133,49 @@ WSimulationCanvas::WSimulationCanvas()
 
 	mApp = Wt::WApplication::instance();
 
-	mImage = this->addNew<Wt::WImage>();
-	mImage->resize("100%", "100%");
-
-	mImage->setJavaScriptMember("currURL", "null");
-	mImage->setJavaScriptMember("nextURL", "null");
-	mImage->setJavaScriptMember("onload",
-		"function() {"
-		"this.currURL = this.nextURL;"
-		"this.nextURL = null;"
-		"if (this.currURL != null) {"
-		"this.src = this.currURL;"
+	mCanvas = this->addNew<Wt::WContainerWidget>();
+	mCanvas->setHtmlTagName("canvas");
+	mCanvas->resize("100%", "100%");
+
+	// tiles are drawn in the order they were sent, each image is loaded as soon as its url arrives
+	mCanvas->setJavaScriptMember("pending", "Promise.resolve()");
+	mCanvas->setJavaScriptMember("drawTiles",
+		"function(url, width, height, tileSize, rects) {"
+		"var img = new Image();"
+		"var loaded = new Promise(function(resolve) {"
+		"img.onload = function() { resolve(true); };"
+		"img.onerror = function() { resolve(false); };"
+		"});"
+		"img.src = url;"
+		"this.pending = this.pending.then(function() { return loaded; }).then(function(ok) {"
+		"if (!ok) {"					// ask for a full frame
+		+ mTilesLost.createCall({}) + ";"
+		"return;"
 		"}"
-		"}.bind(" + mImage->jsRef() + ")");
-	mImage->setJavaScriptMember("onerror",
-		"function() {"
-		"this.currURL = this.nextURL;"
-		"this.nextURL = null;"
-		"if (this.currURL != null) {"
-		"this.src = this.currURL;"
+		"if (this.width != width || this.height != height) {"
+		"this.width = width;"
+		"this.height = height;"
 		"}"
-		"}.bind(" + mImage->jsRef() + ")");
-	mImage->setJavaScriptMember("update",
-		"function(url) { "
-		"if (this.currURL == null) {"
-		"this.currURL = url;"
-		"this.src = this.currURL;"
-		"} else {"						// still loading
-		"this.nextURL = url;"
+		"var ctx = this.getContext('2d');"
+		"for (var i = 0; i < rects.length; i += 4) {"
+		"ctx.drawImage(img, 0, i / 4 * tileSize, rects[i + 2], rects[i + 3], rects[i], rects[i + 1], rects[i + 2], rects[i + 3]);"
 		"}"
-		"}.bind(" + mImage->jsRef() + ")");
+		"}.bind(this));"
+		"}.bind(" + mCanvas->jsRef() + ")");
+
+	mTilesLost.connect([this]() {
+		mTileStream->Reset();
+		scheduleRender();
+		});
 
 	mImageData.resize(width * height * 3);	// initialize image buffer
-	mJpegEncoder = std::make_unique<ImageEncoderNV>();
-	mJpegEncoder->SetQuality(100);
-	mJpegResource = std::make_unique<Wt::WMemoryResource>("image/jpeg");
+	mTileStream = std::make_unique<TileStream>();
+
+	// lower qualities save bandwidth on slow connections
+	const char* quality = std::getenv("DYNO_IMAGE_QUALITY");
+	if (quality != nullptr && std::atoi(quality) > 0)
+		mImageQuality = std::min(100, std::atoi(quality));
+	mTileStream->SetQuality(mImageQuality);
 
 	mRenderEngine = std::make_shared<dyno::GLRenderEngine>();
 
@@ -185,7 +199,7 @@ WSimulationCanvas::~WSimulationCanvas()
 	mFrameColor.release();
 
 	mImageData.resize(0);
-	mJpegBuffer.resize(0);
+	mTileResources.clear();
 
 	glfwDestroyWindow(mContext);
 	//glfwTerminate();
@@ -407,24 +421,58 @@ void WSimulationCanvas::update()
 		this->doneCurrent();
 	}
 
-	// encode image
+	// encode the tiles changed since the last frame
+	std::vector<TileStream::Part> parts;
 	{
-		mJpegBuffer.clear();
+		mTileStream->Update(mImageData.data(),
+			mCamera->viewportWidth(), mCamera->viewportHeight(),
+			parts);
 
-		mJpegEncoder->Encode(mImageData.data(),
-			mCamera->viewportWidth(), mCamera->viewportHeight(), 0,
-			mJpegBuffer);
+		size_t bytes = 0;
+		size_t tiles = 0;
+		for (auto& part : parts)
+		{
+			bytes += part.jpeg.size();
+			tiles += part.rects.size() / 4;
+		}
 
 		Wt::log("info") << mCamera->viewportWidth() << " x " << mCamera->viewportHeight()
-			<< ", JPG size: " << mJpegBuffer.size() / 1024 << " kb";
+			<< ", " << tiles << " tiles, JPG size: " << bytes / 1024 << " kb";
 	}
 
 	// update UI
+	for (auto& part : parts)
 	{
-		mJpegResource->setData(std::move(mJpegBuffer));
-		const std::string url = mJpegResource->generateUrl();
-		mImage->callJavaScriptMember("update", WWebWidget::jsStringLiteral(url));
+		std::string rects = "[";
+		for (size_t i = 0; i < part.rects.size(); i++)
+			rects += (i == 0 ? "" : ",") + std::to_string(part.rects[i]);
+		rects += "]";
+
+		auto resource = std::make_unique<Wt::WMemoryResource>("image/jpeg");
+		resource->setData(std::move(part.jpeg));
+
+		mCanvas->callJavaScriptMember("drawTiles", WWebWidget::jsStringLiteral(resource->url())
+			+ "," + std::to_string(mCamera->viewportWidth())
+			+ "," + std::to_string(mCamera->viewportHeight())
+			+ "," + std::to_string(mTileStream->TileSize())
+			+ "," + rects);
+
+		mTileResources.push_back(std::move(resource));
 	}
+
+	// resources of tiles the client has not loaded yet are gone, the client then asks for a full frame
+	while (mTileResources.size() > MaxTileResources)
+		mTileResources.pop_front();
+}
+
+void WSimulationCanvas::setImageQuality(int quality)
+{
+	mImageQuality = std::max(1, std::min(100, quality));
+	mTileStream->SetQuality(mImageQuality);
+
+	// tiles already sent are replaced at the new quality
+	mTileStream->Reset();
+	scheduleRender();
 }
 
 void WSimulationCanvas::setScene(std::shared_ptr<dyno::SceneGraph> scene)
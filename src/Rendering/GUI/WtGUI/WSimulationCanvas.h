@@ -1,8 +1,10 @@
 #pragma once
 
 #include <Wt/WContainerWidget.h>
+#include <Wt/WJavaScript.h>
 
 #include <memory>
+#include <deque>
 
 #include <GraphicsObject/Framebuffer.h>
 #include <GraphicsObject/Texture.h>
@@ -20,7 +22,7 @@ namespace dyno
 };
 
 struct GLFWwindow;
-class ImageEncoder;
+class TileStream;
 class ImGuiBackendWt;
 
 class WSimulationCanvas 
@@ -35,6 +37,10 @@ public:
 
 	void update();
 
+	// JPEG quality of the streamed tiles in [1, 100], defaults to 100 or the environment variable DYNO_IMAGE_QUALITY
+	void setImageQuality(int quality);
+	int imageQuality() const { return mImageQuality; }
+
 public:
 	//Mouse interaction
 	void onMousePressed(const Wt::WMouseEvent& evt);
@@ -58,7 +64,7 @@ protected:
 	int height = 600;
 
 private:
-	Wt::WImage* mImage;
+	Wt::WContainerWidget* mCanvas;							// html canvas the tiles are drawn into
 	Wt::WApplication* mApp;
 
 	GLFWwindow* mContext;
@@ -67,9 +73,10 @@ private:
 	dyno::ImWindow mImWindow;
 
 	std::vector<unsigned char> mImageData;					// raw image	
-	std::vector<unsigned char> mJpegBuffer;					// jpeg data	
-	std::unique_ptr<ImageEncoder> mJpegEncoder;				// jpeg encoder	
-	std::unique_ptr<Wt::WMemoryResource> mJpegResource;		// Wt resource for jpeg image
+	std::unique_ptr<TileStream> mTileStream;				// encoder of changed tiles
+	int mImageQuality = 100;
+	std::deque<std::unique_ptr<Wt::WMemoryResource>> mTileResources;	// Wt resources for recently sent tiles
+	Wt::JSignal<> mTilesLost;								// emitted by the client when tiles could not be loaded
 
 	std::shared_ptr<dyno::SceneGraph> mScene = nullptr;
 	//std::shared_ptr<dyno::Camera>	  mCamera;
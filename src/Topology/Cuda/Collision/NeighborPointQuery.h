@@ -27,7 +27,7 @@ namespace dyno
 	public:
 		typedef typename TDataType::Real Real;
 		typedef typename TDataType::Coord Coord;
-		typedef typename TAlignedBox3D<Real> AABB;
+		typedef TAlignedBox3D<Real> AABB;
 
 		NeighborPointQuery();
 		~NeighborPointQuery() override;
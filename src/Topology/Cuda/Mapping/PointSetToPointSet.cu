@@ -162,9 +162,8 @@ namespace dyno
 	template<typename TDataType>
 	bool PointSetToPointSet<TDataType>::apply()
 	{
-		uint pDim = cudaGridSize(m_to->getPoints().size(), BLOCK_SIZE);
-
-		K_ApplyTransform << <pDim, BLOCK_SIZE >> > (
+		cuExecute(m_to->getPoints().size(),
+			K_ApplyTransform,
 			m_to->getPoints(),
 			m_from->getPoints(),
 			m_initTo->getPoints(),
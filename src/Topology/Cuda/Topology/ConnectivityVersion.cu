@@ -0,0 +1,41 @@
+#include "ConnectivityVersion.h"
+
+#include "Module/TopologyModule.h"
+
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
+
+namespace dyno
+{
+	template<typename Index>
+	bool ConnectivityVersion<Index>::update(DArray<Index>& indices, uint vertexNum)
+	{
+		static_assert(sizeof(Index) % sizeof(PointType) == 0, "Indices must consist of PointType");
+
+		bool changed = !mValid || mVertexNum != vertexNum || mIndices.size() != indices.size();
+
+		//All index types are plain arrays of PointType, so compare them element by element
+		if (!changed && indices.size() > 0)
+		{
+			const PointType* a = reinterpret_cast<const PointType*>(indices.begin());
+			const PointType* b = reinterpret_cast<const PointType*>(mIndices.begin());
+			uint num = indices.size() * (sizeof(Index) / sizeof(PointType));
+
+			changed = !thrust::equal(thrust::device, a, a + num, b);
+		}
+
+		if (!changed)
+			return false;
+
+		mIndices.assign(indices);
+		mVertexNum = vertexNum;
+		mValid = true;
+		mVersion++;
+
+		return true;
+	}
+
+	template class ConnectivityVersion<TopologyModule::Edge>;
+	template class ConnectivityVersion<TopologyModule::Triangle>;
+	template class ConnectivityVersion<TopologyModule::Tetrahedron>;
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Array/Array.h"
+
+namespace dyno
+{
+	/**
+	 * @brief A version counter of an index buffer, used to rebuild the connectivity derived from it only when the indices change.
+	 *
+	 *	Index buffers are also modified in place through references, e.g., getTriangles(), so changes are detected by comparing
+	 *	the indices with a copy taken at the last change instead of relying on setters. The comparison is a single pass over the indices,
+	 *	much cheaper than the sorts and scans needed to rebuild edges and adjacency lists.
+	 */
+	template<typename Index>
+	class ConnectivityVersion
+	{
+	public:
+		ConnectivityVersion() {};
+		~ConnectivityVersion() { mIndices.clear(); }
+
+		/**
+		 * @brief Compare the indices and the number of vertices with those of the last change
+		 *
+		 * @return true if they differ, the version is increased in that case
+		 */
+		bool update(DArray<Index>& indices, uint vertexNum = 0);
+
+		uint version() const { return mVersion; }
+
+		/**
+		 * @brief The next update() reports a change regardless of the indices
+		 */
+		void invalidate() { mValid = false; }
+
+		void clear() { mIndices.clear(); mValid = false; }
+
+	private:
+		DArray<Index> mIndices;
+
+		uint mVertexNum = 0;
+		uint mVersion = 0;
+
+		bool mValid = false;
+	};
+}
@@ -1,5 +1,7 @@
 #include "DiscreteElements.h"
 
+#include "BinaryStream.h"
+
 namespace dyno
 {
 	IMPLEMENT_TCLASS(DiscreteElements, TDataType)
@@ -125,5 +127,69 @@ namespace dyno
 		m_tris.assign(triangles);
 	}
 
+	template<typename TDataType>
+	bool DiscreteElements<TDataType>::writeBinary(std::ostream& out)
+	{
+		return writeBinaryArray(out, m_spheres)
+			&& writeBinaryArray(out, m_boxes)
+			&& writeBinaryArray(out, m_tets)
+			&& writeBinaryArray(out, m_caps)
+			&& writeBinaryArray(out, m_tris)
+			&& writeBinaryArray(out, mBallAndSocketJoints)
+			&& writeBinaryArray(out, mSliderJoints)
+			&& writeBinaryArray(out, mHingeJoints)
+			&& writeBinaryArray(out, mFixedJoints)
+			&& writeBinaryArray(out, mPointJoints)
+			&& writeBinaryArray(out, m_tet_sdf)
+			&& writeBinaryArray(out, m_tet_body_mapping)
+			&& writeBinaryArray(out, m_tet_element_id);
+	}
+
+	/**
+	 * Joints keep host pointers to the actors they were created from, which are meaningless once read back
+	 */
+	template<typename Joint>
+	bool readBinaryJoints(std::istream& in, DArray<Joint>& joints)
+	{
+		CArray<Joint> hJoints;
+		if (!readBinaryArray(in, hJoints))
+			return false;
+
+		for (uint i = 0; i < hJoints.size(); i++)
+		{
+			hJoints[i].actor1 = nullptr;
+			hJoints[i].actor2 = nullptr;
+		}
+
+		joints.assign(hJoints);
+
+		return true;
+	}
+
+	template<typename TDataType>
+	bool DiscreteElements<TDataType>::readBinary(std::istream& in)
+	{
+		bool ok = readBinaryArray(in, m_spheres)
+			&& readBinaryArray(in, m_boxes)
+			&& readBinaryArray(in, m_tets)
+			&& readBinaryArray(in, m_caps)
+			&& readBinaryArray(in, m_tris)
+			&& readBinaryJoints(in, mBallAndSocketJoints)
+			&& readBinaryJoints(in, mSliderJoints)
+			&& readBinaryJoints(in, mHingeJoints)
+			&& readBinaryJoints(in, mFixedJoints)
+			&& readBinaryJoints(in, mPointJoints)
+			&& readBinaryArray(in, m_tet_sdf)
+			&& readBinaryArray(in, m_tet_body_mapping)
+			&& readBinaryArray(in, m_tet_element_id);
+
+		if (!ok)
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(DiscreteElements);
 }
\ No newline at end of file
@@ -453,11 +453,11 @@ namespace dyno
 		typedef typename ::dyno::TOrientedBox3D<Real> Box3D;
 		typedef typename ::dyno::TTet3D<Real> Tet3D;
 
-		typedef typename BallAndSocketJoint<Real> BallAndSocketJoint;
-		typedef typename SliderJoint<Real> SliderJoint;
-		typedef typename HingeJoint<Real> HingeJoint;
-		typedef typename FixedJoint<Real> FixedJoint;
-		typedef typename PointJoint<Real> PointJoint;
+		typedef dyno::BallAndSocketJoint<Real> BallAndSocketJoint;
+		typedef dyno::SliderJoint<Real> SliderJoint;
+		typedef dyno::HingeJoint<Real> HingeJoint;
+		typedef dyno::FixedJoint<Real> FixedJoint;
+		typedef dyno::PointJoint<Real> PointJoint;
 
 		DiscreteElements();
 		~DiscreteElements() override;
@@ -502,6 +502,9 @@ namespace dyno
 		DArray<int>&		getTetBodyMapping() { return m_tet_body_mapping; }
 		DArray<TopologyModule::Tetrahedron>& getTetElementMapping() { return m_tet_element_id; }
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 	protected:
 		DArray<Sphere3D> m_spheres;
 		DArray<Box3D> m_boxes;
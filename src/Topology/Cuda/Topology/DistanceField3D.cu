@@ -1,5 +1,7 @@
 #include <fstream>
 #include "DistanceField3D.h"
+#include "SignedDistanceFile.h"
+#include "Log.h"
 #include "Vector.h"
 #include "DataTypes.h"
 
@@ -232,10 +234,10 @@ namespace dyno{
 		m_h[1] *= s;
 		m_h[2] *= s;
 
-		dim3 blockSize = make_uint3(8, 8, 8);
-		dim3 gridDims = cudaGridSize3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()), blockSize);
-
-		K_Scale << <gridDims, blockSize >> >(m_distance, s);
+		cuExecute3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()),
+			K_Scale,
+			m_distance,
+			s);
 	}
 
 	template<typename Real>
@@ -255,10 +257,9 @@ namespace dyno{
 	template<typename TDataType>
 	void DistanceField3D<TDataType>::invertSDF()
 	{
-		dim3 blockSize = make_uint3(8, 8, 8);
-		dim3 gridDims = cudaGridSize3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()), blockSize);
-
-		K_Invert << <gridDims, blockSize >> >(m_distance);
+		cuExecute3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()),
+			K_Invert,
+			m_distance);
 	}
 
 	template <typename Real, typename Coord>
@@ -283,10 +284,14 @@ namespace dyno{
 	{
 		m_bInverted = inverted;
 
-		dim3 blockSize = make_uint3(4, 4, 4);
-		dim3 gridDims = cudaGridSize3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()), blockSize);
-
-		K_DistanceFieldToBox << <gridDims, blockSize >> >(m_distance, m_left, m_h, lo, hi, inverted);
+		cuExecute3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()),
+			K_DistanceFieldToBox,
+			m_distance,
+			m_left,
+			m_h,
+			lo,
+			hi,
+			inverted);
 	}
 
 	template <typename Real, typename Coord>
@@ -312,10 +317,16 @@ namespace dyno{
 	{
 		m_bInverted = inverted;
 
-		dim3 blockSize = make_uint3(8, 8, 8);
-		dim3 gridDims = cudaGridSize3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()), blockSize);
-
-		K_DistanceFieldToCylinder << <gridDims, blockSize >> >(m_distance, m_left, m_h, center, radius, height, axis, inverted);
+		cuExecute3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()),
+			K_DistanceFieldToCylinder,
+			m_distance,
+			m_left,
+			m_h,
+			center,
+			radius,
+			height,
+			axis,
+			inverted);
 	}
 
 	template <typename Real, typename Coord>
@@ -343,60 +354,31 @@ namespace dyno{
 	{
 		m_bInverted = inverted;
 
-		dim3 blockSize = make_uint3(8, 8, 8);
-		dim3 gridDims = cudaGridSize3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()), blockSize);
-
-		K_DistanceFieldToSphere << <gridDims, blockSize >> >(m_distance, m_left, m_h, center, radius, inverted);
+		cuExecute3D(make_uint3(m_distance.nx(), m_distance.ny(), m_distance.nz()),
+			K_DistanceFieldToSphere,
+			m_distance,
+			m_left,
+			m_h,
+			center,
+			radius,
+			inverted);
 	}
 
 	template<typename TDataType>
-	void DistanceField3D<TDataType>::loadSDF(std::string filename, bool inverted)
+	bool DistanceField3D<TDataType>::loadSDF(std::string filename, bool inverted)
 	{
-		std::ifstream input(filename.c_str(), std::ios::in);
-		if (!input.is_open())
-		{
-			std::cout << "Reading file " << filename << " error!" << std::endl;
-			exit(0);
-		}
+		CArray3D<Real> distances;
+		Vec3d origin, spacing;
+		if (!SignedDistanceFile::load(filename, distances, origin, spacing))
+			return false;
 
-		int nbx, nby, nbz;
-		int xx, yy, zz;
-
-		input >> xx;
-		input >> yy;
-		input >> zz;
-
-		input >> m_left[0];
-		input >> m_left[1];
-		input >> m_left[2];
-
-		Real t_h;
-		input >> t_h;
-
-		std::cout << "SDF: " << xx << ", " << yy << ", " << zz << std::endl;
-		std::cout << "SDF: " << m_left[0] << ", " << m_left[1] << ", " << m_left[2] << std::endl;
-		std::cout << "SDF: " << m_left[0] + t_h*xx << ", " << m_left[1] + t_h*yy << ", " << m_left[2] + t_h*zz << std::endl;
-
-		nbx = xx;
-		nby = yy;
-		nbz = zz;
-		m_h[0] = t_h;
-		m_h[1] = t_h;
-		m_h[2] = t_h;
-
-		CArray3D<Real> distances(nbx, nby, nbz);
-		for (int k = 0; k < zz; k++) {
-			for (int j = 0; j < yy; j++) {
-				for (int i = 0; i < xx; i++) {
-					float dist;
-					input >> dist;
-					distances(i, j, k) = dist;
-				}
-			}
-		}
-		input.close();
+		m_left = Coord(origin[0], origin[1], origin[2]);
+		m_h = Coord(spacing[0], spacing[1], spacing[2]);
 
-		m_distance.resize(nbx, nby, nbz);
+		Log::sendMessage(Log::Info, "SDF " + filename + ": " + std::to_string(distances.nx()) + " x " + std::to_string(distances.ny()) + " x " + std::to_string(distances.nz())
+			+ " cells from (" + std::to_string(m_left[0]) + ", " + std::to_string(m_left[1]) + ", " + std::to_string(m_left[2]) + ")");
+
+		m_distance.resize(distances.nx(), distances.ny(), distances.nz());
 		m_distance.assign(distances);
 
 		m_bInverted = inverted;
@@ -405,7 +387,19 @@ namespace dyno{
 			invertSDF();
 		}
 
-		std::cout << "read data successful" << std::endl;
+		return true;
+	}
+
+	template<typename TDataType>
+	bool DistanceField3D<TDataType>::saveSDF(std::string filename, uint brickSize)
+	{
+		CArray3D<Real> distances;
+		distances.assign(m_distance);
+
+		Vec3d origin(m_left[0], m_left[1], m_left[2]);
+		Vec3d spacing(m_h[0], m_h[1], m_h[2]);
+
+		return SignedDistanceFile::save(filename, distances, origin, spacing, brickSize);
 	}
 
 	template<typename TDataType>
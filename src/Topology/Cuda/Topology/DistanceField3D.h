@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <cmath>
 #include "Platform.h"
 #include "Array/Array3D.h"
 
@@ -68,12 +69,20 @@ namespace dyno {
 
 	public:
 		/**
-		 * @brief load signed distance field from a file
+		 * @brief load signed distance field from a file, either in the text or the binary format of SignedDistanceFile
 		 * 
 		 * @param filename 
 		 * @param inverted indicated whether the signed distance field should be inverted after initialization
+		 * @return false if the file can not be read, the distance field is left unchanged
 		 */
-		void loadSDF(std::string filename, bool inverted = false);
+		bool loadSDF(std::string filename, bool inverted = false);
+
+		/**
+		 * @brief save the signed distance field in the binary format of SignedDistanceFile
+		 *
+		 * @param brickSize edge length of compressed bricks, 0 disables compression
+		 */
+		bool saveSDF(std::string filename, uint brickSize = 8);
 
 		void loadBox(Coord& lo, Coord& hi, bool inverted = false);
 
@@ -1,6 +1,7 @@
 #include "EdgeSet.h"
 #include <vector>
 #include "Array/ArrayList.h"
+#include "BinaryStream.h"
 
 #include <thrust/sort.h>
 
@@ -79,6 +80,7 @@ namespace dyno
 		mEdges.assign(edgeSet.mEdges);
 
 		mVer2Edge.assign(edgeSet.mVer2Edge);
+		mEdgeVersion.invalidate();
 
 		PointSet<TDataType>::copyFrom(edgeSet);
 	}
@@ -133,25 +135,28 @@ namespace dyno
 	{
 		this->updateEdges();
 
-		//Update the vertex to edge mapping
-		DArray<uint> counter;
-		counter.resize(this->mCoords.size());
-		counter.reset();
+		//The vertex to edge mapping only has to be rebuilt if the edges or the number of vertices have changed
+		if (mEdgeVersion.update(mEdges, this->mCoords.size()))
+		{
+			DArray<uint> counter;
+			counter.resize(this->mCoords.size());
+			counter.reset();
 
-		cuExecute(mEdges.size(),
-			ES_CountEdges,
-			counter,
-			mEdges);
+			cuExecute(mEdges.size(),
+				ES_CountEdges,
+				counter,
+				mEdges);
 
-		mVer2Edge.resize(counter);
+			mVer2Edge.resize(counter);
 
-		counter.reset();
-		cuExecute(mEdges.size(),
-			ES_SetupEdgeIds,
-			mVer2Edge,
-			mEdges);
+			counter.reset();
+			cuExecute(mEdges.size(),
+				ES_SetupEdgeIds,
+				mVer2Edge,
+				mEdges);
 
-		counter.clear();
+			counter.clear();
+		}
 
 		PointSet<TDataType>::updateTopology();
 	}
@@ -167,9 +172,30 @@ namespace dyno
 	{
 		mEdges.clear();
 		mVer2Edge.clear();
+		mEdgeVersion.clear();
 
 		PointSet<TDataType>::clear();
 	}
 
+	template<typename TDataType>
+	bool EdgeSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!PointSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, mEdges);
+	}
+
+	template<typename TDataType>
+	bool EdgeSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!PointSet<TDataType>::readBinary(in) || !readBinaryArray(in, mEdges))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(EdgeSet);
 }
\ No newline at end of file
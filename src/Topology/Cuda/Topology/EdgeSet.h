@@ -15,6 +15,7 @@
  */
 #pragma once
 #include "PointSet.h"
+#include "ConnectivityVersion.h"
 
 namespace dyno
 {
@@ -125,12 +126,20 @@ namespace dyno
 		 */
 		DArrayList<int>& vertex2Edge() { return mVer2Edge; }
 
+		/**
+		 * @brief A counter increased by update() whenever the connectivity has changed since the last update
+		 */
+		virtual uint connectivityVersion() { return mEdgeVersion.version(); }
+
 		void copyFrom(EdgeSet<TDataType>& edgeSet);
 
 		bool isEmpty() override;
 
 		void clear() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		//TODO:
 		void loadSmeshFile(std::string filename) {};
 
@@ -149,6 +158,9 @@ namespace dyno
 		 * Map vertex id to edge id
 		 */
 		DArrayList<int> mVer2Edge;
+
+		//Version of the edges mVer2Edge was built from
+		ConnectivityVersion<Edge> mEdgeVersion;
 	};
 }
 
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "BinaryStream.h"
+
 #include <thrust/sort.h>
 
 namespace dyno
@@ -277,5 +279,25 @@ namespace dyno
 		QuadSet<TDataType>::copyFrom(hexSet);
 	}
 
+	template<typename TDataType>
+	bool HexahedronSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!QuadSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, m_hexahedrons);
+	}
+
+	template<typename TDataType>
+	bool HexahedronSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!QuadSet<TDataType>::readBinary(in) || !readBinaryArray(in, m_hexahedrons))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(HexahedronSet);
 }
\ No newline at end of file
@@ -28,6 +28,9 @@ namespace dyno
 
 		void copyFrom(HexahedronSet<TDataType> hexSet);
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 	protected:
 		void updateQuads() override;
 
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "BinaryStream.h"
+
 namespace dyno
 {
 	IMPLEMENT_TCLASS(PointSet, TDataType)
@@ -226,5 +228,22 @@ namespace dyno
 		mCoords.clear();
 	}
 
+	template<typename TDataType>
+	bool PointSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		return writeBinaryArray(out, mCoords);
+	}
+
+	template<typename TDataType>
+	bool PointSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!readBinaryArray(in, mCoords))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(PointSet);
 }
\ No newline at end of file
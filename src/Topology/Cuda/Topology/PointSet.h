@@ -64,6 +64,9 @@ namespace dyno
 
 		virtual void clear();
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		/**
 		 * @brief Return the array of points
 		 */
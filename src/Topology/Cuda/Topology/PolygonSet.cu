@@ -1,4 +1,5 @@
 #include "PolygonSet.h"
+#include "BinaryStream.h"
 
 #include <thrust/sort.h>
 
@@ -82,7 +83,7 @@ namespace dyno
 	template<typename TDataType>
 	void PolygonSet<TDataType>::updateTopology()
 	{
-		uint vNum = mCoords.size();
+		uint vNum = this->mCoords.size();
 
 		//Update the vertex to polygon mapping
 		DArray<uint> counter(vNum);
@@ -220,12 +221,12 @@ namespace dyno
 		int uniqueNum = thrust::reduce(thrust::device, uniqueEdgeCounter.begin(), uniqueEdgeCounter.begin() + uniqueEdgeCounter.size());
 		thrust::exclusive_scan(thrust::device, uniqueEdgeCounter.begin(), uniqueEdgeCounter.begin() + uniqueEdgeCounter.size(), uniqueEdgeCounter.begin());
 
-		mEdges.resize(uniqueNum);
+		this->mEdges.resize(uniqueNum);
 		mEdg2Poly.resize(uniqueNum);
 
 		cuExecute(edgeKeys.size(),
 			PolygonSet_SetupEdgeIndices,
-			mEdges,
+			this->mEdges,
 			mPoly2Edg,
 			mEdg2Poly,
 			edgeKeys,
@@ -241,8 +242,8 @@ namespace dyno
 	template<typename TDataType>
 	void PolygonSet<TDataType>::extractEdgeSet(EdgeSet<TDataType>& es)
 	{
-		es.setPoints(mCoords);
-		es.setEdges(mEdges);
+		es.setPoints(this->mCoords);
+		es.setEdges(this->mEdges);
 
 		es.update();
 	}
@@ -305,7 +306,7 @@ namespace dyno
 			mPolygonIndex,
 			radix);
 
-		ts.setPoints(mCoords);
+		ts.setPoints(this->mCoords);
 		ts.setTriangles(triangleIndices);
 		ts.update();
 
@@ -372,7 +373,7 @@ namespace dyno
 			mPolygonIndex,
 			radix);
 
-		qs.setPoints(mCoords);
+		qs.setPoints(this->mCoords);
 		qs.setQuads(quadIndices);
 		qs.update();
 
@@ -438,7 +439,7 @@ namespace dyno
 			mPolygonIndex,
 			radix);
 
-		ts.setPoints(mCoords);
+		ts.setPoints(this->mCoords);
 		ts.setTriangles(triangleIndex);
 		ts.update();
 
@@ -446,5 +447,25 @@ namespace dyno
 		triangleIndex.clear();
 	}
 
+	template<typename TDataType>
+	bool PolygonSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!EdgeSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, mPolygonIndex);
+	}
+
+	template<typename TDataType>
+	bool PolygonSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!EdgeSet<TDataType>::readBinary(in) || !readBinaryArray(in, mPolygonIndex))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(PolygonSet);
 }
\ No newline at end of file
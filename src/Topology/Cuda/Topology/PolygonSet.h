@@ -59,6 +59,9 @@ namespace dyno
 
 		bool isEmpty() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		/**
 		 * @brief extract and merge edges from all polygons into one EdgeSet
 		 */
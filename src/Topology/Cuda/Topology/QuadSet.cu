@@ -3,6 +3,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "BinaryStream.h"
+
 #include <thrust/sort.h>
 
 namespace dyno
@@ -287,5 +289,25 @@ namespace dyno
 			vert2Quad);
 	}
 
+	template<typename TDataType>
+	bool QuadSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!EdgeSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, mQuads);
+	}
+
+	template<typename TDataType>
+	bool QuadSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!EdgeSet<TDataType>::readBinary(in) || !readBinaryArray(in, mQuads))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(QuadSet);
 }
\ No newline at end of file
@@ -120,6 +120,9 @@ namespace dyno
 		
 		bool isEmpty() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 	public:
 		DEF_ARRAY_OUT(Coord, VertexNormal, DeviceType::GPU, "");
 
@@ -0,0 +1,360 @@
+#include "SignedDistanceFile.h"
+#include "MappedFile.h"
+#include "Log.h"
+
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace dyno
+{
+	static const char SdfMagic[8] = { 'D', 'Y', 'N', 'O', 'S', 'D', 'F', '\0' };
+	static const uint32_t SdfVersion = 1;
+
+	enum BrickType : uint8_t
+	{
+		RawBrick = 0,
+		UniformBrick = 1
+	};
+
+	/**
+	 * @brief Read whitespace separated numbers from a buffer which is not null-terminated
+	 */
+	class TokenReader
+	{
+	public:
+		TokenReader(const char* begin, const char* end) : mCur(begin), mEnd(end) {}
+
+		size_t remaining() const { return mEnd - mCur; }
+
+		bool next(double& val)
+		{
+			while (mCur < mEnd && isSpace(*mCur))
+				mCur++;
+
+			const char* start = mCur;
+			while (mCur < mEnd && !isSpace(*mCur))
+				mCur++;
+
+			size_t len = mCur - start;
+			if (len == 0 || len >= sizeof(mToken))
+				return false;
+
+			memcpy(mToken, start, len);
+			mToken[len] = '\0';
+
+			char* last = nullptr;
+			val = strtod(mToken, &last);
+			return last == mToken + len;
+		}
+
+	private:
+		static bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+		const char* mCur;
+		const char* mEnd;
+
+		char mToken[64];
+	};
+
+	/**
+	 * @brief Check the grid is not empty and holds at most maxCells cells, the product is computed without overflow
+	 */
+	static bool validDimensions(uint64_t nx, uint64_t ny, uint64_t nz, uint64_t maxCells)
+	{
+		if (nx == 0 || ny == 0 || nz == 0)
+			return false;
+
+		// The cells are addressed with uint
+		uint64_t limit = std::min<uint64_t>(maxCells, std::numeric_limits<uint>::max());
+		return nx <= limit && ny <= limit / nx && nz <= limit / (nx * ny);
+	}
+
+	template<typename Real>
+	static bool loadText(const MappedFile& file, CArray3D<Real>& distances, Vec3d& origin, Vec3d& spacing)
+	{
+		TokenReader reader(file.data(), file.data() + file.size());
+
+		double dims[3], h;
+		for (int i = 0; i < 3; i++)
+		{
+			if (!reader.next(dims[i]) || dims[i] < 1 || dims[i] > std::numeric_limits<uint>::max() || dims[i] != std::floor(dims[i]))
+				return false;
+		}
+
+		for (int i = 0; i < 3; i++)
+		{
+			if (!reader.next(origin[i]))
+				return false;
+		}
+
+		if (!reader.next(h))
+			return false;
+
+		spacing = Vec3d(h);
+
+		// Every distance takes at least one character and a separator
+		if (!validDimensions((uint64_t)dims[0], (uint64_t)dims[1], (uint64_t)dims[2], (reader.remaining() + 1) / 2))
+			return false;
+
+		distances.resize((uint)dims[0], (uint)dims[1], (uint)dims[2]);
+
+		Real* ptr = distances.handle()->data();
+		size_t num = distances.size();
+		for (size_t i = 0; i < num; i++)
+		{
+			double d;
+			if (!reader.next(d))
+				return false;
+
+			// The text format has always been read in single precision
+			ptr[i] = (Real)(float)d;
+		}
+
+		return true;
+	}
+
+	template<typename Real>
+	static bool loadBinary(const MappedFile& file, CArray3D<Real>& distances, Vec3d& origin, Vec3d& spacing)
+	{
+		if (file.size() < sizeof(SignedDistanceFile::Header))
+			return false;
+
+		SignedDistanceFile::Header header;
+		memcpy(&header, file.data(), sizeof(header));
+
+		if (header.version != SdfVersion)
+			return false;
+
+		uint nx = header.nx, ny = header.ny, nz = header.nz;
+		uint b = header.brickSize;
+
+		uint64_t remaining = file.size() - sizeof(header);
+		if (b == 0)
+		{
+			if (!validDimensions(nx, ny, nz, remaining / sizeof(float)))
+				return false;
+		}
+		else
+		{
+			// Every brick takes at least its type and one float
+			uint64_t bricks = ((nx + (uint64_t)b - 1) / b) * ((ny + (uint64_t)b - 1) / b) * ((nz + (uint64_t)b - 1) / b);
+			if (!validDimensions(nx, ny, nz, std::numeric_limits<uint>::max()) || bricks > remaining / (sizeof(uint8_t) + sizeof(float)))
+				return false;
+		}
+
+		origin = Vec3d(header.origin[0], header.origin[1], header.origin[2]);
+		spacing = Vec3d(header.spacing[0], header.spacing[1], header.spacing[2]);
+
+		distances.resize(nx, ny, nz);
+
+		const char* cur = file.data() + sizeof(header);
+		const char* end = file.data() + file.size();
+
+		Real* dst = distances.handle()->data();
+
+		if (b == 0)
+		{
+			size_t num = distances.size();
+			if ((size_t)(end - cur) < num * sizeof(float))
+				return false;
+
+			if (sizeof(Real) == sizeof(float))
+			{
+				memcpy(dst, cur, num * sizeof(float));
+			}
+			else
+			{
+				const float* src = reinterpret_cast<const float*>(cur);
+				for (size_t i = 0; i < num; i++)
+					dst[i] = (Real)src[i];
+			}
+
+			return true;
+		}
+
+		// The ends are computed as begin + min(b, n - begin) so that they never overflow
+		for (uint bk = 0, ek = 0; bk < nz; bk = ek)
+		{
+			ek = bk + std::min(b, nz - bk);
+			for (uint bj = 0, ej = 0; bj < ny; bj = ej)
+			{
+				ej = bj + std::min(b, ny - bj);
+				for (uint bi = 0, ei = 0; bi < nx; bi = ei)
+				{
+					ei = bi + std::min(b, nx - bi);
+
+					if (cur >= end)
+						return false;
+
+					uint8_t type = (uint8_t)*cur++;
+					if (type == UniformBrick)
+					{
+						if ((size_t)(end - cur) < sizeof(float))
+							return false;
+
+						float val;
+						memcpy(&val, cur, sizeof(float));
+						cur += sizeof(float);
+
+						for (uint k = bk; k < ek; k++)
+							for (uint j = bj; j < ej; j++)
+								for (uint i = bi; i < ei; i++)
+									dst[distances.index(i, j, k)] = (Real)val;
+					}
+					else if (type == RawBrick)
+					{
+						size_t rowLen = ei - bi;
+						if ((size_t)(end - cur) < rowLen * (ej - bj) * (ek - bk) * sizeof(float))
+							return false;
+
+						for (uint k = bk; k < ek; k++)
+						{
+							for (uint j = bj; j < ej; j++)
+							{
+								for (uint i = bi; i < ei; i++)
+								{
+									float val;
+									memcpy(&val, cur, sizeof(float));
+									cur += sizeof(float);
+
+									dst[distances.index(i, j, k)] = (Real)val;
+								}
+							}
+						}
+					}
+					else
+						return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	template<typename Real>
+	bool SignedDistanceFile::load(const std::string& filename, CArray3D<Real>& distances, Vec3d& origin, Vec3d& spacing)
+	{
+		MappedFile file;
+		if (!file.open(filename))
+		{
+			Log::sendMessage(Log::Error, "Reading file " + filename + " error!");
+			return false;
+		}
+
+		bool binary = file.size() >= sizeof(SdfMagic) && memcmp(file.data(), SdfMagic, sizeof(SdfMagic)) == 0;
+
+		bool succeeded = binary ? loadBinary(file, distances, origin, spacing) : loadText(file, distances, origin, spacing);
+		if (!succeeded)
+		{
+			Log::sendMessage(Log::Error, "File " + filename + " is not a valid signed distance field!");
+			distances.clear();
+		}
+
+		return succeeded;
+	}
+
+	template<typename Real>
+	bool SignedDistanceFile::save(const std::string& filename, const CArray3D<Real>& distances, const Vec3d& origin, const Vec3d& spacing, uint brickSize)
+	{
+		std::ofstream output(filename.c_str(), std::ios::out | std::ios::binary);
+		if (!output.is_open())
+			return false;
+
+		Header header;
+		memcpy(header.magic, SdfMagic, sizeof(SdfMagic));
+		header.version = SdfVersion;
+		header.nx = distances.nx();
+		header.ny = distances.ny();
+		header.nz = distances.nz();
+		header.brickSize = brickSize;
+		header.reserved = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			header.origin[i] = origin[i];
+			header.spacing[i] = spacing[i];
+		}
+
+		output.write((const char*)&header, sizeof(header));
+
+		uint nx = header.nx, ny = header.ny, nz = header.nz;
+
+		if (brickSize == 0)
+		{
+			std::vector<float> values(distances.size());
+			for (size_t i = 0; i < values.size(); i++)
+				values[i] = (float)distances[(uint)i];
+
+			output.write((const char*)values.data(), values.size() * sizeof(float));
+
+			return output.good();
+		}
+
+		std::vector<float> brick;
+		brick.reserve((size_t)brickSize * brickSize * brickSize);
+
+		uint b = brickSize;
+		for (uint bk = 0; bk < nz; bk += b)
+		{
+			for (uint bj = 0; bj < ny; bj += b)
+			{
+				for (uint bi = 0; bi < nx; bi += b)
+				{
+					brick.clear();
+
+					bool uniform = true;
+					for (uint k = bk; k < std::min(bk + b, nz); k++)
+					{
+						for (uint j = bj; j < std::min(bj + b, ny); j++)
+						{
+							for (uint i = bi; i < std::min(bi + b, nx); i++)
+							{
+								float val = (float)distances(i, j, k);
+
+								// Compare bit patterns so that the compression is lossless
+								uniform = uniform && (brick.empty() || memcmp(&val, &brick[0], sizeof(float)) == 0);
+								brick.push_back(val);
+							}
+						}
+					}
+
+					uint8_t type = uniform ? UniformBrick : RawBrick;
+					output.write((const char*)&type, sizeof(type));
+					output.write((const char*)brick.data(), (uniform ? 1 : brick.size()) * sizeof(float));
+				}
+			}
+		}
+
+		return output.good();
+	}
+
+	bool SignedDistanceFile::convert(const std::string& textFile, const std::string& binaryFile, uint brickSize)
+	{
+		CArray3D<float> distances;
+		Vec3d origin, spacing;
+		if (!load(textFile, distances, origin, spacing))
+			return false;
+
+		return save(binaryFile, distances, origin, spacing, brickSize);
+	}
+
+	bool SignedDistanceFile::isBinary(const std::string& filename)
+	{
+		std::ifstream input(filename.c_str(), std::ios::in | std::ios::binary);
+
+		char magic[sizeof(SdfMagic)];
+		input.read(magic, sizeof(magic));
+
+		return input.good() && memcmp(magic, SdfMagic, sizeof(SdfMagic)) == 0;
+	}
+
+	template bool SignedDistanceFile::load<float>(const std::string&, CArray3D<float>&, Vec3d&, Vec3d&);
+	template bool SignedDistanceFile::load<double>(const std::string&, CArray3D<double>&, Vec3d&, Vec3d&);
+
+	template bool SignedDistanceFile::save<float>(const std::string&, const CArray3D<float>&, const Vec3d&, const Vec3d&, uint);
+	template bool SignedDistanceFile::save<double>(const std::string&, const CArray3D<double>&, const Vec3d&, const Vec3d&, uint);
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2024 Xiaowei He
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "Vector.h"
+#include "Array/Array3D.h"
+
+#include <string>
+
+namespace dyno
+{
+	/**
+	 * @brief Reading and writing signed distance fields sampled on a uniform grid.
+	 *
+	 *	Two formats are supported:
+	 *	1. The text format: nx ny nz, the origin, the grid spacing and nx*ny*nz distances with x varying fastest.
+	 *	2. The binary format: a Header followed by the distances stored as 32-bit floats.
+	 *	   Without compression the distances are stored in the same order as the text format, so they can be copied directly from the mapped file.
+	 *	   With compression the grid is split into bricks of brickSize^3 cells, bricks holding a single value are stored as one float.
+	 *	   This is lossless and pays off for fields clamped outside of a narrow band.
+	 *
+	 *	Both formats are read through a memory mapping of the file, the format is detected from the first bytes.
+	 */
+	class SignedDistanceFile
+	{
+	public:
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t nx;
+			uint32_t ny;
+			uint32_t nz;
+			uint32_t brickSize;		//!< 0 if the distances are not compressed
+			uint32_t reserved;
+			double origin[3];
+			double spacing[3];
+		};
+
+		/**
+		 * @brief Load a signed distance field in either format
+		 *
+		 * @return false if the file does not exist or is broken
+		 */
+		template<typename Real>
+		static bool load(const std::string& filename, CArray3D<Real>& distances, Vec3d& origin, Vec3d& spacing);
+
+		/**
+		 * @brief Save a signed distance field in the binary format
+		 *
+		 * @param brickSize edge length of bricks, 0 disables compression
+		 */
+		template<typename Real>
+		static bool save(const std::string& filename, const CArray3D<Real>& distances, const Vec3d& origin, const Vec3d& spacing, uint brickSize = 8);
+
+		/**
+		 * @brief Convert a signed distance field from the text format into the binary format
+		 */
+		static bool convert(const std::string& textFile, const std::string& binaryFile, uint brickSize = 8);
+
+		/**
+		 * @brief Return true if the file starts with the binary header
+		 */
+		static bool isBinary(const std::string& filename);
+	};
+}
@@ -1,4 +1,5 @@
 #include "SimplexSet.h"
+#include "BinaryStream.h"
 
 #include <thrust/sort.h>
 
@@ -42,7 +43,17 @@ namespace dyno
 	template<typename TDataType>
 	void SimplexSet<TDataType>::updateTopology()
 	{
+		uint vNum = this->mCoords.size();
 
+		//All buffers are compared so that each keeps its copy up to date
+		bool changed = mEdgeVersion.update(mEdgeIndex, vNum);
+		changed |= mTriangleVersion.update(mTriangleIndex, vNum);
+		changed |= mTetrahedronVersion.update(mTetrahedronIndex, vNum);
+
+		if (changed)
+			mConnectivityVersion++;
+
+		PointSet<TDataType>::updateTopology();
 	}
 
 	template<typename Edge>
@@ -136,12 +147,12 @@ namespace dyno
 
 		DArray<Coord> vertices(vNum);
 		DArray<Edge> edgeIndices(mEdgeIndex.size());
-		DArray<uint> vertexIdMapper(mCoords.size());
+		DArray<uint> vertexIdMapper(this->mCoords.size());
 
 		cuExecute(radix.size(),
 			Simplex_SetupEdgeVertices,
 			vertices,
-			mCoords,
+			this->mCoords,
 			vertexIdMapper,
 			vIds,
 			radix);
@@ -224,12 +235,12 @@ namespace dyno
 
 		DArray<Coord> vertices(vNum);
 		DArray<Triangle> triangleIndex(mTriangleIndex.size());
-		DArray<uint> vertexIdMapper(mCoords.size());
+		DArray<uint> vertexIdMapper(this->mCoords.size());
 
 		cuExecute(radix.size(),
 			Simplex_SetupEdgeVertices,
 			vertices,
-			mCoords,
+			this->mCoords,
 			vertexIdMapper,
 			vIds,
 			radix);
@@ -314,12 +325,12 @@ namespace dyno
 
 		DArray<Coord> vertices(vNum);
 		DArray<Tetrahedron> tetrahedronIndex(mTetrahedronIndex.size());
-		DArray<uint> vertexIdMapper(mCoords.size());
+		DArray<uint> vertexIdMapper(this->mCoords.size());
 
 		cuExecute(radix.size(),
 			Simplex_SetupEdgeVertices,
 			vertices,
-			mCoords,
+			this->mCoords,
 			vertexIdMapper,
 			vIds,
 			radix);
@@ -346,7 +357,7 @@ namespace dyno
 	{
 		ps.clear();
 
-		ps.setPoints(mCoords);
+		ps.setPoints(this->mCoords);
 		ps.update();
 	}
 
@@ -499,7 +510,7 @@ namespace dyno
 			keys,
 			radix);
 
-		es.setPoints(mCoords);
+		es.setPoints(this->mCoords);
 		es.setEdges(distinctEdges);
 		es.update();
 
@@ -515,5 +526,34 @@ namespace dyno
 
 	}
 
+	template<typename TDataType>
+	bool SimplexSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!PointSet<TDataType>::writeBinary(out))
+			return false;
+
+		if (!writeBinaryArray(out, mEdgeIndex))
+			return false;
+
+		if (!writeBinaryArray(out, mTriangleIndex))
+			return false;
+
+		return writeBinaryArray(out, mTetrahedronIndex);
+	}
+
+	template<typename TDataType>
+	bool SimplexSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!PointSet<TDataType>::readBinary(in))
+			return false;
+
+		if (!readBinaryArray(in, mEdgeIndex) || !readBinaryArray(in, mTriangleIndex) || !readBinaryArray(in, mTetrahedronIndex))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(SimplexSet);
 }
\ No newline at end of file
@@ -39,6 +39,9 @@ namespace dyno
 
 		bool isEmpty() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		void setEdgeIndex(const DArray<Edge>& segments) { mEdgeIndex.assign(segments); }
 		void setEdgeIndex(const CArray<Edge>& segments) { mEdgeIndex.assign(segments); }
 
@@ -75,6 +78,12 @@ namespace dyno
 		 */
 		void extractTriangleSet(TriangleSet<TDataType>& ts);
 
+		/**
+		 * @brief A counter increased by update() whenever any of the edge, triangle or tetrahedron indices have changed,
+		 *		sets extracted from the simplexes only have to be extracted again when it changes
+		 */
+		uint connectivityVersion() { return mConnectivityVersion; }
+
 	protected:
 		void updateTopology() override;
 
@@ -82,6 +91,12 @@ namespace dyno
 		DArray<Edge> mEdgeIndex;
 		DArray<Triangle> mTriangleIndex;
 		DArray<Tetrahedron> mTetrahedronIndex;
+
+		ConnectivityVersion<Edge> mEdgeVersion;
+		ConnectivityVersion<Triangle> mTriangleVersion;
+		ConnectivityVersion<Tetrahedron> mTetrahedronVersion;
+
+		uint mConnectivityVersion = 0;
 	};
 }
 
@@ -80,7 +80,7 @@ namespace dyno
 		Real maxL = maximum(abs(maxV.x - minV.x), maximum(abs(maxV.y - minV.y), abs(maxV.z - minV.z)));
 
 		Real segments = m_L / h;
-		m_level_max = std::max(ceil(log2(segments)), Real(2));
+		m_level_max = std::max(Real(ceil(log2(segments))), Real(2));
 
 		m_L = m_h * pow(Real(2), m_level_max);
 
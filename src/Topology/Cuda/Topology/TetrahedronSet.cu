@@ -3,6 +3,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "BinaryStream.h"
+
 #include <thrust/sort.h>
 
 namespace dyno
@@ -279,6 +281,10 @@ namespace dyno
 	template<typename TDataType>
 	void TetrahedronSet<TDataType>::updateTriangles()
 	{
+		//Triangles only have to be extracted again if the tetrahedrons have changed or the triangles have been cleared
+		bool changed = mTetrahedronVersion.update(mTethedrons);
+		if (!changed && (mTethedrons.size() == 0 || this->getTriangles().size() > 0))
+			return;
 
 		uint tetSize = mTethedrons.size();
 
@@ -338,6 +344,8 @@ namespace dyno
 
 		mVer2Tet.assign(tetSet.mVer2Tet);
 
+		mTetrahedronVersion.invalidate();
+
 		TriangleSet<TDataType>::copyFrom(tetSet);
 	}
 
@@ -347,5 +355,25 @@ namespace dyno
 		return mTethedrons.size() && TriangleSet<TDataType>::isEmpty();
 	}
 
+	template<typename TDataType>
+	bool TetrahedronSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!TriangleSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, mTethedrons);
+	}
+
+	template<typename TDataType>
+	bool TetrahedronSet<TDataType>::readBinary(std::istream& in)
+	{
+		if (!TriangleSet<TDataType>::readBinary(in) || !readBinaryArray(in, mTethedrons))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	DEFINE_CLASS(TetrahedronSet);
 }
\ No newline at end of file
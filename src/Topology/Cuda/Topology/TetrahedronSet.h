@@ -31,6 +31,9 @@ namespace dyno
 
 		bool isEmpty() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 	protected:
 		void updateTriangles() override;
 
@@ -40,6 +43,8 @@ namespace dyno
 		DArray<::dyno::TopologyModule::Tri2Tet> mTri2Tet;
 
 		DArrayList<int> mVer2Tet;
+
+		ConnectivityVersion<Tetrahedron> mTetrahedronVersion;
 	};
 }
 
@@ -1,5 +1,7 @@
 #include "TextureMesh.h"
 
+#include "BinaryStream.h"
+
 namespace dyno
 {
 	TextureMesh::TextureMesh()
@@ -17,4 +19,90 @@ namespace dyno
 		mShapes.clear();
 	}
 
+	bool TextureMesh::writeBinary(std::ostream& out)
+	{
+		if (!writeBinaryArray(out, mVertices) || !writeBinaryArray(out, mNormals) || !writeBinaryArray(out, mTexCoords) || !writeBinaryArray(out, mShapeIds))
+			return false;
+
+		writeBinaryValue(out, (uint)mMaterials.size());
+		for (auto& mtl : mMaterials)
+		{
+			writeBinaryValue(out, mtl->baseColor);
+			writeBinaryValue(out, mtl->metallic);
+			writeBinaryValue(out, mtl->roughness);
+			writeBinaryValue(out, mtl->alpha);
+			writeBinaryValue(out, mtl->bumpScale);
+
+			if (!writeBinaryArray(out, mtl->texColor) || !writeBinaryArray(out, mtl->texBump))
+				return false;
+		}
+
+		// Shapes refer to their material by its index, -1 for shapes without a material
+		writeBinaryValue(out, (uint)mShapes.size());
+		for (auto& shape : mShapes)
+		{
+			if (!writeBinaryArray(out, shape->vertexIndex) || !writeBinaryArray(out, shape->normalIndex) || !writeBinaryArray(out, shape->texCoordIndex))
+				return false;
+
+			writeBinaryValue(out, shape->boundingBox);
+			writeBinaryValue(out, shape->boundingTransform);
+
+			auto it = std::find(mMaterials.begin(), mMaterials.end(), shape->material);
+			writeBinaryValue(out, it == mMaterials.end() ? -1 : int(it - mMaterials.begin()));
+		}
+
+		return out.good();
+	}
+
+	bool TextureMesh::readBinary(std::istream& in)
+	{
+		if (!readBinaryArray(in, mVertices) || !readBinaryArray(in, mNormals) || !readBinaryArray(in, mTexCoords) || !readBinaryArray(in, mShapeIds))
+			return false;
+
+		uint mtlNum = 0;
+		if (!readBinaryValue(in, mtlNum))
+			return false;
+
+		mMaterials.clear();
+		for (uint i = 0; i < mtlNum; i++)
+		{
+			auto mtl = std::make_shared<Material>();
+			readBinaryValue(in, mtl->baseColor);
+			readBinaryValue(in, mtl->metallic);
+			readBinaryValue(in, mtl->roughness);
+			readBinaryValue(in, mtl->alpha);
+			readBinaryValue(in, mtl->bumpScale);
+
+			if (!readBinaryArray(in, mtl->texColor) || !readBinaryArray(in, mtl->texBump))
+				return false;
+
+			mMaterials.push_back(mtl);
+		}
+
+		uint shapeNum = 0;
+		if (!readBinaryValue(in, shapeNum))
+			return false;
+
+		mShapes.clear();
+		for (uint i = 0; i < shapeNum; i++)
+		{
+			auto shape = std::make_shared<Shape>();
+			if (!readBinaryArray(in, shape->vertexIndex) || !readBinaryArray(in, shape->normalIndex) || !readBinaryArray(in, shape->texCoordIndex))
+				return false;
+
+			int mtlId = -1;
+			readBinaryValue(in, shape->boundingBox);
+			readBinaryValue(in, shape->boundingTransform);
+			if (!readBinaryValue(in, mtlId) || mtlId >= (int)mMaterials.size())
+				return false;
+
+			shape->material = mtlId < 0 ? nullptr : mMaterials[mtlId];
+
+			mShapes.push_back(shape);
+		}
+
+		this->tagAsChanged();
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -92,6 +92,9 @@ namespace dyno
 			mShapes.clear();
 		}
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 	private:
 		DArray<Vec3f> mVertices;
 		DArray<Vec3f> mNormals;
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "BinaryStream.h"
+
 #include <thrust/sort.h>
 #define TINYOBJLOADER_IMPLEMENTATION
 #include "tinyobjloader/tiny_obj_loader.h"
@@ -58,6 +60,10 @@ namespace dyno
 	template<typename TDataType>
 	DArrayList<int>& TriangleSet<TDataType>::getVertex2Triangles()
 	{
+		mTriangleVersion.update(mTriangleIndex, this->mCoords.size());
+		if (mVer2TriVersion == mTriangleVersion.version())
+			return mVer2Tri;
+
 		DArray<uint> counter(this->mCoords.size());
 		counter.reset();
 
@@ -76,6 +82,8 @@ namespace dyno
 
 		counter.clear();
 
+		mVer2TriVersion = mTriangleVersion.version();
+
 		return mVer2Tri;
 	}
 
@@ -246,6 +254,11 @@ namespace dyno
 	template<typename TDataType>
 	void TriangleSet<TDataType>::updateEdges()
 	{
+		//Edges are derived from the triangles, only position changes since the last time require no work
+		mTriangleVersion.update(mTriangleIndex, this->mCoords.size());
+		if (mEdg2TriVersion == mTriangleVersion.version())
+			return;
+
 		uint triSize = mTriangleIndex.size();
 
 		DArray<EKey> keys;
@@ -288,6 +301,8 @@ namespace dyno
 		counter.clear();
 		triIds.clear();
 		keys.clear();
+
+		mEdg2TriVersion = mTriangleVersion.version();
 	}
 
 	template<typename TDataType>
@@ -357,6 +372,9 @@ namespace dyno
 		mEdg2Tri.resize(triangleSet.mEdg2Tri.size());
 		mEdg2Tri.assign(triangleSet.mEdg2Tri);
 
+		//The copied caches may be out of date, rebuild them on the next update
+		mTriangleVersion.invalidate();
+
 		EdgeSet<TDataType>::copyFrom(triangleSet);
 	}
 
@@ -425,9 +443,32 @@ namespace dyno
 
 		mVertexNormal.clear();
 
+		mTriangleVersion.clear();
+
 		EdgeSet<TDataType>::clear();
 	}
 
+	template<typename TDataType>
+	bool TriangleSet<TDataType>::writeBinary(std::ostream& out)
+	{
+		if (!EdgeSet<TDataType>::writeBinary(out))
+			return false;
+
+		return writeBinaryArray(out, mTriangleIndex);
+	}
+
+	template<typename TDataType>
+	bool TriangleSet<TDataType>::readBinary(std::istream& in)
+	{
+		// Edges are restored as well, so no edge rebuilding is required before the next update
+		if (!EdgeSet<TDataType>::readBinary(in) || !readBinaryArray(in, mTriangleIndex))
+			return false;
+
+		this->tagAsChanged();
+
+		return true;
+	}
+
 	template<typename Coord, typename Triangle>
 	__global__ void TS_SetupVertexNormals(
 		DArray<Coord> normals,
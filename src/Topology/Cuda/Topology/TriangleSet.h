@@ -116,6 +116,11 @@ namespace dyno
 		DArray<TopologyModule::Tri2Edg>& getTriangle2Edge() { return mTri2Edg; }
 		DArray<TopologyModule::Edg2Tri>& getEdge2Triangle() { return mEdg2Tri; }
 
+		/**
+		 * @brief A counter increased whenever the triangles or the number of vertices have changed, edges and adjacency lists are rebuilt only then
+		 */
+		uint connectivityVersion() override { return mTriangleVersion.version(); }
+
 		void setNormals(DArray<Coord>& normals);
 		DArray<Coord>& getVertexNormals() { return mVertexNormal; }
 
@@ -139,6 +144,9 @@ namespace dyno
 
 		void clear() override;
 
+		bool writeBinary(std::ostream& out) override;
+		bool readBinary(std::istream& in) override;
+
 		//If true, normals will be updated automatically as calling update();
 		void setAutoUpdateNormals(bool b) { bAutoUpdateNormal = b; }
 
@@ -169,6 +177,12 @@ namespace dyno
 		DArray<::dyno::TopologyModule::Tri2Edg> mTri2Edg;
 
 		DArray<Coord> mVertexNormal;
+
+		ConnectivityVersion<Triangle> mTriangleVersion;
+
+		//Versions of the triangles mVer2Tri and the edges including mEdg2Tri were built from
+		uint mVer2TriVersion = 0;
+		uint mEdg2TriVersion = 0;
 	};
 }
 
@@ -122,11 +122,6 @@ namespace dyno
 
 		DArray<uint> counter(gNum);
 
-		kernel("ResetUInt")->flush(
-			vkDispatchSize(gNum, 64),
-			counter.handle(),
-			&VkConstant<uint>(gNum));
-
 		HashGrid grid;
 		grid.lo = lo;
 		grid.nx = nx;
@@ -141,6 +136,14 @@ namespace dyno
 		VkUniform<uint> pUniform;
 		pUniform.setValue(pNum);
 
+		//The sizes of cellIds and nbrIds are read back on the host, the kernels in between are submitted together
+		mRecorder.begin();
+
+		kernel("ResetUInt")->flush(
+			vkDispatchSize(gNum, 64),
+			counter.handle(),
+			&VkConstant<uint>(gNum));
+
 		kernel("CountParticles")->flush(
 			vkDispatchSize(pNum, 64),
 			counter.handle(),
@@ -148,10 +151,14 @@ namespace dyno
 			&uniGrid,
 			&pUniform);
 
+		mRecorder.end();
+
 		DArrayList<uint> cellIds;
 
 		cellIds.resize(*counter.handle());
 
+		mRecorder.begin();
+
 		kernel("ResetUInt")->flush(
 			vkDispatchSize(gNum, 64),
 			counter.handle(),
@@ -201,8 +208,12 @@ namespace dyno
 			&cellIds.mInfo,
 			&pUniform);
 
+		mRecorder.end();
+
 		nbrIds.resize(*nbrCount.handle());
 
+		mRecorder.begin();
+
 		kernel("ResetUInt")->flush(
 			vkDispatchSize(pNum, 64),
 			nbrCount.handle(),
@@ -221,6 +232,8 @@ namespace dyno
 			&cellIds.mInfo,
 			&pUniform);
 
+		mRecorder.end();
+
 // 		CArrayList<uint> hNeighbors;
 // 		hNeighbors.assign(nbrIds);
 
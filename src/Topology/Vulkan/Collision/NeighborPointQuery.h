@@ -16,6 +16,8 @@
 #pragma once
 #include "Module/ComputeModule.h"
 
+#include "VkCommandRecorder.h"
+
 namespace dyno 
 {
 	class NeighborPointQuery : public ComputeModule
@@ -54,5 +56,8 @@ namespace dyno
 
 	private:
 		void requestDynamicNeighborIds();
+
+		//Records the kernels between two host readbacks into one submission
+		VkCommandRecorder mRecorder;
 	};
 }
\ No newline at end of file
@@ -82,6 +82,40 @@ TEST(Array, assign)
 	EXPECT_EQ(cArr[0] == 1, true);
 }
 
+TEST(Array, append)
+{
+	CArray<int> cArr;
+	for (int i = 0; i < 5; i++)
+		cArr.pushBack(i);
+
+	DArray<int> src;
+	src.assign(cArr);
+
+	DArray<int> gArr;
+	gArr.append(src, 3);
+	EXPECT_EQ(gArr.size(), 3);
+	EXPECT_EQ(gArr.capacity(), 4);
+
+	//The buffer grows geometrically and keeps the existing elements
+	gArr.append(src, 4, 1);
+	EXPECT_EQ(gArr.size(), 7);
+	EXPECT_EQ(gArr.capacity(), 8);
+
+	gArr.reserve(100);
+	EXPECT_EQ(gArr.size(), 7);
+	EXPECT_EQ(gArr.capacity(), 128);
+
+	CArray<int> result;
+	result.assign(gArr);
+
+	int expected[7] = { 0, 1, 2, 1, 2, 3, 4 };
+	for (int i = 0; i < 7; i++)
+		EXPECT_EQ(result[i], expected[i]);
+
+	src.clear();
+	gArr.clear();
+}
+
 TEST(ArrayList, Copy)
 {
 	std::vector<std::vector<int>> vvec;
@@ -115,6 +149,63 @@ TEST(ArrayList, Copy)
 	EXPECT_EQ(*iter, 2);
 }
 
+TEST(ArrayList, rebuild)
+{
+	CArray<uint> counts;
+	counts.pushBack(2);
+	counts.pushBack(0);
+	counts.pushBack(3);
+
+	CArrayList<int> cList;
+	cList.rebuild(counts);
+
+	EXPECT_EQ(cList.size(), 3);
+	EXPECT_EQ(cList.elementSize(), 5);
+	EXPECT_EQ(cList.hasLists(), false);
+
+	auto csr = cList.csr();
+	EXPECT_EQ(csr.size(0), 2);
+	EXPECT_EQ(csr.size(1), 0);
+	EXPECT_EQ(csr.size(2), 3);
+
+	for (uint i = 0; i < csr.size(); i++)
+	{
+		for (uint j = 0; j < csr.size(i); j++)
+			csr(i, j) = 10 * i + j;
+	}
+
+	EXPECT_EQ(*csr.begin(2), 20);
+	EXPECT_EQ(*(csr.end(2) - 1), 22);
+
+	//Rebuilding with fewer elements keeps the buffers
+	const int* elements = cList.elements().begin();
+
+	counts[2] = 1;
+	cList.rebuild(counts);
+	EXPECT_EQ(cList.elementSize(), 3);
+	EXPECT_EQ(cList.elements().begin(), elements);
+
+	//The per-list headers are recreated by resize()
+	cList.resize(counts);
+	EXPECT_EQ(cList.hasLists(), true);
+	EXPECT_EQ(cList[2].size(), 0);
+
+	DArray<uint> dCounts;
+	dCounts.assign(counts);
+
+	DArrayList<int> dList;
+	dList.rebuild(dCounts);
+	EXPECT_EQ(dList.size(), 3);
+	EXPECT_EQ(dList.elementSize(), 3);
+	EXPECT_EQ(dList.hasLists(), false);
+
+	dList.resize(dCounts);
+	EXPECT_EQ(dList.hasLists(), true);
+
+	dCounts.clear();
+	dList.clear();
+}
+
 TEST(Array2D, Copy)
 {
 	CArray2D<int> cArr2d;
@@ -3,6 +3,7 @@
 //#include "STL/Pair.h"
 #include "Array/ArrayMap.h"
 #include "Matrix/SparseMatrix.h"
+#include "Matrix/CSRMatrix.h"
 #include <vector>
 #include <map>
 
@@ -90,3 +91,89 @@ TEST(SparseMatrix, CPU)
 
 
 
+TEST(CSRMatrix, assemble)
+{
+	//Duplicated entries are summed up
+	std::vector<CSRMatrix<float>::Triplet> triplets;
+	triplets.push_back(CSRMatrix<float>::Triplet(1, 2, 1.0f));
+	triplets.push_back(CSRMatrix<float>::Triplet(0, 1, 2.0f));
+	triplets.push_back(CSRMatrix<float>::Triplet(1, 0, 3.0f));
+	triplets.push_back(CSRMatrix<float>::Triplet(1, 2, 4.0f));
+
+	CSRMatrix<float> A;
+	A.assign(3, 3, triplets);
+
+	EXPECT_EQ(A.nonZeros(), 3);
+	EXPECT_EQ(A.entry(1, 2), 5.0f);
+	EXPECT_EQ(A.entry(2, 2), 0.0f);
+	EXPECT_EQ(A.indices()[1] < A.indices()[2], true);
+
+	CArray<float> x(3);
+	x[0] = 1.0f; x[1] = 2.0f; x[2] = 3.0f;
+
+	CArray<float> y;
+	multiply_SM_by_vector(A, x, y);
+	EXPECT_EQ(y[0], 4.0f);
+	EXPECT_EQ(y[1], 18.0f);
+	EXPECT_EQ(y[2], 0.0f);
+
+	multiply_transposedSM_by_vector(A, x, y);
+	EXPECT_EQ(y[0], 6.0f);
+	EXPECT_EQ(y[1], 2.0f);
+	EXPECT_EQ(y[2], 10.0f);
+}
+
+TEST(CSRMatrix, solve)
+{
+	//A diagonally dominant tridiagonal matrix, large enough to be split into several chunks
+	uint n = 20000;
+	std::vector<CSRMatrix<double>::Triplet> triplets;
+	for (uint i = 0; i < n; i++)
+	{
+		triplets.push_back(CSRMatrix<double>::Triplet(i, i, 4.0));
+		if (i > 0) triplets.push_back(CSRMatrix<double>::Triplet(i, i - 1, -1.0));
+		if (i + 1 < n) triplets.push_back(CSRMatrix<double>::Triplet(i, i + 1, -1.0));
+	}
+
+	CSRMatrix<double> A;
+	A.assign(n, n, triplets);
+
+	CArray<double> expected(n);
+	for (uint i = 0; i < n; i++)
+		expected[i] = std::sin(0.001 * i);
+
+	CArray<double> b;
+	A.multiply(expected, b);
+
+	CArray<double> x;
+	A.CG(b, x, 2 * n, 1e-12);
+
+	double err = 0;
+	for (uint i = 0; i < n; i++)
+		err = std::max(err, std::abs(x[i] - expected[i]));
+
+	EXPECT_EQ(err < 1e-6, true);
+
+	//The block version solves three decoupled copies of the system
+	std::vector<BSRMatrix3<double>::Triplet> blocks;
+	for (uint i = 0; i < triplets.size(); i++)
+		blocks.push_back(BSRMatrix3<double>::Triplet(triplets[i].row, triplets[i].col, Mat3d::identityMatrix() * triplets[i].value));
+
+	BSRMatrix3<double> B;
+	B.assign(n, n, blocks);
+
+	CArray<Vec3d> bb(n);
+	for (uint i = 0; i < n; i++)
+		bb[i] = Vec3d(b[i], -b[i], 2 * b[i]);
+
+	CArray<Vec3d> xx;
+	B.CGLS(bb, xx, 10, 1e-12);
+
+	B.CG(bb, xx, 2 * n, 1e-12);
+
+	err = 0;
+	for (uint i = 0; i < n; i++)
+		err = std::max(err, (xx[i] - Vec3d(expected[i], -expected[i], 2 * expected[i])).norm());
+
+	EXPECT_EQ(err < 1e-5, true);
+}
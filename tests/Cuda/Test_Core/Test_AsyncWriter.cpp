@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "AsyncWriter.h"
+
+#include <atomic>
+
+using namespace dyno;
+
+TEST(AsyncWriter, order)
+{
+	std::vector<uint> order;
+	{
+		AsyncWriter writer(2);
+		for (uint i = 0; i < 16; i++)
+		{
+			writer.push([&order, i]() { order.push_back(i); });
+		}
+
+		writer.flush();
+		EXPECT_EQ(order.size(), 16u);
+
+		//Pending tasks are finished when the writer is destroyed
+		writer.push([&order]() { order.push_back(16); });
+	}
+
+	bool ordered = order.size() == 17;
+	for (uint i = 0; ordered && i < order.size(); i++)
+		ordered = order[i] == i;
+
+	EXPECT_EQ(ordered, true);
+}
+
+TEST(AsyncWriter, stagingPool)
+{
+	StagingPool<float> pool(2);
+
+	CArray<float>* first = nullptr;
+	{
+		auto a = pool.acquire();
+		auto b = pool.acquire();
+		first = a.get();
+
+		EXPECT_EQ(a.get() != b.get(), true);
+
+		a->resize(100);
+	}
+
+	//Released buffers are reused together with their memory
+	auto c = pool.acquire();
+	auto d = pool.acquire();
+	EXPECT_EQ(c.get() == first || d.get() == first, true);
+	EXPECT_EQ(c->size() + d->size(), 100u);
+
+	//Acquiring blocks until a buffer is released by the writer thread
+	AsyncWriter writer(1);
+	std::atomic<uint> written(0);
+
+	writer.push([c, &written]() { written++; });
+	c = nullptr;
+
+	auto e = pool.acquire();
+	EXPECT_EQ(e != nullptr, true);
+
+	writer.flush();
+	EXPECT_EQ(written.load(), 1u);
+}
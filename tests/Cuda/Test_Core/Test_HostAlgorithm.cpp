@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include "Algorithm/HostScan.h"
+#include "Algorithm/HostReduction.h"
+#include "Algorithm/HostSort.h"
+
+#include <random>
+#include <algorithm>
+
+using namespace dyno;
+
+TEST(HostScan, exclusive)
+{
+	//Large enough to be split into several chunks
+	uint num = 300000;
+
+	CArray<uint> input(num);
+	for (uint i = 0; i < num; i++)
+		input[i] = i % 7;
+
+	CArray<uint> output(num);
+
+	HostScan<uint> scan;
+	scan.exclusive(output, input);
+
+	bool equal = true;
+	uint sum = 0;
+	for (uint i = 0; i < num; i++)
+	{
+		equal = equal && output[i] == sum;
+		sum += input[i];
+	}
+
+	EXPECT_EQ(equal, true);
+
+	scan.exclusive(input);
+	EXPECT_EQ(input[num - 1], output[num - 1]);
+}
+
+TEST(HostReduction, vector)
+{
+	uint num = 200000;
+
+	std::vector<float> scalars(num);
+	std::vector<Vec3f> vectors(num);
+	for (uint i = 0; i < num; i++)
+	{
+		scalars[i] = float(i % 100) - 50.0f;
+		vectors[i] = Vec3f(float(i % 10), -float(i % 20), 1.0f);
+	}
+
+	HostReduction<float> reduce;
+	EXPECT_EQ(reduce.maximum(scalars.data(), num), 49.0f);
+	EXPECT_EQ(reduce.minimum(scalars.data(), num), -50.0f);
+	EXPECT_EQ(reduce.accumulate(scalars.data(), num), -0.5f * num);
+
+	HostReduction<Vec3f> reduceVec;
+	Vec3f hi = reduceVec.maximum(vectors.data(), num);
+	Vec3f lo = reduceVec.minimum(vectors.data(), num);
+	Vec3f avg = reduceVec.average(vectors.data(), num);
+
+	EXPECT_EQ(hi == Vec3f(9.0f, 0.0f, 1.0f), true);
+	EXPECT_EQ(lo == Vec3f(0.0f, -19.0f, 1.0f), true);
+	EXPECT_EQ(avg[2], 1.0f);
+}
+
+TEST(HostSort, sortByKey)
+{
+	uint num = 250000;
+
+	std::mt19937_64 rng(7);
+
+	CArray<uint64> keys(num);
+	CArray<float> values(num);
+	for (uint i = 0; i < num; i++)
+	{
+		//Few distinct keys test the stability, the high bits make the upper passes non-trivial
+		keys[i] = (rng() % 1000) << 40;
+		values[i] = float(i);
+	}
+
+	std::vector<std::pair<uint64, float>> expected(num);
+	for (uint i = 0; i < num; i++)
+		expected[i] = std::make_pair(keys[i], values[i]);
+
+	std::stable_sort(expected.begin(), expected.end(), [](const std::pair<uint64, float>& a, const std::pair<uint64, float>& b) { return a.first < b.first; });
+
+	HostSort<uint64> sorter;
+	sorter.sortByKey(keys, values);
+
+	bool equal = true;
+	for (uint i = 0; i < num; i++)
+		equal = equal && keys[i] == expected[i].first && values[i] == expected[i].second;
+
+	EXPECT_EQ(equal, true);
+
+	CArray<uint> small(5);
+	small[0] = 3; small[1] = 0xFFFFFFFF; small[2] = 0; small[3] = 256; small[4] = 3;
+
+	HostSort<uint> sorter32;
+	sorter32.sort(small);
+	EXPECT_EQ(small[0] == 0 && small[1] == 3 && small[2] == 3 && small[3] == 256 && small[4] == 0xFFFFFFFF, true);
+}
@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+#include "Profiler.h"
+
+#include <fstream>
+#include <filesystem>
+
+using namespace dyno;
+
+TEST(Profiler, zones)
+{
+	Profiler* profiler = Profiler::instance();
+	profiler->setCapacity(16);
+	profiler->setEnabled(true);
+
+	for (int i = 0; i < 4; i++)
+	{
+		PROFILE_ZONE("Frame", Frame);
+		{
+			PROFILE_ZONE("Node", Node);
+		}
+	}
+
+	profiler->setEnabled(false);
+	{
+		PROFILE_ZONE("Ignored", Node);
+	}
+
+	EXPECT_EQ(profiler->size(), 8u);
+
+	auto stats = profiler->statistics();
+	EXPECT_EQ(stats.size(), 2u);
+	for (auto& s : stats)
+	{
+		EXPECT_EQ(s.count, 4u);
+		EXPECT_EQ(s.min <= s.mean && s.mean <= s.max, true);
+		EXPECT_EQ(s.p95 <= s.max, true);
+	}
+
+	std::string path = (std::filesystem::temp_directory_path() / "dyno_profile_trace.json").string();
+	EXPECT_EQ(profiler->exportChromeTrace(path), true);
+
+	std::string content;
+	{
+		std::ifstream input(path);
+		content.assign((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+	}
+	EXPECT_EQ(content.find("\"cat\":\"Node\"") != std::string::npos, true);
+
+	std::filesystem::remove(path);
+}
+
+TEST(Profiler, ringBuffer)
+{
+	Profiler* profiler = Profiler::instance();
+	profiler->setCapacity(4);
+	profiler->setEnabled(true);
+
+	for (int i = 0; i < 10; i++)
+	{
+		PROFILE_ZONE("Module", Module);
+	}
+
+	profiler->setEnabled(false);
+
+	EXPECT_EQ(profiler->size(), 4u);
+	EXPECT_EQ(profiler->statistics()[0].count, 4u);
+
+	profiler->clear();
+	EXPECT_EQ(profiler->size(), 0u);
+}
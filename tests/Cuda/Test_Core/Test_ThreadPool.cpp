@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+
+using namespace dyno;
+
+TEST(ThreadPool, parallelFor)
+{
+	ThreadPool pool(4);
+
+	std::vector<uint> vals(10000, 0);
+	pool.parallelFor(0, (uint)vals.size(), [&](uint i) {
+		vals[i] = 2 * i;
+	});
+
+	bool correct = true;
+	for (uint i = 0; i < vals.size(); i++)
+		correct &= vals[i] == 2 * i;
+
+	EXPECT_EQ(correct, true);
+}
+
+TEST(ThreadPool, nested)
+{
+	ThreadPool pool(2);
+
+	std::atomic<uint> counter(0);
+	pool.parallelFor(0, 16, [&](uint i) {
+		pool.parallelFor(0, 16, [&](uint j) {
+			counter++;
+		});
+	});
+
+	EXPECT_EQ(counter.load(), 256u);
+}
+
+TEST(ThreadPool, serial)
+{
+	ThreadPool pool(0);
+
+	std::vector<uint> order;
+	pool.parallelFor(0, 8, [&](uint i) {
+		order.push_back(i);
+	});
+
+	EXPECT_EQ(order.size(), 8u);
+	EXPECT_EQ(order[0] == 0 && order[7] == 7, true);
+}
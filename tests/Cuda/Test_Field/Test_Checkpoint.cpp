@@ -0,0 +1,240 @@
+#include "gtest/gtest.h"
+
+#include "Node.h"
+#include "Field.h"
+#include "SceneGraph.h"
+#include "SceneCheckpoint.h"
+
+#include <sstream>
+
+using namespace dyno;
+
+class StateNode : public Node {
+public:
+	StateNode() {};
+	~StateNode() override {};
+
+	DEF_VAR_STATE(Vec3f, Center, Vec3f(0.0f), "");
+
+	DEF_ARRAY_STATE(float, Mass, DeviceType::CPU, "");
+
+	DEF_ARRAY2D_STATE(int, Grid, DeviceType::CPU, "");
+};
+
+TEST(Checkpoint, fields)
+{
+	std::stringstream ss;
+
+	FVar<int> var;
+	var.setValue(42);
+
+	FVar<std::string> str;
+	str.setValue("checkpoint");
+
+	FArray<float, DeviceType::CPU> arr;
+	std::vector<float> vals(1000);
+	for (size_t i = 0; i < vals.size(); i++)
+		vals[i] = 0.5f * i;
+	arr.assign(vals);
+
+	CArray2D<int> grid(3, 4);
+	for (uint i = 0; i < grid.size(); i++)
+		grid[i] = i;
+
+	FArray2D<int, DeviceType::CPU> arr2d;
+	arr2d.assign(grid);
+
+	EXPECT_EQ(var.writeBinary(ss), true);
+	EXPECT_EQ(str.writeBinary(ss), true);
+	EXPECT_EQ(arr.writeBinary(ss), true);
+	EXPECT_EQ(arr2d.writeBinary(ss), true);
+
+	FVar<int> var1;
+	FVar<std::string> str1;
+	FArray<float, DeviceType::CPU> arr1;
+	FArray2D<int, DeviceType::CPU> arr2d1;
+
+	EXPECT_EQ(var1.readBinary(ss), true);
+	EXPECT_EQ(str1.readBinary(ss), true);
+	EXPECT_EQ(arr1.readBinary(ss), true);
+	EXPECT_EQ(arr2d1.readBinary(ss), true);
+
+	EXPECT_EQ(var1.getValue(), 42);
+	EXPECT_EQ(str1.getValue(), std::string("checkpoint"));
+	EXPECT_EQ(*arr1.constDataPtr()->handle() == vals, true);
+
+	auto& grid1 = arr2d1.getData();
+	EXPECT_EQ(grid1.nx(), 3);
+	EXPECT_EQ(grid1.ny(), 4);
+	EXPECT_EQ(*grid1.handle() == *grid.handle(), true);
+}
+
+TEST(Checkpoint, arrayList)
+{
+	CArray<uint> counts;
+	counts.pushBack(2);
+	counts.pushBack(0);
+	counts.pushBack(3);
+
+	CArrayList<int> lists;
+	lists.resize(counts);
+	lists[0].insert(1);
+	lists[0].insert(2);
+	lists[2].insert(3);
+	lists[2].insert(4);
+	lists[2].insert(5);
+
+	std::stringstream ss;
+	EXPECT_EQ(writeBinaryArray(ss, lists), true);
+
+	CArrayList<int> lists1;
+	EXPECT_EQ(readBinaryArray(ss, lists1), true);
+
+	EXPECT_EQ(lists1.size(), 3);
+	EXPECT_EQ(lists1[0].size(), 2);
+	EXPECT_EQ(lists1[1].size(), 0);
+	EXPECT_EQ(lists1[2].size(), 3);
+	EXPECT_EQ(lists1[0][1], 2);
+	EXPECT_EQ(*lists1[2].begin(), 3);
+	EXPECT_EQ(lists1[2][1], 4);
+	EXPECT_EQ(lists1[2].back(), 5);
+
+	//Read lists are full, inserting does not overwrite the next list
+	EXPECT_EQ(lists1[0].insert(6) == nullptr, true);
+	EXPECT_EQ(*lists1[2].begin(), 3);
+}
+
+TEST(Checkpoint, vectorArray)
+{
+	std::vector<Vec3f> points = { Vec3f(1.0f, 2.0f, 3.0f), Vec3f(4.0f, 5.0f, 6.0f) };
+
+	DArray<Vec3f> dPoints;
+	dPoints.assign(points);
+
+	std::stringstream ss;
+	EXPECT_EQ(writeBinaryArray(ss, dPoints), true);
+
+	DArray<Vec3f> dPoints1;
+	EXPECT_EQ(readBinaryArray(ss, dPoints1), true);
+
+	CArray<Vec3f> points1;
+	points1.assign(dPoints1);
+	EXPECT_EQ(points1[1] == points[1], true);
+
+	//Elements owning host memory are not streamed as raw bytes
+	CArray<std::shared_ptr<int>> ptrs;
+	EXPECT_EQ(writeBinaryArray(ss, ptrs), false);
+
+	dPoints.clear();
+	dPoints1.clear();
+}
+
+TEST(Checkpoint, deviceArrayList)
+{
+	std::vector<std::vector<int>> vals = { { 1, 2 }, {}, { 3, 4, 5 } };
+
+	DArrayList<int> lists;
+	lists.assign(vals);
+
+	std::stringstream ss;
+	EXPECT_EQ(writeBinaryArray(ss, lists), true);
+
+	DArrayList<int> lists1;
+	EXPECT_EQ(readBinaryArray(ss, lists1), true);
+
+	CArrayList<int> hLists;
+	hLists.assign(lists1);
+
+	EXPECT_EQ(hLists.size(), 3);
+	EXPECT_EQ(hLists[0].size(), 2);
+	EXPECT_EQ(hLists[1].size(), 0);
+	EXPECT_EQ(hLists[2].size(), 3);
+	EXPECT_EQ(hLists[0][1], 2);
+	EXPECT_EQ(hLists[2].back(), 5);
+
+	lists.clear();
+	lists1.clear();
+}
+
+TEST(Checkpoint, deviceArray3D)
+{
+	CArray3D<int> grid(3, 4, 5);
+	for (uint i = 0; i < grid.size(); i++)
+		grid[i] = i;
+
+	DArray3D<int> dGrid;
+	dGrid.assign(grid);
+
+	std::stringstream ss;
+	EXPECT_EQ(writeBinaryArray(ss, dGrid), true);
+
+	DArray3D<int> dGrid1;
+	EXPECT_EQ(readBinaryArray(ss, dGrid1), true);
+
+	CArray3D<int> grid1;
+	grid1.assign(dGrid1);
+
+	EXPECT_EQ(grid1.nz(), 5);
+	EXPECT_EQ(*grid1.handle() == *grid.handle(), true);
+
+	dGrid.clear();
+	dGrid1.clear();
+}
+
+TEST(Checkpoint, boolArray)
+{
+	CArray<bool> flags;
+	flags.pushBack(true);
+	flags.pushBack(false);
+	flags.pushBack(true);
+
+	std::stringstream ss;
+	EXPECT_EQ(writeBinaryArray(ss, flags), true);
+
+	CArray<bool> flags1;
+	EXPECT_EQ(readBinaryArray(ss, flags1), true);
+	EXPECT_EQ(*flags1.handle() == *flags.handle(), true);
+
+	DArray<bool> dFlags;
+	EXPECT_EQ(writeBinaryArray(ss, dFlags), false);
+}
+
+TEST(Checkpoint, corruptedLength)
+{
+	std::stringstream ss;
+	writeBinaryValue(ss, uint(0xFFFFFFFF));
+	ss << "short";
+
+	std::string str;
+	EXPECT_EQ(readBinaryString(ss, str), false);
+	EXPECT_EQ(str.empty(), true);
+}
+
+TEST(Checkpoint, scene)
+{
+	std::vector<float> mass = { 1.0f, 2.0f, 3.0f };
+
+	auto scn = std::make_shared<SceneGraph>();
+	auto node = scn->addNode(std::make_shared<StateNode>());
+	node->stateCenter()->setValue(Vec3f(1.0f, 2.0f, 3.0f));
+	node->stateMass()->assign(mass);
+	scn->setElapsedTime(1.5f);
+	scn->setFrameNumber(90);
+
+	std::stringstream ss;
+	SceneCheckpoint checkpoint;
+	EXPECT_EQ(checkpoint.write(scn, ss), true);
+
+	auto scn1 = std::make_shared<SceneGraph>();
+	auto node1 = scn1->addNode(std::make_shared<StateNode>());
+
+	EXPECT_EQ(checkpoint.read(scn1, ss), true);
+
+	EXPECT_EQ(scn1->getElapsedTime(), 1.5f);
+	EXPECT_EQ(scn1->getFrameNumber(), 90);
+	EXPECT_EQ(node1->stateCenter()->getValue() == Vec3f(1.0f, 2.0f, 3.0f), true);
+	EXPECT_EQ(*node1->stateMass()->constDataPtr()->handle() == mass, true);
+
+	//Empty states are not checkpointed
+	EXPECT_EQ(node1->stateGrid()->isEmpty(), true);
+}
@@ -3,6 +3,9 @@
 #include "CalculateArea.h"
 #include "FInstance.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace dyno;
 
 TEST(ModuleField, connect)
@@ -44,6 +47,47 @@ TEST(ModuleField, connect)
 // 	EXPECT_EQ(arrField.isEmpty(), true);
 }
 
+TEST(ModuleField, topField)
+{
+	FVar<float> a, b, c;
+	a.setValue(1.0f);
+
+	a.connect(&b);
+	b.connect(&c);
+	EXPECT_EQ(c.getTopField() == &a, true);
+	EXPECT_EQ(c.getValue(), 1.0f);
+
+	//Reconnecting the middle field should update all sinks
+	FVar<float> d;
+	d.setValue(2.0f);
+	d.connect(&b);
+	EXPECT_EQ(b.getTopField() == &d, true);
+	EXPECT_EQ(c.getTopField() == &d, true);
+	EXPECT_EQ(c.getValue(), 2.0f);
+
+	d.disconnect(&b);
+	EXPECT_EQ(b.getTopField() == &b, true);
+	EXPECT_EQ(c.getTopField() == &b, true);
+
+	//Only writes mark the field as modified
+	d.connect(&b);
+	c.tack();
+	EXPECT_EQ(c.isModified(), false);
+
+	d.getValue();
+	b.constDataPtr();
+	EXPECT_EQ(c.isModified(), false);
+
+	d.setValue(3.0f);
+	d.setValue(4.0f);
+	EXPECT_EQ(c.isModified(), true);
+
+	c.tack();
+	EXPECT_EQ(c.isModified(), false);
+
+	d.setValue(5.0f);
+	EXPECT_EQ(c.isModified(), true);
+}
 
 class OA : public Object {
 public:
@@ -61,6 +105,71 @@ private:
 
 };
 
+TEST(ModuleField, concurrentTick)
+{
+	const int sinkNum = 4;
+	const int writerNum = 2;
+	const int tickNum = 20000;
+
+	FVar<int> top;
+	top.setValue(0);
+
+	std::vector<std::shared_ptr<FVar<int>>> sinks;
+	for (int i = 0; i < sinkNum; i++)
+	{
+		sinks.push_back(std::make_shared<FVar<int>>());
+		top.connect(sinks[i].get());
+	}
+
+	std::atomic<uint> ticks(0);
+	std::atomic<int> activeWriters(writerNum);
+	std::atomic<uint> missed(0);
+
+	std::vector<std::thread> threads;
+	for (int w = 0; w < writerNum; w++)
+	{
+		threads.emplace_back([&]() {
+			for (int k = 0; k < tickNum; k++)
+			{
+				top.tick();
+				ticks.fetch_add(1);
+			}
+			activeWriters.fetch_sub(1);
+		});
+	}
+
+	for (int i = 0; i < sinkNum; i++)
+	{
+		threads.emplace_back([&, i]() {
+			while (activeWriters.load() > 0)
+			{
+				sinks[i]->tack();
+
+				//Ticks counted later than writerNum ticks after the tack are started after the tack finished
+				uint start = ticks.load();
+				while (ticks.load() < start + writerNum + 1 && activeWriters.load() == writerNum) {}
+
+				if (ticks.load() >= start + writerNum + 1 && !sinks[i]->isModified())
+					missed.fetch_add(1);
+			}
+		});
+	}
+
+	for (auto& t : threads)
+		t.join();
+
+	EXPECT_EQ(missed.load(), 0u);
+
+	//A tick after all sinks are tacked is seen by all of them
+	for (auto& sink : sinks)
+		sink->tack();
+
+	top.tick();
+
+	for (auto& sink : sinks)
+		EXPECT_EQ(sink->isModified(), true);
+}
+
 TEST(FInstance, connect)
 {
 	FInstance<OA> oA;
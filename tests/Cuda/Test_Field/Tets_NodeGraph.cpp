@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 
 #include "Node.h"
+#include "Action.h"
+#include "SceneGraph.h"
+
+#include <mutex>
+#include <algorithm>
 
 using namespace dyno;
 
@@ -63,3 +68,215 @@ TEST(NodeGraph, construct)
  	EXPECT_EQ(na->sizeOfExportNodes() == 2, true);
  	EXPECT_EQ(nb->sizeOfImportNodes() == 1, true);
 }
+
+TEST(NodeGraph, parallelTraversal)
+{
+	class RecordAct : public Action
+	{
+	public:
+		void process(Node* node) override {
+			std::lock_guard<std::mutex> lock(mtx);
+			order.push_back(node);
+		}
+
+		std::mutex mtx;
+		std::vector<Node*> order;
+	};
+
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+
+	auto na = scn->addNode(std::make_shared<NodeA>());
+	auto nb = scn->addNode(std::make_shared<NodeB>());
+	auto nc = scn->addNode(std::make_shared<NodeC>());
+	auto nd = scn->addNode(std::make_shared<NodeD>());
+
+	na->connect(nd->importAncestor1());
+	nb->connect(nd->importAncestor2s());
+	nc->connect(nd->importAncestor2s());
+	na->connect(nb->importAncestor1());
+
+	scn->markQueueUpdateRequired();
+
+	RecordAct act;
+	scn->traverseForwardInParallel(&act);
+
+	auto position = [&](Node* n) {
+		return std::find(act.order.begin(), act.order.end(), n) - act.order.begin();
+	};
+
+	EXPECT_EQ(act.order.size(), 4u);
+	EXPECT_EQ(position(na.get()) < position(nb.get()), true);
+	EXPECT_EQ(position(nb.get()) < position(nd.get()), true);
+	EXPECT_EQ(position(nc.get()) < position(nd.get()), true);
+}
+
+TEST(NodeGraph, parallelTraversalAfterConnection)
+{
+	class NodeE : public Node {
+	public:
+		DEF_NODE_PORT(NodeD, Ancestor1, "");
+	};
+
+	class RecordAct : public Action
+	{
+	public:
+		void process(Node* node) override {
+			std::lock_guard<std::mutex> lock(mtx);
+			order.push_back(node);
+		}
+
+		std::mutex mtx;
+		std::vector<Node*> order;
+	};
+
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+
+	auto nd = scn->addNode(std::make_shared<NodeD>());
+	auto na = scn->addNode(std::make_shared<NodeA>());
+	auto ne = scn->addNode(std::make_shared<NodeE>());
+
+	na->connect(nd->importAncestor1());
+
+	//Levels are built as {A, E}, {D}
+	RecordAct act0;
+	scn->traverseForwardInParallel(&act0);
+	EXPECT_EQ(act0.order.size(), 3u);
+
+	//E is already placed after D, the order is kept but E should be moved to a deeper level than D
+	nd->connect(ne->importAncestor1());
+
+	RecordAct act1;
+	scn->traverseForwardInParallel(&act1);
+
+	auto position = [&](Node* n) {
+		return std::find(act1.order.begin(), act1.order.end(), n) - act1.order.begin();
+	};
+
+	EXPECT_EQ(act1.order.size(), 3u);
+	EXPECT_EQ(position(na.get()) < position(nd.get()), true);
+	EXPECT_EQ(position(nd.get()) < position(ne.get()), true);
+}
+
+TEST(NodeGraph, incrementalQueue)
+{
+	class RecordAct : public Action
+	{
+	public:
+		void process(Node* node) override {
+			order.push_back(node);
+		}
+
+		std::vector<Node*> order;
+	};
+
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+
+	//Nodes are added in the reverse order of their dependencies
+	auto nd = scn->addNode(std::make_shared<NodeD>());
+	auto nb = scn->addNode(std::make_shared<NodeB>());
+	auto na = scn->addNode(std::make_shared<NodeA>());
+
+	RecordAct act0;
+	scn->traverseForward(&act0);
+	EXPECT_EQ(act0.order.size(), 3u);
+
+	//Connections created after the queue is built should be respected without rebuilding the queue
+	nb->connect(nd->importAncestor2s());
+	na->connect(nb->importAncestor1());
+	na->connect(nd->importAncestor1());
+
+	auto position = [](RecordAct& act, Node* n) {
+		return std::find(act.order.begin(), act.order.end(), n) - act.order.begin();
+	};
+
+	RecordAct act1;
+	scn->traverseForward(&act1);
+	EXPECT_EQ(act1.order.size(), 3u);
+	EXPECT_EQ(position(act1, na.get()) < position(act1, nb.get()), true);
+	EXPECT_EQ(position(act1, nb.get()) < position(act1, nd.get()), true);
+
+	//A node connected before being added
+	auto nc = std::make_shared<NodeC>();
+	nc->connect(nd->importAncestor2s());
+	scn->addNode(nc);
+
+	na->disconnect(nb->importAncestor1());
+	nb->disconnect(nd->importAncestor2s());
+	scn->deleteNode(nb);
+
+	RecordAct act2;
+	scn->traverseForward(&act2);
+	EXPECT_EQ(act2.order.size(), 3u);
+	EXPECT_EQ(position(act2, nb.get()), 3);
+	EXPECT_EQ(position(act2, nc.get()) < position(act2, nd.get()), true);
+	EXPECT_EQ(position(act2, na.get()) < position(act2, nd.get()), true);
+
+	//Only nodes downstream of the root are visited
+	RecordAct act3;
+	scn->traverseForward(na, &act3);
+	EXPECT_EQ(act3.order.size(), 2u);
+	EXPECT_EQ(act3.order[0], na.get());
+	EXPECT_EQ(act3.order[1], nd.get());
+}
+
+TEST(NodeGraph, cyclicConnection)
+{
+	class NodeF : public Node {
+	public:
+		DEF_NODE_PORT(NodeF, Ancestor1, "");
+	};
+
+	class RecordAct : public Action
+	{
+	public:
+		void process(Node* node) override {
+			order.push_back(node);
+		}
+
+		std::vector<Node*> order;
+	};
+
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+
+	auto n0 = scn->addNode(std::make_shared<NodeF>());
+	auto n1 = scn->addNode(std::make_shared<NodeF>());
+	auto n2 = scn->addNode(std::make_shared<NodeF>());
+
+	RecordAct act0;
+	scn->traverseForward(&act0);
+	EXPECT_EQ(act0.order.size(), 3u);
+
+	n2->connect(n1->importAncestor1());
+	n1->connect(n0->importAncestor1());
+
+	//Closes the cycle n0 -> n2 -> n1 -> n0, every node should still be visited exactly once
+	n0->connect(n2->importAncestor1());
+
+	RecordAct act1;
+	scn->traverseForward(&act1);
+	EXPECT_EQ(act1.order.size(), 3u);
+	EXPECT_EQ(std::count(act1.order.begin(), act1.order.end(), n0.get()), 1);
+	EXPECT_EQ(std::count(act1.order.begin(), act1.order.end(), n1.get()), 1);
+	EXPECT_EQ(std::count(act1.order.begin(), act1.order.end(), n2.get()), 1);
+
+	//Once the cycle is broken, the order should respect all remaining edges again
+	n1->disconnect(n0->importAncestor1());
+
+	auto position = [](RecordAct& act, Node* n) {
+		return std::find(act.order.begin(), act.order.end(), n) - act.order.begin();
+	};
+
+	RecordAct act2;
+	scn->traverseForward(&act2);
+	EXPECT_EQ(act2.order.size(), 3u);
+	EXPECT_EQ(position(act2, n0.get()) < position(act2, n2.get()), true);
+	EXPECT_EQ(position(act2, n2.get()) < position(act2, n1.get()), true);
+
+	//Downstream traversals share no visited state with the scene
+	RecordAct act3;
+	scn->traverseForward(n0, &act3);
+	EXPECT_EQ(act3.order.size(), 3u);
+	EXPECT_EQ(act3.order[0], n0.get());
+	EXPECT_EQ(act3.order[1], n2.get());
+	EXPECT_EQ(act3.order[2], n1.get());
+}
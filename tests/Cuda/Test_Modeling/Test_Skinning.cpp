@@ -0,0 +1,239 @@
+#include "gtest/gtest.h"
+
+#include "CompiledSkeleton.h"
+#include "GltfFunc.h"
+
+#include <cmath>
+
+using namespace dyno;
+
+Mat4f translationMatrix(Vec3f t)
+{
+	return Mat4f(1, 0, 0, t[0], 0, 1, 0, t[1], 0, 0, 1, t[2], 0, 0, 0, 1);
+}
+
+Mat4f scaleMatrix(Vec3f s)
+{
+	return Mat4f(s[0], 0, 0, 0, 0, s[1], 0, 0, 0, 0, s[2], 0, 0, 0, 0, 1);
+}
+
+template<typename T>
+T clampedKey(const std::map<int, std::vector<T>>& track, int id, int frame, const T& rest)
+{
+	auto iter = track.find(id);
+	if (iter == track.end())
+		return rest;
+
+	int last = int(iter->second.size()) - 1;
+	return iter->second[std::max(0, std::min(frame, last))];
+}
+
+float maxDifference(const Mat4f& a, const Mat4f& b)
+{
+	float diff = 0;
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+
+	return diff;
+}
+
+float maxDifference(CArray<Vec3f>& a, CArray<Vec3f>& b)
+{
+	float diff = a.size() == b.size() ? 0.0f : 1e10f;
+	for (uint i = 0; i < std::min(a.size(), b.size()); i++)
+		diff = std::max(diff, (a[i] - b[i]).norm());
+
+	return diff;
+}
+
+TEST(CompiledSkeleton, sampleFrame)
+{
+	//5 is the root, 3 and 1 are its children and 7 is the child of 3
+	std::vector<int> joints = { 7, 1, 3, 5 };
+	std::map<int, std::vector<int>> paths = { { 5, { 5 } }, { 3, { 3, 5 } }, { 7, { 7, 3, 5 } }, { 1, { 1, 5 } } };
+
+	std::map<int, Mat4f> matrix;
+	std::map<int, Vec3f> translation, scale;
+	std::map<int, Quat1f> rotation;
+	for (auto j : joints)
+	{
+		matrix[j] = translationMatrix(Vec3f(j, 1, 0)) * Quat1f(0.1f * j, Vec3f(0, 0, 1)).toMatrix4x4();
+		translation[j] = Vec3f(j, 0, 0);
+		scale[j] = Vec3f(1, 2, 1);
+		rotation[j] = Quat1f(0.3f * j, Vec3f(0, 1, 0));
+	}
+
+	//Tracks of different lengths, 7 is animated without any translation and rotation keys
+	std::vector<int> animated = { 3, 7 };
+	std::map<int, std::vector<Vec3f>> translationTrack = { { 3, { Vec3f(0), Vec3f(2, 0, 0) } } };
+	std::map<int, std::vector<Vec3f>> scaleTrack = { { 7, { Vec3f(0.5f) } } };
+	std::map<int, std::vector<Quat1f>> rotationTrack = { { 3, { Quat1f(0.2f, Vec3f(1, 0, 0)), Quat1f(0.4f, Vec3f(1, 0, 0)), Quat1f(0.6f, Vec3f(1, 0, 0)) } } };
+
+	CompiledSkeleton skeleton;
+	skeleton.setHierarchy(joints, paths);
+	skeleton.setRestPose(matrix, translation, scale, rotation, animated);
+	skeleton.setTracks(translationTrack, {}, scaleTrack, {}, rotationTrack, {});
+
+	for (int frame : { -1, 0, 1, 2, 5 })
+	{
+		skeleton.sampleFrame(frame);
+		skeleton.updateWorldMatrices();
+
+		std::vector<Mat4f> world(8, Mat4f(0));
+		skeleton.getWorldMatrices(world);
+
+		//The per-joint walk from the root GltfLoader used before the skeleton was compiled
+		std::map<int, Mat4f> local = matrix;
+		for (auto j : animated)
+		{
+			local[j] = translationMatrix(clampedKey(translationTrack, j, frame, translation[j]))
+				* scaleMatrix(clampedKey(scaleTrack, j, frame, scale[j]))
+				* clampedKey(rotationTrack, j, frame, rotation[j]).toMatrix4x4();
+		}
+
+		for (auto j : joints)
+		{
+			Mat4f expected = Mat4f::identityMatrix();
+			const std::vector<int>& path = paths[j];
+			for (int k = int(path.size()) - 1; k >= 0; k--)
+				expected *= local[path[k]];
+
+			EXPECT_LT(maxDifference(world[j], expected), 1e-5f);
+		}
+	}
+}
+
+TEST(CompiledSkeleton, sampleTime)
+{
+	std::vector<int> joints = { 2 };
+	std::map<int, std::vector<int>> paths = { { 2, { 2 } } };
+
+	std::map<int, Mat4f> matrix = { { 2, Mat4f::identityMatrix() } };
+	std::map<int, Vec3f> translation = { { 2, Vec3f(0) } };
+	std::map<int, Vec3f> scale = { { 2, Vec3f(1, 2, 3) } };
+	std::map<int, Quat1f> rotation = { { 2, Quat1f() } };
+
+	//Keys are unevenly spaced, the scale is not animated
+	std::map<int, std::vector<Vec3f>> translationTrack = { { 2, { Vec3f(0), Vec3f(2, 0, 0), Vec3f(6, 0, 0) } } };
+	std::map<int, std::vector<Real>> translationTime = { { 2, { 0.0f, 1.0f, 3.0f } } };
+	std::map<int, std::vector<Quat1f>> rotationTrack = { { 2, { Quat1f(0.2f, Vec3f(0, 0, 1)), Quat1f(0.6f, Vec3f(0, 0, 1)) } } };
+	std::map<int, std::vector<Real>> rotationTime = { { 2, { 0.0f, 2.0f } } };
+
+	CompiledSkeleton skeleton;
+	skeleton.setHierarchy(joints, paths);
+	skeleton.setRestPose(matrix, translation, scale, rotation, { 2 });
+	skeleton.setTracks(translationTrack, translationTime, {}, {}, rotationTrack, rotationTime);
+
+	struct Sample { Real time; Vec3f t; Real angle; };
+	std::vector<Sample> samples = {
+		{ -1.0f, Vec3f(0), 0.2f },			//Before the first key
+		{ 0.5f, Vec3f(1, 0, 0), 0.3f },
+		{ 2.0f, Vec3f(4, 0, 0), 0.6f },		//Between the second and the last translation key, after the last rotation key
+		{ 5.0f, Vec3f(6, 0, 0), 0.6f } };	//After the last key
+
+	for (auto& sample : samples)
+	{
+		skeleton.sampleTime(sample.time);
+		skeleton.updateWorldMatrices();
+
+		std::vector<Mat4f> world(3, Mat4f(0));
+		skeleton.getWorldMatrices(world);
+
+		Mat4f expected = translationMatrix(sample.t) * scaleMatrix(scale[2]) * Quat1f(sample.angle, Vec3f(0, 0, 1)).toMatrix4x4();
+		EXPECT_LT(maxDifference(world[2], expected), 1e-5f);
+	}
+}
+
+TEST(SkinInfo, skinMeshAnimation)
+{
+	uint vertexNum = 12;
+	uint jointNum = 4;
+
+	CArray<Vec3f> hPosition, hNormal, hWorldPosition, hWorldNormal;
+	for (uint i = 0; i < vertexNum; i++)
+	{
+		hPosition.pushBack(Vec3f(i, 0.5f * i, 1));
+		hNormal.pushBack(Vec3f(0, 1, 0.1f * i).normalize());
+
+		//Neither unit length nor the initial values, so that untouched and normalized entries can be told apart
+		hWorldPosition.pushBack(Vec3f(-1, -2, -3));
+		hWorldNormal.pushBack(Vec3f(0, 0, 3));
+	}
+
+	std::vector<Mat4f> hWorldMatrix, hInverseBind;
+	for (uint j = 0; j < jointNum; j++)
+	{
+		hWorldMatrix.push_back(translationMatrix(Vec3f(0, j, 0)) * Quat1f(0.5f * j, Vec3f(0, 0, 1)).toMatrix4x4() * scaleMatrix(Vec3f(1 + 0.1f * j)));
+		hInverseBind.push_back(translationMatrix(Vec3f(-0.5f * j, 0, 0)));
+	}
+
+	Mat4f transform = translationMatrix(Vec3f(0, 0, 2)) * Quat1f(0.3f, Vec3f(1, 0, 0)).toMatrix4x4();
+
+	DArray<Mat4f> worldMatrix, inverseBind;
+	worldMatrix.assign(hWorldMatrix);
+	inverseBind.assign(hInverseBind);
+
+	DArray<Vec3f> position, normal;
+	position.assign(hPosition);
+	normal.assign(hNormal);
+
+	//Skin 0 binds two ranges with both sets of joints, skin 1 covers a range without bindings, vertices 7, 10 and 11 are not covered
+	std::vector<Vec4f> joints0, joints1, weights0, weights1;
+	for (uint i = 0; i < 5; i++)
+	{
+		joints0.push_back(Vec4f(i % jointNum, (i + 1) % jointNum, 0, 0));
+		weights0.push_back(Vec4f(0.5f, 0.3f, 0, 0));
+		joints1.push_back(Vec4f((i + 2) % jointNum, 0, 0, 0));
+		weights1.push_back(Vec4f(0.2f, 0, 0, 0));
+	}
+
+	SkinInfo skin;
+	skin.pushBack_Data(weights0, weights1, joints0, joints1);
+	skin.pushBack_Data(std::vector<Vec4f>(), std::vector<Vec4f>(), std::vector<Vec4f>(), std::vector<Vec4f>());
+	skin.skin_VerticeRange[0] = { Vec2u(0, 4), Vec2u(8, 9) };
+	skin.skin_VerticeRange[1] = { Vec2u(5, 6) };
+
+	//Reference: two launches per range as GltfLoader skinned before the batch
+	DArray<Vec3f> refPosition, refNormal;
+	refPosition.assign(hWorldPosition);
+	refNormal.assign(hWorldNormal);
+	for (int i = 0; i < skin.size(); i++)
+	{
+		for (auto range : skin.skin_VerticeRange[i])
+		{
+			skinAnimation(position, refPosition, inverseBind, worldMatrix,
+				skin.V_jointID_0[i], skin.V_jointID_1[i], skin.V_jointWeight_0[i], skin.V_jointWeight_1[i],
+				transform, false, range);
+
+			skinAnimation(normal, refNormal, inverseBind, worldMatrix,
+				skin.V_jointID_0[i], skin.V_jointID_1[i], skin.V_jointWeight_0[i], skin.V_jointWeight_1[i],
+				transform, true, range);
+		}
+	}
+
+	DArray<Vec3f> batchPosition, batchNormal;
+	batchPosition.assign(hWorldPosition);
+	batchNormal.assign(hWorldNormal);
+	skinMeshAnimation(skin, position, normal, batchPosition, batchNormal, inverseBind, worldMatrix, transform);
+
+	CArray<Vec3f> expected, result;
+
+	expected.assign(refPosition);
+	result.assign(batchPosition);
+	EXPECT_LT(maxDifference(expected, result), 1e-4f);
+
+	expected.assign(refNormal);
+	result.assign(batchNormal);
+	EXPECT_LT(maxDifference(expected, result), 1e-4f);
+
+	//Normalized without bindings, left untouched outside of the skins
+	EXPECT_NEAR(result[5][2], 1.0f, 1e-6f);
+	EXPECT_EQ(result[7][2], 3.0f);
+
+	//The batch is reused as long as the skins do not change
+	skinMeshAnimation(skin, position, normal, batchPosition, batchNormal, inverseBind, worldMatrix, transform);
+	result.assign(batchPosition);
+	expected.assign(refPosition);
+	EXPECT_LT(maxDifference(expected, result), 1e-4f);
+}
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+
+#include "Log.h"
+
+#include <vector>
+#include <thread>
+
+using namespace dyno;
+
+static std::mutex sReceivedMutex;
+static std::vector<Log::Message> sReceived;
+
+static void ReceiveMessage(const Log::Message& m)
+{
+	std::lock_guard<std::mutex> lock(sReceivedMutex);
+	sReceived.push_back(m);
+}
+
+static std::vector<Log::Message> takeReceived()
+{
+	std::lock_guard<std::mutex> lock(sReceivedMutex);
+	std::vector<Log::Message> ret;
+	ret.swap(sReceived);
+	return ret;
+}
+
+TEST(Log, SendAndFlush)
+{
+	Log::flush();
+	Log::setUserReceiver(&ReceiveMessage);
+	Log::setLevel(Log::Info);
+	takeReceived();
+
+	Log::sendMessage(Log::Info, "first");
+	Log::sendMessage(Log::Warning, std::string("second"));
+	Log::sendMessage(Log::DebugInfo, "filtered");
+	Log::flush();
+
+	auto messages = takeReceived();
+	ASSERT_EQ(messages.size(), 2);
+	EXPECT_EQ(messages[0].type, Log::Info);
+	EXPECT_EQ(messages[0].text, std::string("first"));
+	EXPECT_EQ(messages[1].type, Log::Warning);
+	EXPECT_EQ(messages[1].text, std::string("second"));
+	EXPECT_LE(messages[0].timestamp, messages[1].timestamp);
+
+	//The message expression is not evaluated when the level is filtered out
+	bool evaluated = false;
+	DYNO_LOG(Log::DebugInfo, (evaluated = true, std::string("skipped")));
+	EXPECT_EQ(evaluated, false);
+
+	Log::setUserReceiver(nullptr);
+	Log::setLevel(Log::DebugInfo);
+}
+
+TEST(Log, Truncate)
+{
+	Log::flush();
+	Log::setUserReceiver(&ReceiveMessage);
+	takeReceived();
+
+	std::string text(2 * Log::RecordTextSize, 'a');
+	Log::sendMessage(Log::Info, text);
+	Log::flush();
+
+	auto messages = takeReceived();
+	ASSERT_EQ(messages.size(), 1);
+	EXPECT_EQ(messages[0].text.size(), Log::RecordTextSize);
+	EXPECT_EQ(messages[0].text.substr(Log::RecordTextSize - 3), std::string("..."));
+
+	Log::setUserReceiver(nullptr);
+}
+
+TEST(Log, MultipleSenders)
+{
+	Log::flush();
+	Log::setUserReceiver(&ReceiveMessage);
+	takeReceived();
+
+	uint64_t droppedBefore = Log::droppedMessages();
+
+	const int threadNum = 4;
+	const int messageNum = 10000;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadNum; t++)
+	{
+		threads.emplace_back([t]() {
+			for (int i = 0; i < messageNum; i++)
+				Log::sendMessage(Log::Info, std::to_string(t));
+		});
+	}
+
+	for (auto& th : threads)
+		th.join();
+
+	Log::flush();
+
+	//Messages are either delivered or counted as dropped, the drops are reported by one extra warning
+	auto messages = takeReceived();
+
+	uint64_t dropped = Log::droppedMessages() - droppedBefore;
+	size_t delivered = 0;
+	for (auto& m : messages)
+	{
+		if (m.type == Log::Info)
+			delivered++;
+	}
+
+	EXPECT_EQ(delivered + dropped, threadNum * messageNum);
+
+	Log::setUserReceiver(nullptr);
+}
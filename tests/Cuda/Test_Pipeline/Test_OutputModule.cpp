@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "SceneGraph.h"
+#include "Module/OutputModule.h"
+
+#include <atomic>
+
+using namespace dyno;
+
+namespace dyno
+{
+	class CountingWriter : public OutputModule
+	{
+	public:
+		CountingWriter() {};
+		~CountingWriter() override {};
+
+		int outputs = 0;
+		int finalized = 0;
+
+		//Written by the background writer
+		std::shared_ptr<std::atomic<int>> written = std::make_shared<std::atomic<int>>(0);
+
+	protected:
+		void output() override {
+			outputs++;
+
+			auto counter = written;
+			this->submit([counter]() { (*counter)++; });
+		}
+
+		void finalizeImpl() override {
+			//Pending tasks have been written before the files are closed
+			EXPECT_EQ(written->load(), outputs);
+			finalized++;
+		}
+	};
+}
+
+TEST(OutputModule, finalizeOnReset)
+{
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+	auto node = scn->addNode(std::make_shared<Node>());
+
+	auto writer = std::make_shared<CountingWriter>();
+	writer->varForceUpdate()->setValue(true);
+	node->stateFrameNumber()->connect(writer->inFrameNumber());
+	node->animationPipeline()->pushModule(writer);
+
+	writer->update();
+	writer->update();
+	EXPECT_EQ(writer->outputs, 2);
+	EXPECT_EQ(writer->finalized, 0);
+
+	scn->reset();
+	EXPECT_EQ(writer->finalized, 1);
+
+	writer->finalize();
+	EXPECT_EQ(writer->finalized, 2);
+}
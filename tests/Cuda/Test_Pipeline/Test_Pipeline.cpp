@@ -3,6 +3,11 @@
 #include "SceneGraph.h"
 #include "SceneGraphFactory.h"
 #include "Module/Pipeline.h"
+#include "Module/ComputeModule.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace dyno;
 
@@ -13,3 +18,153 @@ TEST(Pipeline, connect)
 	SceneGraphFactory::instance()->pushScene(scn);
 	SceneGraphFactory::instance()->popScene();
 }
+
+namespace dyno
+{
+	class DoubleValue : public ComputeModule
+	{
+	public:
+		DoubleValue() {};
+		~DoubleValue() override {};
+
+		void compute() override {
+			this->outResult()->setValue(2.0f * this->inValue()->getData());
+		}
+
+		DEF_VAR_IN(float, Value, "");
+		DEF_VAR_OUT(float, Result, "");
+	};
+
+	class Multiply2 : public ComputeModule
+	{
+	public:
+		Multiply2() {};
+		~Multiply2() override {};
+
+		void compute() override {
+			this->outResult()->setValue(this->inA()->getData() * this->inB()->getData());
+		}
+
+		DEF_VAR_IN(float, A, "");
+		DEF_VAR_IN(float, B, "");
+		DEF_VAR_OUT(float, Result, "");
+	};
+
+	//Modules of the same level run concurrently, overlapping updates of the in-place modifiers are recorded
+	static std::atomic<int> sActiveModifiers(0);
+	static std::atomic<bool> sOverlapped(false);
+
+	class InPlaceModifier : public ComputeModule
+	{
+	public:
+		InPlaceModifier(int add, int mul) : mAdd(add), mMul(mul) {};
+		~InPlaceModifier() override {};
+
+		void compute() override {
+			if (sActiveModifiers.fetch_add(1) > 0)
+				sOverlapped = true;
+
+			auto& values = this->inValues()->getData();
+			for (uint i = 0; i < values.size(); i++)
+				values[i] = (values[i] + mAdd) * mMul;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+			sActiveModifiers--;
+		}
+
+		DEF_ARRAY_IN(int, Values, DeviceType::CPU, "Modified in place");
+
+	private:
+		int mAdd;
+		int mMul;
+	};
+
+	class Particles : public Node
+	{
+	public:
+		Particles() {};
+		~Particles() override {};
+
+		DEF_ARRAY_STATE(int, Values, DeviceType::CPU, "");
+	};
+
+	class Rectangle : public Node
+	{
+	public:
+		Rectangle() {};
+		~Rectangle() override {};
+
+		DEF_VAR_STATE(float, Width, 3.0f, "");
+		DEF_VAR_STATE(float, Height, 5.0f, "");
+	};
+}
+
+TEST(Pipeline, parallelExecution)
+{
+	auto rect = std::make_shared<Rectangle>();
+
+	auto scaleW = std::make_shared<DoubleValue>();
+	auto scaleH = std::make_shared<DoubleValue>();
+	auto area = std::make_shared<Multiply2>();
+
+	rect->stateWidth()->connect(scaleW->inValue());
+	rect->stateHeight()->connect(scaleH->inValue());
+	scaleW->outResult()->connect(area->inA());
+	scaleH->outResult()->connect(area->inB());
+
+	auto pipeline = rect->animationPipeline();
+	pipeline->pushModule(area);
+	pipeline->pushModule(scaleW);
+	pipeline->pushModule(scaleH);
+	pipeline->setParallelExecution(true);
+
+	rect->update();
+
+	EXPECT_EQ(pipeline->activeModules().size(), 3u);
+	EXPECT_EQ(area->outResult()->getData(), 60.0f);
+}
+
+TEST(Pipeline, inPlaceModification)
+{
+	auto particles = std::make_shared<Particles>();
+	particles->stateValues()->assign(std::vector<int>{ 0, 1, 2, 3 });
+
+	//Both modules only take the array as an input and modify it in place
+	auto addOne = std::make_shared<InPlaceModifier>(1, 1);
+	auto twice = std::make_shared<InPlaceModifier>(0, 2);
+
+	particles->stateValues()->connect(addOne->inValues());
+	particles->stateValues()->connect(twice->inValues());
+
+	auto pipeline = particles->animationPipeline();
+	pipeline->pushModule(addOne);
+	pipeline->pushModule(twice);
+	pipeline->setParallelExecution(true);
+
+	sOverlapped = false;
+	for (int i = 0; i < 4; i++)
+		particles->update();
+
+	EXPECT_EQ(sOverlapped.load(), false);
+
+	//Either order gives the same result as long as the modules do not interleave
+	CArray<int> values;
+	values.assign(particles->stateValues()->constData());
+
+	bool addFirst = true, doubleFirst = true;
+	for (int i = 0; i < 4; i++)
+	{
+		int a = i, b = i;
+		for (int k = 0; k < 4; k++)
+		{
+			a = (a + 1) * 2;
+			b = b * 2 + 1;
+		}
+
+		addFirst = addFirst && values[i] == a;
+		doubleFirst = doubleFirst && values[i] == b;
+	}
+
+	EXPECT_EQ(addFirst || doubleFirst, true);
+}
@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+
+#include "RigidBody/Module/RigidBodyIslands.h"
+
+using namespace dyno;
+
+typedef RigidBodyIslands<DataType3f> Islands;
+typedef TContactPair<float> Contact;
+typedef DiscreteElements<DataType3f> Elements;
+
+std::shared_ptr<Islands> createIslands(std::shared_ptr<Elements> elements, uint bodyNum)
+{
+	auto islands = std::make_shared<Islands>();
+	islands->varForceUpdate()->setValue(true);
+	islands->inTimeStep()->setValue(0.1f);
+	islands->inDiscreteElements()->setDataPtr(elements);
+
+	islands->inVelocity()->assign(std::vector<Vec3f>(bodyNum, Vec3f(1, 0, 0)));
+	islands->inAngularVelocity()->assign(std::vector<Vec3f>(bodyNum, Vec3f(0)));
+
+	return islands;
+}
+
+Contact contact(int a, int b)
+{
+	return Contact(a, b, CT_NONPENETRATION, Vec3f(0), Vec3f(0), Vec3f(0, 1, 0), Vec3f(0, -1, 0));
+}
+
+template<typename Joint>
+Joint joint(int a, int b)
+{
+	Joint j;
+	j.bodyId1 = a;
+	j.bodyId2 = b;
+	return j;
+}
+
+TEST(RigidBodyIslands, unionFind)
+{
+	auto elements = std::make_shared<Elements>();
+	elements->ballAndSocketJoints().assign(std::vector<Elements::BallAndSocketJoint>{ joint<Elements::BallAndSocketJoint>(1, 0) });
+	elements->sliderJoints().assign(std::vector<Elements::SliderJoint>{ joint<Elements::SliderJoint>(2, 3) });
+	elements->hingeJoints().assign(std::vector<Elements::HingeJoint>{ joint<Elements::HingeJoint>(4, 5) });
+	elements->fixedJoints().assign(std::vector<Elements::FixedJoint>{ joint<Elements::FixedJoint>(6, 7) });
+
+	//A point joint attaches a single body to the world
+	elements->pointJoints().assign(std::vector<Elements::PointJoint>{ joint<Elements::PointJoint>(8, INVALID) });
+
+	auto islands = createIslands(elements, 14);
+
+	//Contacts chain 9, 10 and 12 together, 11 only touches the boundary and 13 is free
+	islands->inContacts()->assign(std::vector<Contact>{ contact(9, 10), contact(12, 10), contact(11, INVALID) });
+
+	islands->update();
+
+	EXPECT_EQ(islands->outIslandNumber()->getValue(), 8u);
+	EXPECT_EQ(islands->outAwakeIslandNumber()->getValue(), 8u);
+	EXPECT_EQ(islands->outAwakeContacts()->size(), 3u);
+
+	CArray<int> index;
+	index.assign(islands->outIslandIndex()->getData());
+
+	std::vector<std::vector<int>> groups = { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, { 8 }, { 9, 10, 12 }, { 11 }, { 13 } };
+	for (uint i = 0; i < groups.size(); i++)
+	{
+		for (auto body : groups[i])
+		{
+			EXPECT_EQ(index[body], index[groups[i][0]]);
+		}
+
+		for (uint j = i + 1; j < groups.size(); j++)
+		{
+			EXPECT_NE(index[groups[i][0]], index[groups[j][0]]);
+		}
+	}
+}
+
+TEST(RigidBodyIslands, sleepAndWake)
+{
+	auto islands = createIslands(std::make_shared<Elements>(), 2);
+	islands->varSleepingEnabled()->setValue(true);
+	islands->varSleepDelay()->setValue(0.5f);
+
+	//Body 0 rests on the boundary while body 1 keeps moving
+	islands->inVelocity()->assign(std::vector<Vec3f>{ Vec3f(0), Vec3f(1, 0, 0) });
+	islands->inContacts()->assign(std::vector<Contact>{ contact(0, INVALID) });
+
+	for (int i = 0; i < 4; i++)
+		islands->update();
+
+	EXPECT_EQ(islands->outAwakeIslandNumber()->getValue(), 2u);
+	EXPECT_EQ(islands->outAwakeContacts()->size(), 1u);
+
+	for (int i = 0; i < 4; i++)
+		islands->update();
+
+	//Body 0 has rested longer than the delay, its contacts are no longer solved
+	EXPECT_EQ(islands->outIslandNumber()->getValue(), 2u);
+	EXPECT_EQ(islands->outAwakeIslandNumber()->getValue(), 1u);
+	EXPECT_EQ(islands->outAwakeContacts()->size(), 0u);
+
+	//Body 1 touches body 0, the merged island is awake
+	islands->inContacts()->assign(std::vector<Contact>{ contact(0, INVALID), contact(1, 0) });
+	islands->update();
+
+	EXPECT_EQ(islands->outIslandNumber()->getValue(), 1u);
+	EXPECT_EQ(islands->outAwakeIslandNumber()->getValue(), 1u);
+	EXPECT_EQ(islands->outAwakeContacts()->size(), 2u);
+
+	//Nothing sleeps while sleeping is disabled
+	islands->varSleepingEnabled()->setValue(false);
+	islands->inVelocity()->assign(std::vector<Vec3f>{ Vec3f(0), Vec3f(0) });
+	for (int i = 0; i < 8; i++)
+		islands->update();
+
+	EXPECT_EQ(islands->outAwakeIslandNumber()->getValue(), 1u);
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "SceneGraph.h"
+
+#include "RigidBody/RigidBodySystem.h"
+#include "RigidBody/Module/PJSoftConstraintSolver.h"
+#include "RigidBody/Module/RigidBodyIslands.h"
+
+using namespace dyno;
+
+//Velocity iterations of the default solver over some frames of a settled stack of boxes
+uint restingStackIterations(bool warmStart)
+{
+	std::shared_ptr<SceneGraph> scn = std::make_shared<SceneGraph>();
+	auto rigid = scn->addNode(std::make_shared<RigidBodySystem<DataType3f>>());
+
+	float h = 0.1f;
+
+	RigidBodyInfo rigidBody;
+	BoxInfo box;
+	box.halfLength = Vec3f(h, h, h);
+	for (int j = 0; j < 4; j++)
+	{
+		box.center = Vec3f(0, h + 2.0f * j * h, 0);
+		rigid->addBox(box, rigidBody);
+	}
+
+	//Sleeping islands skip the solver, which would hide the iterations saved by warm starting
+	auto islands = rigid->animationPipeline()->findFirstModule<RigidBodyIslands<DataType3f>>();
+	islands->varSleepingEnabled()->setValue(false);
+
+	auto solver = rigid->animationPipeline()->findFirstModule<PJSoftConstraintSolver<DataType3f>>();
+	solver->varWarmStartEnabled()->setValue(warmStart);
+
+	scn->reset();
+
+	for (int i = 0; i < 60; i++)
+		scn->takeOneFrame();
+
+	uint iterations = 0;
+	for (int i = 0; i < 20; i++)
+	{
+		scn->takeOneFrame();
+		iterations += solver->outVelocityIterationNumber()->getValue();
+	}
+
+	CArray<Vec3f> center;
+	center.assign(rigid->stateCenter()->constData());
+	EXPECT_NEAR(center[3][1], 7 * h, 0.5f * h);
+
+	return iterations;
+}
+
+TEST(PJSoftConstraintSolver, warmStartRestingStack)
+{
+	uint coldIterations = restingStackIterations(false);
+	uint warmIterations = restingStackIterations(true);
+
+	EXPECT_LT(warmIterations, coldIterations);
+}
@@ -0,0 +1,112 @@
+#include "gtest/gtest.h"
+
+#include "Topology/SignedDistanceFile.h"
+
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+
+using namespace dyno;
+
+TEST(SignedDistanceFile, convert)
+{
+	std::string textFile = "test_sdf.sdf";
+	std::string rawFile = "test_sdf_raw.bsdf";
+	std::string brickFile = "test_sdf_brick.bsdf";
+
+	//A 10x9x5 grid, far-field cells are clamped to 1
+	uint nx = 10, ny = 9, nz = 5;
+	{
+		std::ofstream output(textFile.c_str());
+		output << nx << " " << ny << " " << nz << "\n";
+		output << "-0.5 0 0.25\n";
+		output << "0.125\n";
+		for (uint k = 0; k < nz; k++)
+			for (uint j = 0; j < ny; j++)
+				for (uint i = 0; i < nx; i++)
+					output << (i < 4 && j < 4 ? 0.01f * (i + j + k) : 1.0f) << " ";
+	}
+
+	EXPECT_EQ(SignedDistanceFile::isBinary(textFile), false);
+
+	CArray3D<float> text;
+	Vec3d origin, spacing;
+	EXPECT_EQ(SignedDistanceFile::load(textFile, text, origin, spacing), true);
+	EXPECT_EQ(text.nx() == nx && text.ny() == ny && text.nz() == nz, true);
+	EXPECT_EQ(origin[0], -0.5);
+	EXPECT_EQ(spacing[2], 0.125);
+	EXPECT_EQ(text(3, 2, 1), 0.01f * 6);
+
+	EXPECT_EQ(SignedDistanceFile::convert(textFile, rawFile, 0), true);
+	EXPECT_EQ(SignedDistanceFile::convert(textFile, brickFile, 4), true);
+	EXPECT_EQ(SignedDistanceFile::isBinary(brickFile), true);
+
+	for (auto file : { rawFile, brickFile })
+	{
+		CArray3D<double> binary;
+		Vec3d origin1, spacing1;
+		EXPECT_EQ(SignedDistanceFile::load(file, binary, origin1, spacing1), true);
+		EXPECT_EQ(origin1[2], 0.25);
+		EXPECT_EQ(spacing1[0], 0.125);
+
+		bool equal = binary.size() == text.size();
+		for (uint i = 0; equal && i < text.size(); i++)
+			equal = (float)binary[i] == text[i];
+
+		EXPECT_EQ(equal, true);
+	}
+
+	std::ifstream raw(rawFile.c_str(), std::ios::binary | std::ios::ate);
+	std::ifstream brick(brickFile.c_str(), std::ios::binary | std::ios::ate);
+	EXPECT_EQ(brick.tellg() < raw.tellg(), true);
+	raw.close();
+	brick.close();
+
+	std::remove(textFile.c_str());
+	std::remove(rawFile.c_str());
+	std::remove(brickFile.c_str());
+}
+
+TEST(SignedDistanceFile, failure)
+{
+	CArray3D<float> distances;
+	Vec3d origin, spacing;
+	EXPECT_EQ(SignedDistanceFile::load("not_existing.sdf", distances, origin, spacing), false);
+
+	std::string truncated = "test_sdf_truncated.sdf";
+	{
+		std::ofstream output(truncated.c_str());
+		output << "4 4 4\n0 0 0\n0.1\n1 2 3";
+	}
+
+	EXPECT_EQ(SignedDistanceFile::load(truncated, distances, origin, spacing), false);
+	std::remove(truncated.c_str());
+
+	//The dimensions are rejected before anything is allocated
+	std::string oversized = "test_sdf_oversized.sdf";
+	{
+		std::ofstream output(oversized.c_str());
+		output << "100000 100000 100000\n0 0 0\n0.1\n1 2 3";
+	}
+
+	EXPECT_EQ(SignedDistanceFile::load(oversized, distances, origin, spacing), false);
+	std::remove(oversized.c_str());
+
+	std::string overflow = "test_sdf_overflow.bsdf";
+	for (uint brickSize : { 0u, 4u })
+	{
+		CArray3D<float> one(1, 1, 1);
+		one.reset();
+		SignedDistanceFile::save(overflow, one, origin, spacing, brickSize);
+
+		//The product of the dimensions wraps around to a small number in 32 bits
+		std::fstream file(overflow.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+		uint32_t dims[3] = { 65536, 65536, 1 };
+		file.seekp(offsetof(SignedDistanceFile::Header, nx));
+		file.write((const char*)dims, sizeof(dims));
+		file.close();
+
+		EXPECT_EQ(SignedDistanceFile::load(overflow, distances, origin, spacing), false);
+	}
+	std::remove(overflow.c_str());
+}
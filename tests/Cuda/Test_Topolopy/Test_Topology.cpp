@@ -1,5 +1,8 @@
 #include "gtest/gtest.h"
 #include "Topology/TriangleSet.h"
+#include "Topology/TetrahedronSet.h"
+
+#include <sstream>
 
 using namespace dyno;
 
@@ -40,3 +43,68 @@ TEST(Key, construction)
 	EXPECT_EQ(eKey < eKey_1, false);
 	EXPECT_EQ(eKey > eKey_1, true);
 }
+
+TEST(TriangleSet, connectivityVersion)
+{
+	TriangleSet<DataType3f> ts;
+
+	std::vector<Vec3f> vertices = { Vec3f(0, 0, 0), Vec3f(1, 0, 0), Vec3f(0, 1, 0), Vec3f(1, 1, 0) };
+	std::vector<TopologyModule::Triangle> triangles = { TopologyModule::Triangle(0, 1, 2), TopologyModule::Triangle(1, 3, 2) };
+
+	ts.setPoints(vertices);
+	ts.setTriangles(triangles);
+	ts.update();
+
+	uint version = ts.connectivityVersion();
+	EXPECT_EQ(ts.getEdges().size(), 5);
+	EXPECT_EQ(ts.getEdge2Triangle().size(), 5);
+
+	//Moving the vertices keeps the connectivity but updates the normals
+	vertices[3] = Vec3f(1, 1, 1);
+	ts.setPoints(vertices);
+	ts.update();
+
+	EXPECT_EQ(ts.connectivityVersion(), version);
+	EXPECT_EQ(ts.getEdges().size(), 5);
+
+	CArray<Vec3f> normals;
+	normals.assign(ts.getVertexNormals());
+	EXPECT_GT(normals[3].norm(), 0.5f);
+	EXPECT_LT(normals[3][2], 0.99f);
+
+	//Changing the triangles through the reference is detected as well
+	triangles.pop_back();
+	ts.getTriangles().assign(triangles);
+	ts.update();
+
+	EXPECT_GT(ts.connectivityVersion(), version);
+	EXPECT_EQ(ts.getEdges().size(), 3);
+	EXPECT_EQ(ts.getEdge2Triangle().size(), 3);
+}
+
+TEST(TetrahedronSet, binary)
+{
+	TetrahedronSet<DataType3f> tets;
+
+	std::vector<Vec3f> vertices = { Vec3f(0, 0, 0), Vec3f(1, 0, 0), Vec3f(0, 1, 0), Vec3f(0, 0, 1), Vec3f(1, 1, 1) };
+	std::vector<TopologyModule::Tetrahedron> tetrahedrons = { TopologyModule::Tetrahedron(0, 1, 2, 3), TopologyModule::Tetrahedron(1, 2, 3, 4) };
+
+	tets.setPoints(vertices);
+	tets.setTetrahedrons(tetrahedrons);
+	tets.update();
+
+	std::stringstream ss;
+	EXPECT_EQ(tets.writeBinary(ss), true);
+
+	TetrahedronSet<DataType3f> tets1;
+	EXPECT_EQ(tets1.readBinary(ss), true);
+	tets1.update();
+
+	EXPECT_EQ(tets1.getPoints().size(), 5);
+	EXPECT_EQ(tets1.getTetrahedrons().size(), 2);
+	EXPECT_EQ(tets1.getTriangles().size(), tets.getTriangles().size());
+
+	CArray<TopologyModule::Tetrahedron> hTets;
+	hTets.assign(tets1.getTetrahedrons());
+	EXPECT_EQ(hTets[1][3], 4);
+}
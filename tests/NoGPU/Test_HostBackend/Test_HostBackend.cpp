@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include "Array/Array.h"
+
+#include <vector>
+
+using namespace dyno;
+
+TEST(HostArray, copy)
+{
+	CArray<int> cArr;
+	cArr.pushBack(1);
+	cArr.pushBack(2);
+	cArr.pushBack(3);
+
+	DArray<int> dArr;
+	dArr.assign(cArr);
+	EXPECT_EQ(dArr.size(), 3u);
+
+	DArray<int> dArr2;
+	dArr2.assign(dArr);
+	EXPECT_EQ(dArr2.size(), 3u);
+
+	//The copy owns its memory
+	dArr.reset();
+
+	CArray<int> cArr2;
+	cArr2.assign(dArr2);
+	EXPECT_EQ(cArr2.size(), 3u);
+	EXPECT_EQ(cArr2[0], 1);
+	EXPECT_EQ(cArr2[2], 3);
+}
+
+TEST(HostArray, offsetAssign)
+{
+	std::vector<int> vec = { 1, 2, 3, 4 };
+
+	DArray<int> dArr;
+	dArr.resize(6);
+	dArr.reset();
+	dArr.assign(vec, 3, 2, 1);
+
+	CArray<int> cArr;
+	cArr.assign(dArr);
+
+	EXPECT_EQ(cArr.size(), 6u);
+	EXPECT_EQ(cArr[1], 0);
+	EXPECT_EQ(cArr[2], 2);
+	EXPECT_EQ(cArr[4], 4);
+	EXPECT_EQ(cArr[5], 0);
+}
+
+TEST(HostArray, reserve)
+{
+	EXPECT_EQ(nextPowerOfTwo(1), 1u);
+	EXPECT_EQ(nextPowerOfTwo(5), 8u);
+	EXPECT_EQ(nextPowerOfTwo(1024), 1024u);
+
+	//Beyond the precision of float
+	EXPECT_EQ(nextPowerOfTwo(16777217), 33554432u);
+	EXPECT_EQ(nextPowerOfTwo(1u << 31), 1u << 31);
+
+	DArray<int> dArr;
+	dArr.resize(3);
+	dArr.reserve(100);
+	EXPECT_EQ(dArr.size(), 3u);
+	EXPECT_EQ(dArr.capacity(), 128u);
+}
+
+__global__ void HB_AddIndex(
+	DArray<int> arr)
+{
+	int tId = threadIdx.x + blockIdx.x * blockDim.x;
+	if (tId >= arr.size()) return;
+
+	arr[tId] += tId;
+}
+
+__global__ void HB_Count(
+	DArray<uint> counter,
+	DArray<int> arr)
+{
+	int tId = threadIdx.x + blockIdx.x * blockDim.x;
+	if (tId >= arr.size()) return;
+
+	atomicAdd(&counter[arr[tId] % 2], 1);
+}
+
+TEST(HostKernel, cuExecute)
+{
+	//Not a multiple of BLOCK_SIZE, the last block is partially filled
+	uint num = 1000;
+
+	DArray<int> dArr;
+	dArr.resize(num);
+	dArr.reset();
+
+	cuExecute(num,
+		HB_AddIndex,
+		dArr);
+
+	CArray<int> cArr;
+	cArr.assign(dArr);
+
+	bool equal = true;
+	for (uint i = 0; i < num; i++)
+		equal = equal && cArr[i] == (int)i;
+
+	EXPECT_EQ(equal, true);
+
+	DArray<uint> counter(2);
+	counter.reset();
+
+	cuExecute(num,
+		HB_Count,
+		counter,
+		dArr);
+
+	CArray<uint> cCounter;
+	cCounter.assign(counter);
+
+	EXPECT_EQ(cCounter[0], num / 2);
+	EXPECT_EQ(cCounter[1], num / 2);
+}
+
+TEST(HostKernel, profileZone)
+{
+	Profiler* profiler = Profiler::instance();
+	profiler->setCapacity(16);
+	profiler->clear();
+	profiler->setEnabled(true);
+
+	DArray<int> dArr(100);
+	dArr.reset();
+
+	cuExecute(dArr.size(),
+		HB_AddIndex,
+		dArr);
+
+	profiler->setEnabled(false);
+
+	auto stats = profiler->statistics();
+	ASSERT_EQ(stats.size(), 1u);
+	EXPECT_EQ(stats[0].name, "HB_AddIndex");
+	EXPECT_EQ(stats[0].level, Profiler::Kernel);
+	EXPECT_EQ(stats[0].count, 1u);
+
+	profiler->clear();
+}
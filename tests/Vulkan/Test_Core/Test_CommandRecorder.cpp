@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "VkProgram.h"
+#include "VkTransfer.h"
+
+using namespace dyno;
+
+TEST(VkCommandRecorder, BatchedDispatch)
+{
+	if (VkSystem::instance()->currentContext() == nullptr)
+		VkSystem::instance()->initialize();
+
+	auto reset = std::make_shared<VkProgram>(BUFFER(uint), CONSTANT(uint));
+	reset->load(getAssetPath() + "shaders/glsl/math/ResetUInt.comp.spv");
+
+	std::vector<uint> vec(100, 7);
+
+	VkDeviceArray<uint> d_a;
+	VkDeviceArray<uint> d_b;
+	d_a.resize(vec.size());
+	d_b.resize(vec.size());
+	vkTransfer(d_a, vec);
+	vkTransfer(d_b, vec);
+
+	VkConstant<uint> size(vec.size());
+
+	VkCommandRecorder recorder;
+	recorder.begin();
+	EXPECT_EQ(VkCommandRecorder::current(), &recorder);
+
+	reset->flush(vkDispatchSize(vec.size(), 64), &d_a, &size);
+	reset->flush(vkDispatchSize(vec.size(), 64), &d_b, &size);
+
+	//Only the third dispatch touches a buffer used before
+	reset->flush(vkDispatchSize(vec.size(), 64), &d_a, &size);
+
+	EXPECT_EQ(recorder.dispatchNumber(), 3);
+	EXPECT_EQ(recorder.barrierNumber(), 1);
+
+	recorder.end();
+	EXPECT_EQ(VkCommandRecorder::current(), nullptr);
+
+	std::vector<uint> a(vec.size());
+	std::vector<uint> b(vec.size());
+	vkTransfer(a, d_a);
+	vkTransfer(b, d_b);
+	for (size_t i = 0; i < vec.size(); i++)
+	{
+		EXPECT_EQ(a[i], 0);
+		EXPECT_EQ(b[i], 0);
+	}
+}
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include "VkProgram.h"
+#include "VkTransfer.h"
+
+#include <fstream>
+
+using namespace dyno;
+
+static VkContext* initializedContext()
+{
+	if (VkSystem::instance()->currentContext() == nullptr)
+		VkSystem::instance()->initialize();
+
+	return VkSystem::instance()->currentContext();
+}
+
+TEST(VkPipelineCache, SharedPipeline)
+{
+	VkContext* ctx = initializedContext();
+
+	auto reset1 = std::make_shared<VkProgram>(BUFFER(uint), CONSTANT(uint));
+	reset1->load(getAssetPath() + "shaders/glsl/math/ResetUInt.comp.spv");
+
+	size_t num = ctx->computePipelineNumber();
+
+	auto reset2 = std::make_shared<VkProgram>(BUFFER(uint), CONSTANT(uint));
+	reset2->load(getAssetPath() + "shaders/glsl/math/ResetUInt.comp.spv");
+
+	EXPECT_EQ(ctx->computePipelineNumber(), num);
+
+	//Both programs still work after the first one is gone
+	reset1 = nullptr;
+
+	std::vector<uint> vec(100, 7);
+	VkDeviceArray<uint> d_vec;
+	d_vec.resize(vec.size());
+	vkTransfer(d_vec, vec);
+
+	VkConstant<uint> size(vec.size());
+	reset2->flush(vkDispatchSize(vec.size(), 64), &d_vec, &size);
+
+	vkTransfer(vec, d_vec);
+	for (size_t i = 0; i < vec.size(); i++)
+	{
+		EXPECT_EQ(vec[i], 0);
+	}
+}
+
+TEST(VkPipelineCache, SaveAndRead)
+{
+	VkContext* ctx = initializedContext();
+
+	auto reset = std::make_shared<VkProgram>(BUFFER(uint), CONSTANT(uint));
+	reset->load(getAssetPath() + "shaders/glsl/math/ResetUInt.comp.spv");
+
+	EXPECT_EQ(ctx->savePipelineCache(), true);
+
+	std::vector<char> data;
+	EXPECT_EQ(ctx->readPipelineCacheFile(data), true);
+	EXPECT_EQ(data.empty(), false);
+
+	//A cache written by another driver version is rejected, the version follows the magic, version, vendor and device ids
+	{
+		std::fstream file(ctx->pipelineCacheFile(), std::ios::binary | std::ios::in | std::ios::out);
+		uint32_t driverVersion = ctx->properties.driverVersion + 1;
+		file.seekp(4 * sizeof(uint32_t));
+		file.write(reinterpret_cast<const char*>(&driverVersion), sizeof(uint32_t));
+	}
+
+	EXPECT_EQ(ctx->readPipelineCacheFile(data), false);
+
+	EXPECT_EQ(ctx->savePipelineCache(), true);
+	EXPECT_EQ(ctx->readPipelineCacheFile(data), true);
+}
@@ -3,6 +3,8 @@
 #include "VkTransfer.h"
 #include "Catalyzer/VkSort.h"
 
+#include <algorithm>
+
 using namespace dyno;
 
 TEST(VkSort, sort)
@@ -35,4 +37,106 @@ TEST(VkSort, sort)
 			EXPECT_EQ(keys[i] >= keys[i + 1], true);
 		//printf("key[%d]=%d  values[%d]=%d\n", i, keys[i], i, values[i]);
 	}
-}
\ No newline at end of file
+}
+
+TEST(VkSort, radix_sort)
+{
+	VkSystem::instance()->initialize();
+
+	VkSort<float> sortFloat;
+	std::vector<float> keys(3000);
+	for (std::size_t i = 0; i < keys.size(); i++)
+	{
+		keys[i] = float(rand() % 4096) - 2048.0f;
+	}
+
+	std::vector<float> expected = keys;
+	std::sort(expected.begin(), expected.end(), std::greater<float>());
+
+	sortFloat.radix_sort(keys, DOWN);
+	EXPECT_EQ(keys == expected, true);
+
+	VkSort<uint64_t> sortMorton;
+	std::vector<uint64_t> codes(1000);
+	for (std::size_t i = 0; i < codes.size(); i++)
+	{
+		codes[i] = (uint64_t(rand()) << 33) ^ uint64_t(rand());
+	}
+
+	std::vector<uint64_t> sortedCodes = codes;
+	std::sort(sortedCodes.begin(), sortedCodes.end());
+
+	sortMorton.radix_sort(codes, UP);
+	EXPECT_EQ(codes == sortedCodes, true);
+}
+
+TEST(VkSort, radix_sort_by_key)
+{
+	VkSystem::instance()->initialize();
+
+	struct Payload
+	{
+		uint32_t id;
+		float weight[3];
+	};
+
+	VkSort<int> sortInt;
+	std::vector<int> keys(2000);
+	std::vector<Payload> values(keys.size());
+	for (std::size_t i = 0; i < keys.size(); i++)
+	{
+		keys[i] = rand() % 64 - 32;
+		values[i].id = i;
+	}
+
+	std::vector<uint32_t> order(keys.size());
+	for (std::size_t i = 0; i < order.size(); i++)
+		order[i] = i;
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+
+	std::vector<int> original = keys;
+	sortInt.radix_sort_by_key(keys, values, UP);
+
+	//The radix sort is stable, equal keys keep their order
+	for (std::size_t i = 0; i < keys.size(); i++)
+	{
+		EXPECT_EQ(values[i].id, order[i]);
+		EXPECT_EQ(keys[i], original[order[i]]);
+	}
+}
+
+TEST(VkSort, segmented_sort)
+{
+	VkSystem::instance()->initialize();
+
+	std::vector<uint32_t> keys(1000);
+	for (std::size_t i = 0; i < keys.size(); i++)
+	{
+		keys[i] = rand();
+	}
+
+	std::vector<uint32_t> offsets;
+	for (uint32_t i = 0; i < keys.size(); i += 1 + rand() % 20)
+		offsets.push_back(i);
+
+	std::vector<uint32_t> expected = keys;
+	for (std::size_t s = 0; s < offsets.size(); s++)
+	{
+		uint32_t end = s + 1 < offsets.size() ? offsets[s + 1] : keys.size();
+		std::sort(expected.begin() + offsets[s], expected.begin() + end);
+	}
+
+	VkDeviceArray<uint32_t> dKeys;
+	dKeys.resize(keys.size());
+	vkTransfer(dKeys, keys);
+
+	VkDeviceArray<uint32_t> dOffsets;
+	dOffsets.resize(offsets.size());
+	vkTransfer(dOffsets, offsets);
+
+	VkSort<uint32_t> sortUInt;
+	sortUInt.segmented_sort(dKeys, dOffsets, UP);
+
+	vkTransfer(keys, dKeys);
+	EXPECT_EQ(keys == expected, true);
+}